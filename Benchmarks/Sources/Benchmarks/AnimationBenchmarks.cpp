@@ -0,0 +1,270 @@
+#include "o2/stdafx.h"
+
+#include "o2/Animation/AnimationClip.h"
+#include "o2/Animation/AnimationPlayer.h"
+#include "o2/Animation/Tracks/AnimationFloatTrack.h"
+#include "o2/Animation/Tracks/AnimationVec2FTrack.h"
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Components/AnimationComponent.h"
+#include "o2/Utils/Debug/Benchmark.h"
+#include "o2/Utils/Math/Curve.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// Creates looped clip with random position and angle curves of 11 keys
+	static AnimationClip* CreateRandomClip()
+	{
+		AnimationClip* clip = mnew AnimationClip();
+		clip->SetLoop(Loop::Repeat);
+
+		auto positionTrack = clip->AddTrack<Vec2F>("transform/position");
+		auto angleTrack = clip->AddTrack<float>("transform/angle");
+
+		positionTrack->BeginKeysBatchChange();
+		angleTrack->BeginKeysBatchChange();
+
+		for (int i = 0; i <= 10; i++)
+		{
+			float position = (float)i*0.1f;
+			positionTrack->AddKey(position, Vec2F(Math::Random(-100.0f, 100.0f), Math::Random(-100.0f, 100.0f)));
+			angleTrack->AddKey(position, Math::Random(0.0f, Math::PI()*2.0f));
+		}
+
+		positionTrack->CompleteKeysBatchingChange();
+		angleTrack->CompleteKeysBatchingChange();
+
+		return clip;
+	}
+
+	// Updates 2000 players of different clips, each animating position and angle of own actor
+	BENCHMARK("Animation/EvaluateClips", 100)
+	{
+		const int playersCount = 2000;
+
+		Vector<Actor*> actors;
+		Vector<AnimationClip*> clips;
+		Vector<AnimationPlayer*> players;
+
+		for (int i = 0; i < playersCount; i++)
+		{
+			Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+			AnimationClip* clip = CreateRandomClip();
+
+			AnimationPlayer* player = mnew AnimationPlayer(actor, clip);
+			player->SetTime(Math::Random(0.0f, 1.0f));
+			player->Play();
+
+			actors.Add(actor);
+			clips.Add(clip);
+			players.Add(player);
+		}
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			for (auto player : players)
+				player->Update(1.0f/60.0f);
+		}
+
+		context.End();
+
+		for (auto player : players)
+			delete player;
+
+		for (auto clip : clips)
+			delete clip;
+
+		for (auto actor : actors)
+			delete actor;
+	}
+
+	// Updates 5000 animation components, each blending two states with masks. Position and angle tracks of both
+	// states are mixed with mask weights on each update
+	BENCHMARK("Animation/UpdateComponents5k", 20)
+	{
+		const int actorsCount = 5000;
+		const int clipsCount = 20;
+
+		Vector<AnimationClip*> clips;
+		for (int i = 0; i < clipsCount; i++)
+			clips.Add(CreateRandomClip());
+
+		AnimationMask walkMask, aimMask;
+		walkMask.weights.Add("transform/angle", 0.3f);
+		aimMask.weights.Add("transform/position", 0.2f);
+
+		Vector<Actor*> actors;
+		Vector<AnimationComponent*> components;
+
+		for (int i = 0; i < actorsCount; i++)
+		{
+			Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+			AnimationComponent* component = actor->AddComponent<AnimationComponent>();
+
+			AnimationState* walkState = component->AddState("walk", *clips[i%clipsCount], walkMask, 1.0f);
+			AnimationState* aimState = component->AddState("aim", *clips[(i*7 + 3)%clipsCount], aimMask, 0.5f);
+
+			walkState->player.SetTime(Math::Random(0.0f, 1.0f));
+			walkState->player.Play();
+			aimState->player.SetTime(Math::Random(0.0f, 1.0f));
+			aimState->player.Play();
+
+			actors.Add(actor);
+			components.Add(component);
+		}
+
+		// First update binds mixers, it isn't measured
+		for (auto component : components)
+			component->Update(1.0f/60.0f);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			for (auto component : components)
+				component->Update(1.0f/60.0f);
+		}
+
+		context.End();
+
+		for (auto actor : actors)
+			delete actor;
+
+		for (auto clip : clips)
+			delete clip;
+	}
+
+	// Creates curve of 11 smooth keys with random values
+	static Curve CreateRandomCurve()
+	{
+		Curve curve;
+		curve.BeginKeysBatchChange();
+
+		for (int i = 0; i <= 10; i++)
+			curve.InsertKey((float)i*0.1f, Math::Random(-100.0f, 100.0f));
+
+		curve.CompleteKeysBatchingChange();
+
+		return curve;
+	}
+
+	// Returns maximal difference between curve and reference curve values at positions
+	static float GetCurveMaxError(const Curve& curve, const Curve& reference, const Vector<float>& positions)
+	{
+		float maxError = 0.0f;
+		for (auto position : positions)
+			maxError = Math::Max(maxError, Math::Abs(curve.Evaluate(position) - reference.Evaluate(position)));
+
+		return maxError;
+	}
+
+	// Measures errors of approximated and baked curves. Reference is curve baked with 65536 samples, its samples are
+	// solved exactly and linear interpolation error between them is negligible
+	HEADLESS_BENCHMARK("Animation/CurveAccuracy", 1)
+	{
+		const int positionsCount = 10000;
+
+		Curve curve = CreateRandomCurve();
+
+		Curve reference(curve);
+		reference.Bake(65536);
+
+		Vector<float> positions;
+		for (int i = 0; i < positionsCount; i++)
+			positions.Add(Math::Random(0.0f, 1.0f));
+
+		context.Begin();
+		float approximationError = GetCurveMaxError(curve, reference, positions);
+		context.End();
+
+		context.SetMetric("approximationMaxError", approximationError);
+
+		int samplesCounts[] = { 64, 256, 1024 };
+		float bakedErrors[3];
+		for (int i = 0; i < 3; i++)
+		{
+			Curve baked(curve);
+			baked.Bake(samplesCounts[i]);
+
+			bakedErrors[i] = GetCurveMaxError(baked, reference, positions);
+			context.SetMetric(String::Format("baked%iMaxError", samplesCounts[i]), bakedErrors[i]);
+		}
+
+		context.Check(bakedErrors[2] <= bakedErrors[0], "Baked curve error doesn't decrease with samples count");
+		context.Check(bakedErrors[2] < 1.0f, String::Format("Curve baked with 1024 samples max error %f", bakedErrors[2]));
+	}
+
+	// Evaluates approximated curve at 10000 random positions
+	HEADLESS_BENCHMARK("Animation/CurveEvaluate10k", 100)
+	{
+		const int positionsCount = 10000;
+
+		Curve curve = CreateRandomCurve();
+
+		Vector<float> positions, results;
+		for (int i = 0; i < positionsCount; i++)
+			positions.Add(Math::Random(0.0f, 1.0f));
+
+		results.Resize(positionsCount);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			curve.Evaluate(positions.Data(), results.Data(), positionsCount);
+
+		context.End();
+	}
+
+	// Evaluates baked curve at 10000 random positions, compare with Animation/CurveEvaluate10k
+	HEADLESS_BENCHMARK("Animation/CurveEvaluateBaked10k", 100)
+	{
+		const int positionsCount = 10000;
+
+		Curve curve = CreateRandomCurve();
+		curve.Bake();
+
+		Vector<float> positions, results;
+		for (int i = 0; i < positionsCount; i++)
+			positions.Add(Math::Random(0.0f, 1.0f));
+
+		results.Resize(positionsCount);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			curve.Evaluate(positions.Data(), results.Data(), positionsCount);
+
+		context.End();
+	}
+
+	// Evaluates 1000 different baked curves at same position, like animation tracks of many players
+	HEADLESS_BENCHMARK("Animation/CurvesEvaluateBaked1k", 100)
+	{
+		const int curvesCount = 1000;
+
+		Vector<Curve> curves;
+		Vector<const Curve*> curvesPtrs;
+		Vector<float> results;
+
+		for (int i = 0; i < curvesCount; i++)
+			curves.Add(CreateRandomCurve());
+
+		for (auto& curve : curves)
+		{
+			curve.Bake();
+			curvesPtrs.Add(&curve);
+		}
+
+		results.Resize(curvesCount);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			Curve::Evaluate(curvesPtrs.Data(), curvesCount, Math::Random(0.0f, 1.0f), results.Data());
+
+		context.End();
+	}
+}
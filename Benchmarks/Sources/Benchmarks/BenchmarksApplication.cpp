@@ -0,0 +1,25 @@
+#include "o2/stdafx.h"
+#include "BenchmarksApplication.h"
+
+#include "o2/Scene/Scene.h"
+#include "o2/Utils/Debug/Benchmark.h"
+
+namespace Benchmarks
+{
+	BenchmarksApplication::BenchmarksApplication(int argc, char** argv):
+		mArgc(argc), mArgv(argv)
+	{}
+
+	int BenchmarksApplication::GetExitCode() const
+	{
+		return mExitCode;
+	}
+
+	void BenchmarksApplication::OnStarted()
+	{
+		mExitCode = BenchmarksRunner::RunFromCommandLine(mArgc, mArgv);
+		o2Scene.Clear();
+
+		Shutdown();
+	}
+}
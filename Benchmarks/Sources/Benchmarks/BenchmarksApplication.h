@@ -0,0 +1,31 @@
+#pragma once
+
+#include "o2/Application/Application.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// ----------------------------------------------------------------------------------------------------
+	// Benchmarks application. Initializes engine systems, runs registered benchmarks on start with command
+	// line arguments and closes. Rendering isn't performed, frames aren't processed while benchmarks run
+	// ----------------------------------------------------------------------------------------------------
+	class BenchmarksApplication: public Application
+	{
+	public:
+		// Constructor with command line arguments
+		BenchmarksApplication(int argc, char** argv);
+
+		// Returns process exit code, received from benchmarks runner
+		int GetExitCode() const;
+
+	protected:
+		int    mArgc;         // Command line arguments count
+		char** mArgv;         // Command line arguments
+		int    mExitCode = 0; // Process exit code
+
+	protected:
+		// Runs benchmarks and closes application
+		void OnStarted() override;
+	};
+}
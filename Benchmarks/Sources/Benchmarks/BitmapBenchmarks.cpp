@@ -0,0 +1,116 @@
+#include "o2/stdafx.h"
+
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Debug/Benchmark.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// Fills bitmap with random colors and anti-aliased circles in alpha, like glyphs bitmap
+	static void FillGlyphsBitmap(Bitmap& bitmap)
+	{
+		Vec2I size = bitmap.GetSize();
+		UInt8* data = bitmap.GetData();
+
+		for (int i = 0; i < size.x*size.y; i++)
+		{
+			data[i*4] = (UInt8)Math::Random(0, 255);
+			data[i*4 + 1] = (UInt8)Math::Random(0, 255);
+			data[i*4 + 2] = (UInt8)Math::Random(0, 255);
+			data[i*4 + 3] = 0;
+		}
+
+		int circlesCount = size.x*size.y/400;
+		for (int i = 0; i < circlesCount; i++)
+		{
+			Vec2F center((float)Math::Random(0, size.x), (float)Math::Random(0, size.y));
+			float radius = Math::Random(2.0f, 10.0f);
+
+			int left = Math::Max(0, Math::FloorToInt(center.x - radius)), right = Math::Min(size.x - 1, Math::CeilToInt(center.x + radius));
+			int bottom = Math::Max(0, Math::FloorToInt(center.y - radius)), top = Math::Min(size.y - 1, Math::CeilToInt(center.y + radius));
+
+			for (int y = bottom; y <= top; y++)
+			{
+				for (int x = left; x <= right; x++)
+				{
+					float coverage = Math::Clamp01(radius - (Vec2F((float)x, (float)y) - center).Length());
+					UInt8& alpha = data[(y*size.x + x)*4 + 3];
+					alpha = Math::Max(alpha, (UInt8)(coverage*255.0f));
+				}
+			}
+		}
+	}
+
+	// Applies shadow font effect to 64x64 glyph bitmap: colorises copy, blurs it and blends under glyph
+	HEADLESS_BENCHMARK("Bitmap/GlyphShadowEffect", 200)
+	{
+		Bitmap glyph(PixelFormat::R8G8B8A8, Vec2I(64, 64));
+		FillGlyphsBitmap(glyph);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			Bitmap shadow(glyph);
+			shadow.Colorise(Color4::Black());
+			shadow.Blur(2.0f);
+			glyph.BlendImage(&shadow, Vec2I(2, 2));
+		}
+
+		context.End();
+	}
+
+	// Applies stroke font effect with radius 2 to 64x64 glyph bitmap
+	HEADLESS_BENCHMARK("Bitmap/GlyphStrokeEffect", 200)
+	{
+		Bitmap glyph(PixelFormat::R8G8B8A8, Vec2I(64, 64));
+		FillGlyphsBitmap(glyph);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			Bitmap stroked(glyph);
+			stroked.Outline(2.0f, Color4::Black());
+		}
+
+		context.End();
+	}
+
+	// Blurs 1024x1024 bitmap with radius 8
+	HEADLESS_BENCHMARK("Bitmap/Blur1024", 5)
+	{
+		Bitmap source(PixelFormat::R8G8B8A8, Vec2I(1024, 1024));
+		FillGlyphsBitmap(source);
+
+		Bitmap bitmap(source);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			bitmap.Blur(8.0f);
+
+		context.End();
+	}
+
+	// Blends, colorises and premultiplies 1024x1024 bitmaps
+	HEADLESS_BENCHMARK("Bitmap/BlendColorise1024", 20)
+	{
+		Bitmap bitmap(PixelFormat::R8G8B8A8, Vec2I(1024, 1024));
+		Bitmap other(PixelFormat::R8G8B8A8, Vec2I(1024, 1024));
+		FillGlyphsBitmap(bitmap);
+		FillGlyphsBitmap(other);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			bitmap.BlendImage(&other, Vec2I(3, 3));
+			bitmap.Colorise(Color4(255, 255, 255, 250));
+			bitmap.PremultiplyAlpha();
+		}
+
+		context.End();
+	}
+}
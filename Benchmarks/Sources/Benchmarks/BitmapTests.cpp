@@ -0,0 +1,250 @@
+#include "o2/stdafx.h"
+
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Debug/Benchmark.h"
+
+using namespace o2;
+
+// Bitmap correctness checks. Expected hashes are hashes of current processing results, any change of them must be
+// verified visually. Hashes depend on exact floating point rounding, so they are valid only without contracting
+// to FMA instructions (default /fp:precise). Run only checks with -filter Tests/
+namespace Benchmarks
+{
+	// Fills bitmap with random colors and anti-aliased circles, like glyphs bitmap. Circles are in alpha of R8G8B8A8
+	// and R8 bitmaps, and in all channels of R8G8B8. Own random generator is used, because rand() sequences are
+	// different on platforms
+	static void FillTestGlyphsBitmap(Bitmap& bitmap, UInt seed)
+	{
+		Math::XorShiftRandom random(seed);
+
+		Vec2I size = bitmap.GetSize();
+		UInt8* data = bitmap.GetData();
+
+		int bpp[] = { 4, 3, 1 };
+		int pixelSize = bpp[(int)bitmap.GetFormat()];
+		int coverageChannel = pixelSize == 4 ? 3 : 0;
+
+		for (int i = 0; i < size.x*size.y*pixelSize; i++)
+			data[i] = (UInt8)(random.Next() & 0xff);
+
+		if (pixelSize != 3)
+		{
+			for (int i = 0; i < size.x*size.y; i++)
+				data[i*pixelSize + coverageChannel] = 0;
+		}
+
+		int circlesCount = size.x*size.y/400 + 2;
+		for (int i = 0; i < circlesCount; i++)
+		{
+			Vec2F center((float)(random.Next()%size.x), (float)(random.Next()%size.y));
+			float radius = (float)(2 + random.Next()%8);
+
+			int left = Math::Max(0, Math::FloorToInt(center.x - radius)), right = Math::Min(size.x - 1, Math::CeilToInt(center.x + radius));
+			int bottom = Math::Max(0, Math::FloorToInt(center.y - radius)), top = Math::Min(size.y - 1, Math::CeilToInt(center.y + radius));
+
+			for (int y = bottom; y <= top; y++)
+			{
+				for (int x = left; x <= right; x++)
+				{
+					float dx = (float)x - center.x, dy = (float)y - center.y;
+					UInt8 coverage = (UInt8)(Math::Clamp01(radius - Math::Sqrt(dx*dx + dy*dy))*255.0f);
+					UInt8* pixel = data + (y*size.x + x)*pixelSize;
+
+					for (int c = coverageChannel; c < pixelSize; c++)
+						pixel[c] = Math::Max(pixel[c], coverage);
+				}
+			}
+		}
+	}
+
+	// Returns FNV-1a hash of bitmap pixels
+	static UInt GetBitmapHash(Bitmap& bitmap)
+	{
+		int bpp[] = { 4, 3, 1 };
+		int dataSize = bitmap.GetSize().x*bitmap.GetSize().y*bpp[(int)bitmap.GetFormat()];
+		const UInt8* data = bitmap.GetData();
+
+		UInt hash = 2166136261u;
+		for (int i = 0; i < dataSize; i++)
+			hash = (hash ^ data[i])*16777619u;
+
+		return hash;
+	}
+
+	// Checks bitmap pixels hash
+	static void CheckBitmapHash(BenchmarkContext& context, Bitmap& bitmap, UInt expectedHash, const char* operation)
+	{
+		UInt hash = GetBitmapHash(bitmap);
+		context.Check(hash == expectedHash, String::Format("%s: pixels hash 0x%08x, expected 0x%08x", operation, hash, expectedHash));
+	}
+
+	// Checks colorising and alpha premultiplying of R8G8B8A8 bitmap, size isn't multiple of SSE pixels block
+	HEADLESS_BENCHMARK("Tests/Bitmap/ColorisePremultiply", 1)
+	{
+		Bitmap bitmap(PixelFormat::R8G8B8A8, Vec2I(37, 29));
+		FillTestGlyphsBitmap(bitmap, 1);
+
+		context.Begin();
+		bitmap.Colorise(Color4(200, 100, 50, 180));
+		context.End();
+
+		CheckBitmapHash(context, bitmap, 0x29de091f, "Colorise");
+
+		bitmap.PremultiplyAlpha();
+		CheckBitmapHash(context, bitmap, 0x603c4248, "PremultiplyAlpha");
+	}
+
+	// Checks blending of R8G8B8A8 bitmaps: whole image, part of image and image clipped by negative position
+	HEADLESS_BENCHMARK("Tests/Bitmap/BlendImage", 1)
+	{
+		Bitmap source(PixelFormat::R8G8B8A8, Vec2I(37, 29)), other(PixelFormat::R8G8B8A8, Vec2I(37, 29));
+		FillTestGlyphsBitmap(source, 1);
+		FillTestGlyphsBitmap(other, 2);
+
+		Bitmap bitmap(source);
+
+		context.Begin();
+		bitmap.BlendImage(&other, Vec2I(2, 3));
+		context.End();
+
+		CheckBitmapHash(context, bitmap, 0x79d49b9a, "BlendImage");
+
+		bitmap = source;
+		bitmap.BlendImage(&other, Vec2I(5, 1), RectI(3, 20, 30, 4));
+		CheckBitmapHash(context, bitmap, 0xa8507544, "BlendImage with source rect");
+
+		bitmap = source;
+		bitmap.BlendImage(&other, Vec2I(-4, -3));
+		CheckBitmapHash(context, bitmap, 0xe73e8642, "BlendImage with negative position");
+	}
+
+	// Checks copying of R8G8B8A8 bitmaps: whole image, part of image and image clipped by negative position
+	HEADLESS_BENCHMARK("Tests/Bitmap/CopyImage", 1)
+	{
+		Bitmap source(PixelFormat::R8G8B8A8, Vec2I(37, 29)), other(PixelFormat::R8G8B8A8, Vec2I(37, 29));
+		FillTestGlyphsBitmap(source, 1);
+		FillTestGlyphsBitmap(other, 2);
+
+		Bitmap bitmap(source);
+
+		context.Begin();
+		bitmap.CopyImage(&other, Vec2I(2, 3));
+		context.End();
+
+		CheckBitmapHash(context, bitmap, 0xc660a809, "CopyImage");
+
+		bitmap = source;
+		bitmap.CopyImage(&other, Vec2I(5, 1), RectI(3, 20, 30, 4));
+		CheckBitmapHash(context, bitmap, 0xe1ffc166, "CopyImage with source rect");
+
+		bitmap = source;
+		bitmap.CopyImage(&other, Vec2I(-4, -3));
+		CheckBitmapHash(context, bitmap, 0x0de9b909, "CopyImage with negative position");
+	}
+
+	// Checks horizontal gradient by alpha. Gradient direction is axis aligned, so it doesn't depend on sin() and
+	// cos() precision on platform
+	HEADLESS_BENCHMARK("Tests/Bitmap/GradientByAlpha", 1)
+	{
+		Bitmap bitmap(PixelFormat::R8G8B8A8, Vec2I(37, 29));
+		FillTestGlyphsBitmap(bitmap, 1);
+
+		context.Begin();
+		bitmap.GradientByAlpha(Color4(200, 150, 100, 255), Color4(255, 255, 255, 128), -90.0f, 30.0f, Vec2F(0.1f, 0.2f));
+		context.End();
+
+		CheckBitmapHash(context, bitmap, 0xdf775d14, "GradientByAlpha");
+	}
+
+	// Checks outline with fractional and integer radiuses
+	HEADLESS_BENCHMARK("Tests/Bitmap/Outline", 1)
+	{
+		Bitmap source(PixelFormat::R8G8B8A8, Vec2I(64, 64));
+		FillTestGlyphsBitmap(source, 1);
+
+		Bitmap bitmap(source);
+
+		context.Begin();
+		bitmap.Outline(1.5f, Color4(0, 0, 0, 255));
+		context.End();
+
+		CheckBitmapHash(context, bitmap, 0xefcbbdd4, "Outline 1.5");
+
+		bitmap = source;
+		bitmap.Outline(3.0f, Color4(20, 40, 60, 200), 50);
+		CheckBitmapHash(context, bitmap, 0xef3e9e56, "Outline 3");
+	}
+
+	// Checks blur with fractional and integer radiuses
+	HEADLESS_BENCHMARK("Tests/Bitmap/Blur", 1)
+	{
+		Bitmap source(PixelFormat::R8G8B8A8, Vec2I(64, 64));
+		FillTestGlyphsBitmap(source, 1);
+
+		Bitmap bitmap(source);
+
+		context.Begin();
+		bitmap.Blur(1.5f);
+		context.End();
+
+		CheckBitmapHash(context, bitmap, 0x8fd38abe, "Blur 1.5");
+
+		bitmap = source;
+		bitmap.Blur(4.0f);
+		CheckBitmapHash(context, bitmap, 0x4beeed9e, "Blur 4");
+	}
+
+	// Checks R8G8B8 and R8 bitmaps processing, which isn't vectorized. Alpha operations don't change R8G8B8 bitmap
+	HEADLESS_BENCHMARK("Tests/Bitmap/NotAlphaFormats", 1)
+	{
+		PixelFormat formats[] = { PixelFormat::R8G8B8, PixelFormat::R8 };
+		const char* names[] = { "R8G8B8", "R8" };
+		UInt expectedHashes[][4] = { { 0x1be792ab, 0x1be792ab, 0x1be792ab, 0x77003418 },
+		                             { 0x67137739, 0x5a2fcefe, 0x86968c97, 0xd4ed132d } };
+
+		context.Begin();
+
+		for (int i = 0; i < 2; i++)
+		{
+			Bitmap bitmap(formats[i], Vec2I(37, 29)), other(formats[i], Vec2I(37, 29));
+			FillTestGlyphsBitmap(bitmap, 1);
+			FillTestGlyphsBitmap(other, 2);
+
+			bitmap.Colorise(Color4(200, 100, 50, 180));
+			CheckBitmapHash(context, bitmap, expectedHashes[i][0], String::Format("%s Colorise", names[i]).Data());
+
+			bitmap.BlendImage(&other, Vec2I(2, 3));
+			CheckBitmapHash(context, bitmap, expectedHashes[i][1], String::Format("%s BlendImage", names[i]).Data());
+
+			bitmap.Outline(2.0f, Color4(0, 0, 0, 255));
+			CheckBitmapHash(context, bitmap, expectedHashes[i][2], String::Format("%s Outline", names[i]).Data());
+
+			bitmap.Blur(2.5f);
+			CheckBitmapHash(context, bitmap, expectedHashes[i][3], String::Format("%s Blur", names[i]).Data());
+		}
+
+		context.End();
+	}
+
+	// Checks processing of bitmap, which is large enough for splitting rows between workers. Results must be the same
+	// as on one thread
+	HEADLESS_BENCHMARK("Tests/Bitmap/ParallelRows", 1)
+	{
+		Bitmap bitmap(PixelFormat::R8G8B8A8, Vec2I(640, 480)), other(PixelFormat::R8G8B8A8, Vec2I(640, 480));
+		FillTestGlyphsBitmap(bitmap, 1);
+		FillTestGlyphsBitmap(other, 2);
+
+		context.Begin();
+
+		bitmap.BlendImage(&other, Vec2I(3, 3));
+		bitmap.Colorise(Color4(255, 200, 150, 250));
+		bitmap.GradientByAlpha(Color4(200, 150, 100, 255), Color4(255, 255, 255, 128), -90.0f);
+		bitmap.Outline(2.0f, Color4(0, 0, 0, 255));
+		bitmap.Blur(3.0f);
+		bitmap.PremultiplyAlpha();
+
+		context.End();
+
+		CheckBitmapHash(context, bitmap, 0xfb732713, "Processing chain");
+	}
+}
@@ -0,0 +1,130 @@
+#include "o2/stdafx.h"
+
+#include "o2/Utils/Debug/Benchmark.h"
+#include "o2/Utils/Delegates.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// -----------------------------------------
+	// Events receiver with member event handler
+	// -----------------------------------------
+	class EventsReceiver
+	{
+	public:
+		int sum = 0; // Sum of received values
+
+	public:
+		// Receives event value
+		void OnEvent(int value) { sum += value; }
+	};
+
+	// Subscribes 1000 receivers to event and unsubscribes them by handles
+	HEADLESS_BENCHMARK("Delegates/SubscribeUnsubscribeByHandle1000", 100)
+	{
+		Vector<EventsReceiver> receivers;
+		receivers.Resize(1000);
+
+		Vector<FunctionHandle> handles;
+		handles.Reserve(receivers.Count());
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			Function<void(int)> event;
+
+			for (auto& receiver : receivers)
+				handles.Add(event.Add(&receiver, &EventsReceiver::OnEvent));
+
+			for (auto& handle : handles)
+				event.Remove(handle);
+
+			handles.Clear();
+		}
+
+		context.End();
+	}
+
+	// Subscribes 1000 receivers to event and unsubscribes them by functions comparison
+	HEADLESS_BENCHMARK("Delegates/SubscribeUnsubscribeByFunction1000", 10)
+	{
+		Vector<EventsReceiver> receivers;
+		receivers.Resize(1000);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			Function<void(int)> event;
+
+			for (auto& receiver : receivers)
+				event += MakeFunction(&receiver, &EventsReceiver::OnEvent);
+
+			for (auto& receiver : receivers)
+				event -= MakeFunction(&receiver, &EventsReceiver::OnEvent);
+		}
+
+		context.End();
+	}
+
+	// Invokes event with 16 member receivers
+	HEADLESS_BENCHMARK("Delegates/Invoke16Members", 100000)
+	{
+		Vector<EventsReceiver> receivers;
+		receivers.Resize(16);
+
+		Function<void(int)> event;
+		for (auto& receiver : receivers)
+			event.Add(&receiver, &EventsReceiver::OnEvent);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			event(i);
+
+		context.End();
+	}
+
+	// Invokes event with 16 capturing lambda receivers
+	HEADLESS_BENCHMARK("Delegates/Invoke16Lambdas", 100000)
+	{
+		int sum = 0;
+
+		Function<void(int)> event;
+		for (int i = 0; i < 16; i++)
+			event += [&sum, i](int value) { sum += value + i; };
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			event(i);
+
+		context.End();
+	}
+
+	// Invokes event, which receiver subscribes and unsubscribes another receiver while invoking
+	HEADLESS_BENCHMARK("Delegates/InvokeWithReentrantSubscription", 100000)
+	{
+		EventsReceiver receiver, reentrantReceiver;
+
+		Function<void(int)> event;
+		FunctionHandle reentrantHandle;
+
+		event.Add(&receiver, &EventsReceiver::OnEvent);
+		event += [&](int value) {
+			if (value%2 == 0)
+				reentrantHandle = event.Add(&reentrantReceiver, &EventsReceiver::OnEvent);
+			else
+				event.Remove(reentrantHandle);
+		};
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			event(i);
+
+		context.End();
+	}
+}
@@ -0,0 +1,20 @@
+#include "o2/stdafx.h"
+
+#include "BenchmarksApplication.h"
+#include "o2/Utils/Debug/Benchmark.h"
+
+int main(int argc, char** argv)
+{
+	// Headless run doesn't create application and window, only benchmarks independent of engine systems are run
+	if (BenchmarksRunner::IsHeadless(argc, argv))
+		return BenchmarksRunner::RunFromCommandLine(argc, argv);
+
+	auto app = mnew Benchmarks::BenchmarksApplication(argc, argv);
+	app->Initialize();
+	app->Launch();
+
+	int exitCode = app->GetExitCode();
+	delete app;
+
+	return exitCode;
+}
@@ -0,0 +1,150 @@
+#include "o2/stdafx.h"
+
+#include "o2/Physics/PhysicsWorld.h"
+#include "o2/Scene/Physics/BoxCollider.h"
+#include "o2/Scene/Physics/RigidBody.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Utils/Debug/Benchmark.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// Creates 1000 static bodies with box colliders in random positions and 10000 random rays between them
+	static void CreateRayCastWorkload(Vector<PhysicsWorld::RayCastQuery>& queries)
+	{
+		const float worldSize = 5000.0f;
+
+		for (int i = 0; i < 1000; i++)
+		{
+			RigidBody* body = mnew RigidBody();
+			body->SetBodyType(RigidBody::Type::Static);
+			body->transform->position = Vec2F(Math::Random(-worldSize, worldSize), Math::Random(-worldSize, worldSize));
+			body->transform->angle = Math::Random(0.0f, Math::PI());
+
+			auto collider = body->AddComponent<BoxCollider>();
+			collider->SetFitByActor(false);
+			collider->SetSize(Vec2F(Math::Random(20.0f, 200.0f), Math::Random(20.0f, 200.0f)));
+		}
+
+		o2Scene.Update(0.0f);
+		o2Physics.PreUpdate();
+		o2Physics.PostUpdate();
+
+		queries.Resize(10000);
+		for (auto& query : queries)
+		{
+			query.from = Vec2F(Math::Random(-worldSize, worldSize), Math::Random(-worldSize, worldSize));
+			query.to = query.from + Vec2F::Rotated(Math::Random(0.0f, Math::PI()*2.0f))*Math::Random(100.0f, 3000.0f);
+		}
+	}
+
+	// Casts 10000 rays one by one on main thread
+	BENCHMARK("Physics/RayCast10k", 20)
+	{
+		Vector<PhysicsWorld::RayCastQuery> queries;
+		CreateRayCastWorkload(queries);
+
+		PhysicsWorld::RayCastHit hit;
+		int hitsCount = 0;
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			for (auto& query : queries)
+				hitsCount += o2Physics.RayCast(query.from, query.to, hit, query.layersMask) ? 1 : 0;
+		}
+
+		context.End();
+
+		o2Scene.Clear();
+	}
+
+	// Casts 10000 rays as one batch on workers
+	BENCHMARK("Physics/RayCastBatch10k", 20)
+	{
+		Vector<PhysicsWorld::RayCastQuery> queries;
+		CreateRayCastWorkload(queries);
+
+		Vector<PhysicsWorld::RayCastHit> hits;
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			o2Physics.RayCastBatch(queries, hits);
+
+		context.End();
+
+		o2Scene.Clear();
+	}
+
+	// Creates static ground and 200 piles of 100 dynamic boxes, 20000 bodies total. Piles fall on ground and form
+	// independent islands. Simulates one second to settle contacts
+	static void CreateStepWorkload()
+	{
+		RigidBody* ground = mnew RigidBody();
+		ground->SetBodyType(RigidBody::Type::Static);
+
+		auto groundCollider = ground->AddComponent<BoxCollider>();
+		groundCollider->SetFitByActor(false);
+		groundCollider->SetSize(Vec2F(200*60.0f, 20.0f));
+
+		for (int pile = 0; pile < 200; pile++)
+		{
+			for (int i = 0; i < 100; i++)
+			{
+				RigidBody* body = mnew RigidBody();
+				body->transform->position = Vec2F((pile - 100)*60.0f + Math::Random(-2.0f, 2.0f), 20.0f + i*21.0f);
+
+				auto collider = body->AddComponent<BoxCollider>();
+				collider->SetFitByActor(false);
+				collider->SetSize(Vec2F(20.0f, 20.0f));
+			}
+		}
+
+		o2Scene.Update(0.0f);
+
+		for (int i = 0; i < 60; i++)
+		{
+			o2Physics.PreUpdate();
+			o2Physics.Update(1.0f/60.0f);
+			o2Physics.PostUpdate();
+		}
+	}
+
+	// Performs fixed steps of 20000 bodies world with workers count
+	static void RunStepBenchmark(BenchmarkContext& context, int workersCount)
+	{
+		int prevWorkersCount = o2Physics.GetWorkersCount();
+		o2Physics.SetWorkersCount(workersCount);
+
+		CreateStepWorkload();
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			o2Physics.PreUpdate();
+			o2Physics.Update(1.0f/60.0f);
+			o2Physics.PostUpdate();
+		}
+
+		context.End();
+
+		o2Scene.Clear();
+		o2Physics.SetWorkersCount(prevWorkersCount);
+	}
+
+	// Steps 20000 bodies world on main thread only
+	BENCHMARK("Physics/Step20kSingleThread", 30)
+	{
+		RunStepBenchmark(context, 0);
+	}
+
+	// Steps 20000 bodies world with islands solving and contacts finding on workers
+	BENCHMARK("Physics/Step20k", 30)
+	{
+		RunStepBenchmark(context, o2Physics.GetWorkersCount());
+	}
+}
@@ -0,0 +1,286 @@
+#include "o2/stdafx.h"
+
+#include "o2/Assets/Types/ActorAsset.h"
+#include "o2/Render/ParticlesEffects.h"
+#include "o2/Render/ParticlesEmitter.h"
+#include "o2/Render/ParticlesSystem.h"
+#include "o2/Scene/Actor.h"
+#include "o2/Scene/Components/SkinnedMeshComponent.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Utils/Debug/Benchmark.h"
+#include "o2/Utils/Serialization/DataValue.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// Creates actors hierarchy with depth and children count on each level, positions are random. Returns root actor
+	static Actor* CreateHierarchy(int depth, int childrenCount)
+	{
+		Actor* actor = mnew Actor(ActorCreateMode::InScene);
+		actor->name = "actor";
+		actor->transform->position = Vec2F(Math::Random(-100.0f, 100.0f), Math::Random(-100.0f, 100.0f));
+		actor->transform->angle = Math::Random(0.0f, Math::PI()*2.0f);
+
+		if (depth > 1)
+		{
+			for (int i = 0; i < childrenCount; i++)
+				actor->AddChild(CreateHierarchy(depth - 1, childrenCount));
+		}
+
+		return actor;
+	}
+
+	// Instantiates actors from asset with 21 actors and destroys them
+	BENCHMARK("Scene/InstantiateDestroyActorAsset", 500)
+	{
+		Actor* prototype = CreateHierarchy(3, 4);
+		ActorAssetRef asset = prototype->MakePrototype();
+
+		Vector<Actor*> actors;
+		actors.Reserve(context.operations);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			actors.Add(mnew Actor(asset));
+
+		for (auto actor : actors)
+			delete actor;
+
+		context.End();
+
+		delete prototype;
+		o2Scene.Clear();
+	}
+
+	// Updates scene with binary tree of 2047 actors, which root is rotated each update
+	BENCHMARK("Scene/UpdateDeepHierarchy", 200)
+	{
+		Actor* root = CreateHierarchy(11, 2);
+		o2Scene.Update(0.0f);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			root->transform->angle = (float)i*0.01f;
+			o2Scene.Update(1.0f/60.0f);
+		}
+
+		context.End();
+
+		o2Scene.Clear();
+	}
+
+	// Serializes scene with 4095 actors into JSON string
+	BENCHMARK("Serialization/SceneToJson", 10)
+	{
+		for (int i = 0; i < 3; i++)
+			CreateHierarchy(6, 4);
+
+		o2Scene.Update(0.0f);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			DataDocument doc;
+			o2Scene.Save(doc);
+			String json = doc.SaveAsString();
+		}
+
+		context.End();
+
+		o2Scene.Clear();
+	}
+
+	// Deserializes scene with 4095 actors from JSON string
+	BENCHMARK("Serialization/SceneFromJson", 10)
+	{
+		for (int i = 0; i < 3; i++)
+			CreateHierarchy(6, 4);
+
+		o2Scene.Update(0.0f);
+
+		DataDocument sceneDoc;
+		o2Scene.Save(sceneDoc);
+		String json = sceneDoc.SaveAsString();
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			DataDocument doc;
+			doc.LoadFromData(json);
+			o2Scene.Load(doc);
+		}
+
+		context.End();
+
+		o2Scene.Clear();
+	}
+
+	// Simulates 32 emitters with 2000 particles each, updated by particles system
+	BENCHMARK("Scene/UpdateParticles", 100)
+	{
+		const int emittersCount = 32;
+		const float dt = 1.0f/60.0f;
+
+		Vector<ParticlesEmitter*> emitters;
+		for (int i = 0; i < emittersCount; i++)
+		{
+			auto emitter = mnew ParticlesEmitter();
+			emitter->SetMaxParticles(2000);
+			emitter->SetParticlesLifetime(1.0f);
+			emitter->SetEmitParticlesPerSecond(2000.0f);
+			emitter->SetEmitParticlesSpeed(100.0f);
+			emitter->SetEmitParticlesSpeedRange(50.0f);
+			emitter->SetLoop(true);
+
+			auto gravity = mnew ParticlesGravityEffect();
+			gravity->gravity = Vec2F(0.0f, -100.0f);
+			emitter->AddEffect(gravity);
+			emitter->AddEffect<ParticlesColorEffect>();
+			emitter->AddEffect<ParticlesSizeEffect>();
+			emitter->Play();
+
+			emitters.Add(emitter);
+		}
+
+		// Fills emitters up to stable particles count
+		for (int i = 0; i < 60; i++)
+		{
+			for (auto emitter : emitters)
+				emitter->Update(dt);
+		}
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			for (auto emitter : emitters)
+				o2Particles.ScheduleUpdate(emitter, dt);
+
+			o2Particles.UpdateScheduled();
+		}
+
+		context.End();
+
+		for (auto emitter : emitters)
+			delete emitter;
+	}
+
+	// Creates actor with skinned mesh strip of 400 vertices, deformed by chain of 20 bones. Each vertex is influenced
+	// by two neighbour bones
+	static SkinnedMeshComponent* CreateSkinnedActor()
+	{
+		const int bonesCount = 20;
+		const int columnsCount = bonesCount*2 + 1;
+		const int rowsCount = 10;
+		const float boneLength = 10.0f;
+
+		Actor* actor = mnew Actor(ActorCreateMode::NotInScene);
+		actor->transform->position = Vec2F(Math::Random(-100.0f, 100.0f), Math::Random(-100.0f, 100.0f));
+
+		SkinnedMeshComponent* skin = actor->AddComponent<SkinnedMeshComponent>();
+
+		for (int i = 0; i < bonesCount; i++)
+		{
+			SkinnedMeshComponent::Bone bone;
+			bone.name = String::Format("bone%i", i);
+			bone.parent = i - 1;
+			bone.position = i == 0 ? Vec2F() : Vec2F(boneLength, 0.0f);
+			skin->bones.Add(bone);
+		}
+
+		for (int column = 0; column < columnsCount; column++)
+		{
+			float bonePosition = (float)column/2.0f;
+			int bone = Math::Min((int)bonePosition, bonesCount - 1);
+			float coef = Math::Min(bonePosition - (float)bone, 1.0f);
+
+			for (int row = 0; row < rowsCount; row++)
+			{
+				SkinnedMeshComponent::Vertex vertex;
+				vertex.position = Vec2F(bonePosition*boneLength, ((float)row - (float)rowsCount*0.5f)*2.0f);
+				vertex.uv = Vec2F((float)column/(float)(columnsCount - 1), (float)row/(float)(rowsCount - 1));
+				vertex.bone0 = bone;
+				vertex.bone1 = Math::Min(bone + 1, bonesCount - 1);
+				vertex.weight0 = 1.0f - coef;
+				vertex.weight1 = coef;
+				skin->vertices.Add(vertex);
+			}
+		}
+
+		for (int column = 0; column < columnsCount - 1; column++)
+		{
+			for (int row = 0; row < rowsCount - 1; row++)
+			{
+				int idx = column*rowsCount + row;
+				skin->indexes.Add({ idx, idx + rowsCount, idx + 1 });
+				skin->indexes.Add({ idx + 1, idx + rowsCount, idx + rowsCount + 1 });
+			}
+		}
+
+		skin->SetCurrentPoseAsBindPose();
+		skin->SetSkinChanged();
+		skin->UpdateSkin();
+
+		return skin;
+	}
+
+	// Skins 500 characters with 20 bones and 400 vertices, all bones are animated each update
+	BENCHMARK("Scene/SkinMeshes500", 50)
+	{
+		const int charactersCount = 500;
+
+		Vector<SkinnedMeshComponent*> skins;
+		for (int i = 0; i < charactersCount; i++)
+			skins.Add(CreateSkinnedActor());
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			for (int j = 0; j < charactersCount; j++)
+			{
+				SkinnedMeshComponent* skin = skins[j];
+				float phase = (float)i*0.1f + (float)j;
+
+				for (int k = 0; k < skin->bones.Count(); k++)
+					skin->bones[k].angle = Math::Sin(phase + (float)k*0.3f)*0.2f;
+
+				skin->UpdateSkin();
+			}
+		}
+
+		context.End();
+
+		for (auto skin : skins)
+			delete skin->GetOwnerActor();
+	}
+
+	// Updates skins of 500 not moving characters, vertices must not be skinned again
+	BENCHMARK("Scene/SkinStaticMeshes500", 50)
+	{
+		const int charactersCount = 500;
+
+		Vector<SkinnedMeshComponent*> skins;
+		for (int i = 0; i < charactersCount; i++)
+			skins.Add(CreateSkinnedActor());
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			for (auto skin : skins)
+				skin->UpdateSkin();
+		}
+
+		context.End();
+
+		for (auto skin : skins)
+			delete skin->GetOwnerActor();
+	}
+}
@@ -0,0 +1,111 @@
+#include "o2/stdafx.h"
+
+#include "o2/Utils/Debug/Benchmark.h"
+#include "o2/Utils/Tools/RectPacker.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// Returns random sprite size: mostly small icons and glyphs, each tenth is big sprite
+	static Vec2F GetRandomSpriteSize()
+	{
+		if (Math::Random(0, 10) > 0)
+			return Vec2F((float)Math::Random(8, 128), (float)Math::Random(8, 128));
+
+		return Vec2F((float)Math::Random(128, 512), (float)Math::Random(128, 512));
+	}
+
+	// Reports packer pages count and ratio of sprites area to pages area
+	static void SetPackingMetrics(BenchmarkContext& context, const RectsPacker& packer)
+	{
+		float fillRatio = 0.0f;
+		for (int i = 0; i < packer.GetPagesCount(); i++)
+			fillRatio += packer.GetPageFillRatio(i);
+
+		context.SetMetric("pages", packer.GetPagesCount());
+		context.SetMetric("fillRatio", fillRatio/(float)Math::Max(1, packer.GetPagesCount()));
+	}
+
+	// Packs 1000 random sized rectangles, like atlas images, into 2048x2048 pages
+	HEADLESS_BENCHMARK("Tools/PackAtlasRects", 20)
+	{
+		const int rectsCount = 1000;
+
+		Vector<Vec2F> sizes;
+		for (int i = 0; i < rectsCount; i++)
+			sizes.Add(Vec2F((float)Math::Random(8, 128), (float)Math::Random(8, 128)));
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			RectsPacker packer(Vec2F(2048, 2048));
+			for (auto& size : sizes)
+				packer.AddRect(size);
+
+			packer.Pack();
+		}
+
+		context.End();
+	}
+
+	// Packs 10000 random sized sprites into 2048x2048 pages with 1 pixel extrusion
+	HEADLESS_BENCHMARK("Tools/PackAtlas10kSprites", 3)
+	{
+		const int spritesCount = 10000;
+
+		Vector<Vec2F> sizes;
+		for (int i = 0; i < spritesCount; i++)
+			sizes.Add(GetRandomSpriteSize());
+
+		RectsPacker packer(Vec2F(2048, 2048));
+		packer.SetExtrusion(1.0f);
+
+		for (auto& size : sizes)
+			packer.AddRect(size);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			packer.Repack();
+
+		context.End();
+
+		SetPackingMetrics(context, packer);
+	}
+
+	// Replaces 100 random sprites in packed 10000 sprites atlas without full repacking
+	HEADLESS_BENCHMARK("Tools/UpdateAtlas10kSprites", 20)
+	{
+		const int spritesCount = 10000;
+		const int replaceCount = 100;
+
+		RectsPacker packer(Vec2F(2048, 2048));
+		packer.SetExtrusion(1.0f);
+
+		Vector<RectsPacker::Rect*> rects;
+		for (int i = 0; i < spritesCount; i++)
+			rects.Add(packer.AddRect(GetRandomSpriteSize()));
+
+		packer.Pack();
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			for (int j = 0; j < replaceCount; j++)
+			{
+				int idx = Math::Random(0, rects.Count() - 1);
+				packer.RemoveRect(rects[idx]);
+				rects[idx] = packer.AddRect(GetRandomSpriteSize());
+			}
+
+			packer.Pack();
+		}
+
+		context.End();
+
+		SetPackingMetrics(context, packer);
+	}
+}
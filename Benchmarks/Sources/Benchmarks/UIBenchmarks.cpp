@@ -0,0 +1,151 @@
+#include "o2/stdafx.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Scene/Scene.h"
+#include "o2/Scene/UI/UIManager.h"
+#include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Scene/UI/Widgets/ContextMenu.h"
+#include "o2/Scene/UI/Widgets/EditBox.h"
+#include "o2/Scene/UI/Widgets/VerticalLayout.h"
+#include "o2/Utils/Debug/Benchmark.h"
+#include "o2/Utils/Serialization/DataValue.h"
+
+using namespace o2;
+
+namespace Benchmarks
+{
+	// Deserializes built UI style
+	BENCHMARK("UI/LoadStyle", 5)
+	{
+		DataDocument styleData;
+		if (!styleData.LoadFromFile(o2Assets.GetBuiltAssetsPath() + "ui_style.json"))
+		{
+			context.Skip("ui_style.json isn't built");
+			return;
+		}
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+			o2UI.LoadStyle(styleData);
+
+		context.End();
+	}
+
+	// Lays out copies of all style widgets in vertical layout, which width changes each operation
+	BENCHMARK("UI/LayoutStyleWidgets", 100)
+	{
+		if (o2UI.GetWidgetStyles().IsEmpty() && o2Assets.IsAssetExist("ui_style.json"))
+			o2UI.LoadStyle("ui_style.json");
+
+		if (o2UI.GetWidgetStyles().IsEmpty())
+		{
+			context.Skip("UI style is empty");
+			return;
+		}
+
+		VerticalLayout* root = o2UI.CreateVerLayout();
+		*root->layout = WidgetLayout::Based(BaseCorner::LeftTop, Vec2F(1280, 720));
+		root->expandWidth = true;
+		root->expandHeight = false;
+
+		for (auto sample : o2UI.GetWidgetStyles())
+		{
+			Widget* widget = sample->CloneAs<Widget>();
+			widget->SetEnableForcible(true);
+			root->AddChild(widget);
+		}
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			root->layout->width = i%2 == 0 ? 1280.0f : 640.0f;
+			root->UpdateTransform();
+		}
+
+		context.End();
+
+		delete root;
+		o2Scene.Clear();
+	}
+
+	// Fills context menu with 200 items with click lambdas in 20 groups
+	BENCHMARK("UI/ContextMenuAddItems200", 20)
+	{
+		if (o2UI.GetWidgetStyles().IsEmpty() && o2Assets.IsAssetExist("ui_style.json"))
+			o2UI.LoadStyle("ui_style.json");
+
+		if (o2UI.GetWidgetStyles().IsEmpty())
+		{
+			context.Skip("UI style is empty");
+			return;
+		}
+
+		int clicks = 0;
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			ContextMenu* menu = o2UI.CreateWidget<ContextMenu>();
+
+			for (int j = 0; j < 200; j++)
+				menu->AddItem((WString)"Group " + (WString)(j/10) + "/Item " + (WString)j, [&clicks]() { clicks++; });
+
+			delete menu;
+		}
+
+		context.End();
+
+		o2Scene.Clear();
+	}
+
+	// Types characters into middle line of multiline edit box with 10000 lines of log. Each character is inserted
+	// like by keyboard typing: text is changed, edit box text and caret are updated
+	BENCHMARK("UI/EditBoxTyping10kLines", 100)
+	{
+		if (o2UI.GetWidgetStyles().IsEmpty() && o2Assets.IsAssetExist("ui_style.json"))
+			o2UI.LoadStyle("ui_style.json");
+
+		if (o2UI.GetWidgetStyles().IsEmpty())
+		{
+			context.Skip("UI style is empty");
+			return;
+		}
+
+		const int linesCount = 10000;
+
+		String log;
+		for (int i = 0; i < linesCount; i++)
+			log += String::Format("[%i] Log message with some details about event %i\n", i, i*7);
+
+		WString text = log;
+
+		EditBox* editBox = o2UI.CreateEditBox();
+		*editBox->layout = WidgetLayout::Based(BaseCorner::LeftTop, Vec2F(800, 600));
+		editBox->SetMultiLine(true);
+		editBox->SetText(text);
+		editBox->UpdateTransform();
+
+		int caret = text.Find(String::Format("[%i]", linesCount/2));
+		editBox->SetCaretPosition(caret);
+
+		context.Begin();
+
+		for (int i = 0; i < context.operations; i++)
+		{
+			text.Insert((char16_t)('a' + i%26), caret);
+			caret++;
+
+			editBox->SetText(text);
+			editBox->SetCaretPosition(caret);
+			editBox->Update(1.0f/60.0f);
+		}
+
+		context.End();
+
+		delete editBox;
+		o2Scene.Clear();
+	}
+}
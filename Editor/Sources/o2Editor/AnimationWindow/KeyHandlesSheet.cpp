@@ -116,6 +116,12 @@ namespace Editor
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool KeyHandlesSheet::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	void KeyHandlesSheet::RegTrackControl(ITrackControl* trackControl, const std::string& path)
 	{
 		mTrackControls.Add(trackControl);
@@ -51,6 +51,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Registers animation track track control
 		void RegTrackControl(ITrackControl* trackControl, const std::string& path);
 
@@ -262,6 +265,7 @@ CLASS_METHODS_META(Editor::KeyHandlesSheet)
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(void, UpdateInputDrawOrder);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(void, RegTrackControl, ITrackControl*, const std::string&);
 	PUBLIC_FUNCTION(void, UnregTrackControl, ITrackControl*);
 	PUBLIC_FUNCTION(void, UnregAllTrackControls);
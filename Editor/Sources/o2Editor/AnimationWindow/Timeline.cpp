@@ -420,6 +420,12 @@ namespace Editor
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool AnimationTimeline::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool AnimationTimeline::IsScrollable() const
 	{
 		return true;
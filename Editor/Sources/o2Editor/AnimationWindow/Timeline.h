@@ -91,6 +91,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns is listener scrollable
 		bool IsScrollable() const override;
 
@@ -272,6 +275,7 @@ CLASS_METHODS_META(Editor::AnimationTimeline)
 	PUBLIC_FUNCTION(HorizontalScrollBar*, GetScrollBar);
 	PUBLIC_FUNCTION(bool, IsSameTime, float, float, float);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(bool, IsScrollable);
 	PUBLIC_FUNCTION(bool, IsInputTransparent);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuCategory);
@@ -67,6 +67,12 @@ namespace Editor
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool AssetIcon::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool AssetIcon::IsInputTransparent() const
 	{
 		return false;
@@ -52,6 +52,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns true when input events can be handled by down listeners
 		bool IsInputTransparent() const override;
 
@@ -131,6 +134,7 @@ CLASS_METHODS_META(Editor::AssetIcon)
 	PUBLIC_FUNCTION(void, SetAssetName, const WString&);
 	PUBLIC_FUNCTION(WString, GetAssetName);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(bool, IsInputTransparent);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuCategory);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
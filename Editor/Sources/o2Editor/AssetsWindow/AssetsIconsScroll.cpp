@@ -167,6 +167,9 @@ namespace Editor
 		Focus();
 		DeselectAllAssets();
 
+		if (AssetsWindow::IsSingletonInitialzed())
+			o2EditorAssets.mThumbnailsCache.CancelRequests();
+
 		if (mCurrentPath != "")
 		{
 			FolderAssetRef ref(mCurrentPath);
@@ -180,19 +183,39 @@ namespace Editor
 
 	void AssetsIconsScrollArea::SortAssetInfos()
 	{
-		Map<const AssetInfo*, Pair<String, int>> sortingCache;
+		struct SortingKey
+		{
+			const AssetInfo* info;
+			const Type*      type;
+			int              typeSorting;
+			String           path;
+		};
+
+		// Sorting keys are calculated once per asset, comparator only reads them
+		Map<const Type*, int> typesSorting;
+		Vector<SortingKey> keys;
+		keys.Reserve(mAssetInfos.Count());
+
 		for (auto assetInfo : mAssetInfos)
 		{
-			sortingCache[assetInfo] = { assetInfo->path.ToLowerCase(),
-				assetInfo->meta->GetAssetType()->InvokeStatic<int>("GetEditorSorting") };
+			const Type* type = assetInfo->meta->GetAssetType();
+
+			if (!typesSorting.ContainsKey(type))
+				typesSorting.Add(type, type->InvokeStatic<int>("GetEditorSorting"));
+
+			SortingKey key = { assetInfo, type, typesSorting[type], assetInfo->path.ToLowerCase() };
+			keys.Add(key);
 		}
 
-		mAssetInfos.Sort([&](const AssetInfo* a, const AssetInfo* b) {
-			if (a->meta->GetAssetType() == b->meta->GetAssetType())
-				return sortingCache[a].first < sortingCache[b].first;
+		keys.Sort([](const SortingKey& a, const SortingKey& b) {
+			if (a.type == b.type)
+				return a.path < b.path;
 
-			return sortingCache[a].second > sortingCache[b].second;
+			return a.typeSorting > b.typeSorting;
 		});
+
+		for (int i = 0; i < keys.Count(); i++)
+			mAssetInfos[i] = keys[i].info;
 	}
 
 	bool AssetsIconsScrollArea::IsFocusable() const
@@ -398,28 +421,46 @@ namespace Editor
 		AssetInfo* asset = (AssetInfo*)item;
 		AssetIcon* assetIcon = dynamic_cast<AssetIcon*>(widget);
 
-		auto iconLayer = assetIcon->layer["icon"];
+		SetupAssetIconPreview(assetIcon, asset);
+
+		assetIcon->SetAssetInfo(asset);
+		assetIcon->SetState("halfHide", mCuttingAssets.Contains([&](auto x) { return x.first == asset->meta->ID(); }));
+		assetIcon->SetSelectionGroup(this);
+		assetIcon->SetSelected(mSelectedAssets.Contains(asset));
+		assetIcon->SetDragOnlySelected(true);
+		assetIcon->mOwner = this;
+	}
+
+	void AssetsIconsScrollArea::SetupAssetIconPreview(AssetIcon* icon, const AssetInfo* asset)
+	{
+		auto iconLayer = icon->layer["icon"];
 		auto iconSprite = dynamic_cast<Sprite*>(iconLayer->GetDrawable());
 
-		if (asset->meta->GetAssetType() == &TypeOf(ImageAsset))
+		TextureRef thumbnail;
+		Vec2I thumbnailSize;
+
+		// Image previews are loaded lazily by thumbnails cache, until then showing default image icon
+		bool isImage = asset->meta->GetAssetType() == &TypeOf(ImageAsset);
+		if (isImage && AssetsWindow::IsSingletonInitialzed() &&
+			o2EditorAssets.mThumbnailsCache.GetThumbnail(*asset, thumbnail, thumbnailSize))
 		{
-			ImageAssetRef previewSpriteAsset(asset->path);
 			float previewMaxSize = 30;
 
-			if (previewSpriteAsset->width > previewSpriteAsset->height)
+			if (thumbnailSize.x > thumbnailSize.y)
 			{
-				float cf = previewSpriteAsset->height / previewSpriteAsset->width;
+				float cf = (float)thumbnailSize.y/(float)thumbnailSize.x;
 				iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(previewMaxSize, previewMaxSize*cf),
 												  Vec2F(0, 10));
 			}
 			else
 			{
-				float cf = previewSpriteAsset->width / previewSpriteAsset->height;
+				float cf = (float)thumbnailSize.x/(float)thumbnailSize.y;
 				iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(previewMaxSize*cf, previewMaxSize),
 												  Vec2F(0, 10));
 			}
 
-			iconSprite->image = previewSpriteAsset;
+			iconSprite->SetTexture(thumbnail);
+			iconSprite->SetTextureSrcRect(RectI(Vec2I(), thumbnailSize));
 			iconSprite->mode = SpriteMode::Default;
 		}
 		else
@@ -427,13 +468,15 @@ namespace Editor
 			iconSprite->imageName = asset->meta->GetAssetType()->InvokeStatic<String>("GetEditorIcon");
 			iconLayer->layout = Layout::Based(BaseCorner::Center, Vec2F(40, 40), Vec2F(0, 10));
 		}
+	}
 
-		assetIcon->SetAssetInfo(asset);
-		assetIcon->SetState("halfHide", mCuttingAssets.Contains([&](auto x) { return x.first == asset->meta->ID(); }));
-		assetIcon->SetSelectionGroup(this);
-		assetIcon->SetSelected(mSelectedAssets.Contains(asset));
-		assetIcon->SetDragOnlySelected(true);
-		assetIcon->mOwner = this;
+	void AssetsIconsScrollArea::OnThumbnailsReady(const Vector<UID>& assetsIds)
+	{
+		for (auto icon : mVisibleAssetIcons)
+		{
+			if (assetsIds.Contains(icon->GetAssetInfo().meta->ID()))
+				SetupAssetIconPreview(icon, &icon->GetAssetInfo());
+		}
 	}
 
 	void AssetsIconsScrollArea::UpdateVisibleItems()
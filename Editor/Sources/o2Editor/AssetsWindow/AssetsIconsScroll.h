@@ -162,6 +162,12 @@ namespace Editor
 		// Sets item widget, calls setupItemFunc
 		void SetupItemWidget(Widget* widget, void* item) override;
 
+		// Sets icon preview sprite: image thumbnail when it is ready or asset type icon
+		void SetupAssetIconPreview(AssetIcon* icon, const AssetInfo* asset);
+
+		// It is called when thumbnails was generated, updates visible icons previews
+		void OnThumbnailsReady(const Vector<UID>& assetsIds);
+
 		// Updates visible items
 		void UpdateVisibleItems() override;
 
@@ -415,6 +421,8 @@ CLASS_METHODS_META(Editor::AssetsIconsScrollArea)
 	PROTECTED_FUNCTION(int, GetItemsCount);
 	PROTECTED_FUNCTION(Vector<void*>, GetItemsRange, int, int);
 	PROTECTED_FUNCTION(void, SetupItemWidget, Widget*, void*);
+	PROTECTED_FUNCTION(void, SetupAssetIconPreview, AssetIcon*, const AssetInfo*);
+	PROTECTED_FUNCTION(void, OnThumbnailsReady, const Vector<UID>&);
 	PROTECTED_FUNCTION(void, UpdateVisibleItems);
 	PROTECTED_FUNCTION(void, OnFocused);
 	PROTECTED_FUNCTION(void, OnUnfocused);
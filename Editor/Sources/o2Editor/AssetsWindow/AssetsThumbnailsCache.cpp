@@ -0,0 +1,273 @@
+#include "o2Editor/stdafx.h"
+#include "AssetsThumbnailsCache.h"
+
+#include "o2/Assets/Assets.h"
+#include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Bitmap/PngFormat.h"
+#include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/System/Time/Time.h"
+#include "o2/Utils/Types/Containers/Pair.h"
+
+namespace Editor
+{
+	AssetsThumbnailsCache::AssetsThumbnailsCache()
+	{}
+
+	AssetsThumbnailsCache::~AssetsThumbnailsCache()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStopWorker = true;
+		}
+
+		mRequestsCondition.notify_all();
+
+		if (mWorker.joinable())
+			mWorker.join();
+
+		for (auto& result : mResults)
+			delete result.bitmap;
+
+		for (auto& result : mUploadingResults)
+			delete result.bitmap;
+	}
+
+	bool AssetsThumbnailsCache::GetThumbnail(const AssetInfo& info, TextureRef& texture, Vec2I& size)
+	{
+		UID id = info.meta->ID();
+
+		auto fnd = mThumbnails.find(id);
+		if (fnd != mThumbnails.end())
+		{
+			fnd->second.lastUsedFrame = o2Time.GetCurrentFrame();
+			texture = fnd->second.texture;
+			size = fnd->second.size;
+			return true;
+		}
+
+		if (mPendingIds.Contains(id) || mFailedIds.Contains(id))
+			return false;
+
+		Request request;
+		request.id = id;
+		request.sourcePath = o2Assets.GetAssetsPath() + info.path;
+		request.cachePath = GetCachePath(info);
+
+		StartWorker();
+
+		mPendingIds.Add(id);
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mRequests.Add(request);
+
+			if (mRequests.Count() > mMaxRequestsQueue)
+			{
+				mPendingIds.Remove(mRequests[0].id);
+				mRequests.RemoveAt(0);
+			}
+		}
+
+		mRequestsCondition.notify_one();
+
+		return false;
+	}
+
+	void AssetsThumbnailsCache::CancelRequests()
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		for (auto& request : mRequests)
+			mPendingIds.Remove(request.id);
+
+		mRequests.Clear();
+	}
+
+	void AssetsThumbnailsCache::ReleaseThumbnails(const Vector<UID>& ids)
+	{
+		for (auto& id : ids)
+		{
+			mThumbnails.Remove(id);
+			mFailedIds.Remove(id);
+		}
+	}
+
+	Vector<UID> AssetsThumbnailsCache::Update()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mUploadingResults.Add(mResults);
+			mResults.Clear();
+		}
+
+		Vector<UID> readyThumbnails;
+		int currentFrame = o2Time.GetCurrentFrame();
+
+		int uploadsCount = Math::Min(mUploadingResults.Count(), mMaxTextureUploadsPerFrame);
+		for (int i = 0; i < uploadsCount; i++)
+		{
+			const Result& result = mUploadingResults[i];
+			mPendingIds.Remove(result.id);
+
+			if (!result.bitmap)
+			{
+				mFailedIds.Add(result.id);
+				continue;
+			}
+
+			Thumbnail thumbnail;
+			thumbnail.texture = TextureRef(result.bitmap);
+			thumbnail.size = result.bitmap->GetSize();
+			thumbnail.lastUsedFrame = currentFrame;
+			mThumbnails[result.id] = thumbnail;
+
+			delete result.bitmap;
+
+			readyThumbnails.Add(result.id);
+		}
+
+		mUploadingResults.RemoveRange(0, uploadsCount);
+
+		ReleaseUnusedThumbnails();
+
+		return readyThumbnails;
+	}
+
+	void AssetsThumbnailsCache::SetMaxCachedThumbnails(int count)
+	{
+		mMaxCachedThumbnails = count;
+	}
+
+	int AssetsThumbnailsCache::GetMaxCachedThumbnails() const
+	{
+		return mMaxCachedThumbnails;
+	}
+
+	void AssetsThumbnailsCache::StartWorker()
+	{
+		if (mWorker.joinable())
+			return;
+
+		o2FileSystem.FolderCreate(GetEditorThumbnailsCachePath());
+		mWorker = std::thread(&AssetsThumbnailsCache::ProcessRequests, this);
+	}
+
+	void AssetsThumbnailsCache::ProcessRequests()
+	{
+		while (true)
+		{
+			Request request;
+
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mRequestsCondition.wait(lock, [&]() { return mStopWorker || !mRequests.IsEmpty(); });
+
+				if (mStopWorker)
+					return;
+
+				request = mRequests.PopBack();
+			}
+
+			Result result;
+			result.id = request.id;
+			result.bitmap = GenerateThumbnail(request);
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mResults.Add(result);
+			}
+		}
+	}
+
+	Bitmap* AssetsThumbnailsCache::GenerateThumbnail(const Request& request) const
+	{
+		Bitmap* thumbnail = mnew Bitmap();
+		if (LoadPngImage(request.cachePath, thumbnail, false))
+			return thumbnail;
+
+		delete thumbnail;
+
+		Bitmap source;
+		if (!LoadPngImage(request.sourcePath, &source, false))
+			return nullptr;
+
+		thumbnail = DownscaleBitmap(source);
+		SavePngImage(request.cachePath, thumbnail, PngCompression::Fast);
+
+		return thumbnail;
+	}
+
+	Bitmap* AssetsThumbnailsCache::DownscaleBitmap(Bitmap& source) const
+	{
+		Vec2I sourceSize = source.GetSize();
+		float scale = Math::Min(1.0f, (float)mThumbnailMaxSize/(float)Math::Max(sourceSize.x, sourceSize.y));
+		Vec2I size(Math::Max(1, Math::RoundToInt(sourceSize.x*scale)), Math::Max(1, Math::RoundToInt(sourceSize.y*scale)));
+
+		const int bpp = source.GetFormat() == PixelFormat::R8G8B8A8 ? 4 : 3;
+
+		Bitmap* thumbnail = mnew Bitmap(source.GetFormat(), size);
+		UInt8* dst = thumbnail->GetData();
+		const UInt8* src = source.GetData();
+
+		// Box filter: each thumbnail pixel is average of source pixels block covered by it
+		for (int y = 0; y < size.y; y++)
+		{
+			int srcTop = y*sourceSize.y/size.y;
+			int srcBottom = Math::Max(srcTop + 1, (y + 1)*sourceSize.y/size.y);
+
+			for (int x = 0; x < size.x; x++)
+			{
+				int srcLeft = x*sourceSize.x/size.x;
+				int srcRight = Math::Max(srcLeft + 1, (x + 1)*sourceSize.x/size.x);
+
+				UInt sum[4] = { 0, 0, 0, 0 };
+				for (int sy = srcTop; sy < srcBottom; sy++)
+				{
+					const UInt8* srcPixel = src + (sy*sourceSize.x + srcLeft)*bpp;
+					for (int sx = srcLeft; sx < srcRight; sx++, srcPixel += bpp)
+					{
+						for (int c = 0; c < bpp; c++)
+							sum[c] += srcPixel[c];
+					}
+				}
+
+				UInt samples = (srcBottom - srcTop)*(srcRight - srcLeft);
+				UInt8* dstPixel = dst + (y*size.x + x)*bpp;
+				for (int c = 0; c < bpp; c++)
+					dstPixel[c] = (UInt8)(sum[c]/samples);
+			}
+		}
+
+		return thumbnail;
+	}
+
+	String AssetsThumbnailsCache::GetCachePath(const AssetInfo& info) const
+	{
+		const TimeStamp& time = info.editTime;
+		return String(GetEditorThumbnailsCachePath()) + (String)info.meta->ID().ToString() + "_" +
+			String(time.mYear*10000 + time.mMonth*100 + time.mDay) + "_" +
+			String(time.mHour*10000 + time.mMinute*100 + time.mSecond) + ".png";
+	}
+
+	void AssetsThumbnailsCache::ReleaseUnusedThumbnails()
+	{
+		int releaseCount = mThumbnails.Count() - mMaxCachedThumbnails;
+		if (releaseCount <= 0)
+			return;
+
+		Vector<Pair<int, UID>> thumbnailsUsage;
+		for (auto& kv : mThumbnails)
+			thumbnailsUsage.Add(Pair<int, UID>(kv.second.lastUsedFrame, kv.first));
+
+		thumbnailsUsage.Sort([](const Pair<int, UID>& a, const Pair<int, UID>& b) { return a.first < b.first; });
+
+		int currentFrame = o2Time.GetCurrentFrame();
+		for (int i = 0; i < releaseCount; i++)
+		{
+			if (thumbnailsUsage[i].first == currentFrame)
+				break;
+
+			mThumbnails.Remove(thumbnailsUsage[i].second);
+		}
+	}
+}
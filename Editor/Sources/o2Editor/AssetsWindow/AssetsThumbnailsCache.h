@@ -0,0 +1,121 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "o2/Assets/AssetInfo.h"
+#include "o2/Render/TextureRef.h"
+#include "o2/Utils/Types/Containers/Map.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+using namespace o2;
+
+namespace o2
+{
+	class Bitmap;
+}
+
+namespace Editor
+{
+	// ------------------------------------------------------------------------------------------
+	// Assets thumbnails cache. Generates image assets previews on worker thread, stores them on
+	// disk and keeps limited count of recently used thumbnails textures in memory
+	// ------------------------------------------------------------------------------------------
+	class AssetsThumbnailsCache
+	{
+	public:
+		// Default constructor
+		AssetsThumbnailsCache();
+
+		// Destructor. Stops worker thread
+		~AssetsThumbnailsCache();
+
+		// Returns thumbnail texture and it's size if it is ready, otherwise requests generation and returns false
+		bool GetThumbnail(const AssetInfo& info, TextureRef& texture, Vec2I& size);
+
+		// Removes all not started requests, used when viewing folder changes
+		void CancelRequests();
+
+		// Releases thumbnails of changed assets, they will be regenerated on next request
+		void ReleaseThumbnails(const Vector<UID>& ids);
+
+		// Uploads generated thumbnails into textures and releases unused ones. Returns ids of ready thumbnails
+		Vector<UID> Update();
+
+		// Sets maximum count of thumbnails textures kept in memory
+		void SetMaxCachedThumbnails(int count);
+
+		// Returns maximum count of thumbnails textures kept in memory
+		int GetMaxCachedThumbnails() const;
+
+	protected:
+		// ----------------------------
+		// Thumbnail generation request
+		// ----------------------------
+		struct Request
+		{
+			UID    id;         // Asset id
+			String sourcePath; // Source image path
+			String cachePath;  // Cached thumbnail path
+		};
+
+		// ---------------------------
+		// Thumbnail generation result
+		// ---------------------------
+		struct Result
+		{
+			UID     id;               // Asset id
+			Bitmap* bitmap = nullptr; // Generated thumbnail bitmap, null when generation failed
+		};
+
+		// -----------------------------
+		// Thumbnail texture cache entry
+		// -----------------------------
+		struct Thumbnail
+		{
+			TextureRef texture;           // Thumbnail texture
+			Vec2I      size;              // Thumbnail size
+			int        lastUsedFrame = 0; // Last frame when thumbnail was requested
+		};
+
+	protected:
+		const int mThumbnailMaxSize = 64;         // Maximum thumbnail width or height in pixels
+		const int mMaxRequestsQueue = 256;        // Maximum not started requests, oldest are dropped
+		const int mMaxTextureUploadsPerFrame = 8; // Maximum textures created from thumbnails in one frame
+
+		int mMaxCachedThumbnails = 512; // Maximum count of thumbnails textures kept in memory
+
+		Map<UID, Thumbnail> mThumbnails;       // Ready thumbnails textures
+		Vector<UID>         mPendingIds;       // Requested and not completed thumbnails ids
+		Vector<UID>         mFailedIds;        // Thumbnails that can't be generated
+		Vector<Result>      mUploadingResults; // Generated thumbnails waiting texture upload
+
+		std::thread             mWorker;             // Thumbnails generation thread
+		std::mutex              mMutex;              // Requests and results access mutex
+		std::condition_variable mRequestsCondition;  // Signals worker about new requests
+		bool                    mStopWorker = false; // Worker stopping flag. Guarded by mMutex
+
+		Vector<Request> mRequests; // Requests queue, latest are processed first. Guarded by mMutex
+		Vector<Result>  mResults;  // Completed results. Guarded by mMutex
+
+	protected:
+		// Starts worker thread if it isn't started yet
+		void StartWorker();
+
+		// Worker thread function
+		void ProcessRequests();
+
+		// Loads cached thumbnail or generates it from source image and saves into cache
+		Bitmap* GenerateThumbnail(const Request& request) const;
+
+		// Returns downscaled copy of bitmap fitting into mThumbnailMaxSize
+		Bitmap* DownscaleBitmap(Bitmap& source) const;
+
+		// Returns thumbnail cache file path for asset
+		String GetCachePath(const AssetInfo& info) const;
+
+		// Releases least recently used thumbnails when cache limit is exceeded
+		void ReleaseUnusedThumbnails();
+	};
+}
@@ -184,6 +184,10 @@ namespace Editor
 	{
 		IEditorWindow::Update(dt);
 		mFoldersTreeShowAnim.Update(dt);
+
+		auto readyThumbnails = mThumbnailsCache.Update();
+		if (!readyThumbnails.IsEmpty())
+			mAssetsGridScroll->OnThumbnailsReady(readyThumbnails);
 	}
 
 	void AssetsWindow::SelectAsset(const UID& id)
@@ -429,6 +433,8 @@ namespace Editor
 
 	void AssetsWindow::OnAssetsRebuilt(const Vector<UID>& changedAssets)
 	{
+		mThumbnailsCache.ReleaseThumbnails(changedAssets);
+
 		mFoldersTree->UpdateView();
 		mFoldersTree->SelectAndExpandFolder(mAssetsGridScroll->GetViewingPath());
 
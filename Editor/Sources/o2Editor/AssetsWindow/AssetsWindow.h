@@ -4,6 +4,7 @@
 #include "o2/Events/CursorEventsArea.h"
 #include "o2/Utils/Singleton.h"
 #include "o2/Utils/Types/Containers/Pair.h"
+#include "o2Editor/AssetsWindow/AssetsThumbnailsCache.h"
 #include "o2Editor/Core/WindowsSystem/IEditorWindow.h"
 
 using namespace o2;
@@ -123,6 +124,8 @@ namespace Editor
 
 		Vector<Pair<UID, String>> mCuttingAssets; // Current cutted assets
 
+		AssetsThumbnailsCache mThumbnailsCache; // Image assets thumbnails cache, used by assets icons @IGNORE
+
 	protected:
 		// Initializes window
 		void InitializeWindow();
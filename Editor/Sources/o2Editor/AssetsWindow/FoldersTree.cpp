@@ -92,6 +92,7 @@ namespace Editor
 
 	void AssetsFoldersTree::UpdateView()
 	{
+		mFoldersChildrenCache.Clear();
 		mFoldersTree->UpdateNodesView();
 	}
 
@@ -129,24 +130,21 @@ namespace Editor
 
 	Vector<void*> AssetsFoldersTree::GetFoldersTreeNodeChilds(void* object)
 	{
+		// Folders contain a lot of files, so filtered and sorted children are cached until assets rebuild
+		auto fnd = mFoldersChildrenCache.find(object);
+		if (fnd != mFoldersChildrenCache.end())
+			return fnd->second;
+
 		AssetInfo* assetTreeNode = (AssetInfo*)object;
+		const Vector<AssetInfo*>& children = assetTreeNode ? assetTreeNode->children : o2Assets.GetAssetsTree().rootAssets;
 
-		if (assetTreeNode)
-		{
-			return assetTreeNode->children
-				.FindAll([](AssetInfo* x) { return x->meta->GetAssetType() == &TypeOf(FolderAsset); })
-				.Sorted([](AssetInfo* a, AssetInfo* b) { return a->path < b->path; })
-				.Convert<void*>([](AssetInfo* x) { return (void*)x; });
-		}
-		else
-		{
-			const AssetsTree& assetsTree = o2Assets.GetAssetsTree();
+		Vector<void*> folders = children
+			.FindAll([](AssetInfo* x) { return x->meta->GetAssetType() == &TypeOf(FolderAsset); })
+			.Sorted([](AssetInfo* a, AssetInfo* b) { return a->path < b->path; })
+			.Convert<void*>([](AssetInfo* x) { return (void*)x; });
 
-			return assetsTree.rootAssets
-				.FindAll([](AssetInfo* x) { return x->meta->GetAssetType() == &TypeOf(FolderAsset); })
-				.Sorted([](AssetInfo* a, AssetInfo* b) { return a->path < b->path; })
-				.Convert<void*>([](AssetInfo* x) { return (void*)x; });
-		}
+		mFoldersChildrenCache.Add(object, folders);
+		return folders;
 	}
 
 	void AssetsFoldersTree::SetupFoldersTreeNode(TreeNode* node, void* object)
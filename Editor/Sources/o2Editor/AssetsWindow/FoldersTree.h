@@ -45,6 +45,8 @@ namespace Editor
 
 		bool mOpengingFolderFromThis = false;
 
+		Map<void*, Vector<void*>> mFoldersChildrenCache; // Sorted folders children by parent folder info, reset on rebuild @IGNORE
+
 	protected:
 		// Copies data of actor from other to this
 		void CopyData(const Actor& otherActor) override;
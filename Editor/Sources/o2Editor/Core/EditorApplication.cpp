@@ -251,12 +251,18 @@ namespace Editor
 		mUIRoot->Update(dt);
 		mToolsPanel->Update(dt);
 
+		auto& statistics = o2UI.GetLastFrameStatistics();
 		o2Application.windowCaption = String("o2 Editor. FPS: ") + (String)((int)o2Time.GetFPS()) +
 			" DC: " + (String)mDrawCalls +
+			" Layouts: " + (String)statistics.updatedLayouts + "/" + (String)statistics.skippedLayouts +
+			"/" + (String)statistics.arrangedLayouts +
 			" Cursor: " + (String)o2Input.GetCursorPos();
 
 		if (o2Input.IsKeyPressed('K'))
 			o2Memory.DumpInfo();
+
+		if (o2Input.IsKeyPressed(VK_F8))
+			o2Debug.SetRenderStatsOverlayEnabled(!o2Debug.IsRenderStatsOverlayEnabled());
 	}
 
 #undef DrawText
@@ -279,6 +285,19 @@ namespace Editor
 			for (int i = 0; i < mActions.Count(); i++)
 				o2Debug.DrawText(Vec2F(0, (float)(20 * i)), (String)i + mActions[i]->GetName());
 		}
+
+		// Debug draw widgets render cache statistics
+		if (o2Input.IsKeyDown(VK_F7))
+		{
+			auto& statistics = o2UI.GetLastFrameStatistics();
+			int cacheDraws = statistics.renderCacheHits + statistics.renderCacheRedraws + statistics.renderCacheDirectDraws;
+			int hitRate = cacheDraws > 0 ? statistics.renderCacheHits*100/cacheDraws : 0;
+
+			o2Debug.DrawText(Vec2F(0, 0), "Render cache hits: " + (String)statistics.renderCacheHits + " (" + (String)hitRate + "%)");
+			o2Debug.DrawText(Vec2F(0, 20), "Render cache redraws: " + (String)statistics.renderCacheRedraws);
+			o2Debug.DrawText(Vec2F(0, 40), "Render cache direct draws: " + (String)statistics.renderCacheDirectDraws);
+			o2Debug.DrawText(Vec2F(0, 60), "Render cache saved draw calls: " + (String)statistics.renderCacheSavedDrawCalls);
+		}
 	}
 
 	void EditorApplication::OnActivated()
@@ -99,6 +99,9 @@ namespace Editor
 		// On View/Game pressed in menu
 		void OnShowGamePressed();
 
+		// On View/Profiler pressed in menu
+		void OnShowProfilerPressed();
+
 		// On View/Reset layout pressed in menu
 		void OnResetLayoutPressed();
 
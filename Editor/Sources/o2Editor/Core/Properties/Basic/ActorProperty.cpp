@@ -68,6 +68,15 @@ namespace Editor
 		return mBox->IsUnderPoint(point);
 	}
 
+	bool ActorProperty::GetCursorAreaBounds(RectF& bounds) const
+	{
+		if (!mBox)
+			return false;
+
+		bounds = mBox->GetCursorEventsBounds();
+		return true;
+	}
+
 	void ActorProperty::RevertoToPrototype(IAbstractValueProxy* target, IAbstractValueProxy* source,
 										   IObject* targetOwner)
 	{
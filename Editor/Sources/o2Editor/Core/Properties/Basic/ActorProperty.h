@@ -38,6 +38,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns edit box cursor area bounds
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		IOBJECT(ActorProperty);
 
 	protected:
@@ -119,6 +122,7 @@ CLASS_METHODS_META(Editor::ActorProperty)
 
 	PUBLIC_FUNCTION(void, Revert);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
 	PROTECTED_FUNCTION(void, InitializeControls);
 	PROTECTED_FUNCTION(bool, IsValueRevertable);
@@ -321,6 +321,15 @@ namespace Editor
 		return mBox->IsUnderPoint(point) && mBox->transparency > 0.1f;
 	}
 
+	bool AssetProperty::GetCursorAreaBounds(RectF& bounds) const
+	{
+		if (!mBox)
+			return false;
+
+		bounds = mBox->GetCursorEventsBounds();
+		return true;
+	}
+
 	void AssetProperty::OnDragExit(ISelectableDragableObjectsGroup* group)
 	{
 		o2Application.SetCursor(CursorType::Arrow);
@@ -51,6 +51,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns edit box cursor area bounds
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		IOBJECT(AssetProperty);
 
 	protected:
@@ -158,6 +161,7 @@ CLASS_METHODS_META(Editor::AssetProperty)
 	PUBLIC_FUNCTION(WString, GetCaption);
 	PUBLIC_FUNCTION(Button*, GetRemoveButton);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
 	PROTECTED_FUNCTION(void, InitializeControls);
 	PROTECTED_FUNCTION(void, SetCommonAssetId, const UID&);
@@ -84,6 +84,15 @@ namespace Editor
 		return mBox->IsUnderPoint(point);
 	}
 
+	bool ComponentProperty::GetCursorAreaBounds(RectF& bounds) const
+	{
+		if (!mBox)
+			return false;
+
+		bounds = mBox->GetCursorEventsBounds();
+		return true;
+	}
+
 	bool ComponentProperty::IsValueRevertable() const
 	{
 		for (auto ptr : mValuesProxies)
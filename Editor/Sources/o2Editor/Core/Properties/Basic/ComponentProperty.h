@@ -44,6 +44,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns edit box cursor area bounds
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		IOBJECT(ComponentProperty);
 
 	protected:
@@ -130,6 +133,7 @@ CLASS_METHODS_META(Editor::ComponentProperty)
 	PUBLIC_FUNCTION(void, SpecializeType, const Type*);
 	PUBLIC_FUNCTION(const Type*, GetSpecializedType);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
 	PROTECTED_FUNCTION(bool, IsValueRevertable);
 	PROTECTED_FUNCTION(void, UpdateValueView);
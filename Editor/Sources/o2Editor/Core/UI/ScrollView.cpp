@@ -87,6 +87,12 @@ namespace Editor
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool ScrollView::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool ScrollView::IsScrollable() const
 	{
 		return true;
@@ -69,6 +69,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns is listener scrollable
 		bool IsScrollable() const override;
 
@@ -198,6 +201,7 @@ CLASS_METHODS_META(Editor::ScrollView)
 	PUBLIC_FUNCTION(void, SetGridColor, const Color4&);
 	PUBLIC_FUNCTION(void, UpdateSelfTransform);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(bool, IsScrollable);
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuCategory);
@@ -72,6 +72,12 @@ namespace Editor
 		return layout->GetWorldRect().IsInside(point);
 	}
 
+	bool DockWindowPlace::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	void DockWindowPlace::SetResizibleDir(TwoDirection dir, float border,
 											DockWindowPlace* neighborMin, DockWindowPlace* neighborMax)
 	{
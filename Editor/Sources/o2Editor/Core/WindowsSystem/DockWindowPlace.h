@@ -49,6 +49,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Updates layout
 		void UpdateSelfTransform() override;
 
@@ -119,6 +122,7 @@ CLASS_METHODS_META(Editor::DockWindowPlace)
 	PUBLIC_FUNCTION(void, ArrangeChildWindows);
 	PUBLIC_FUNCTION(void, SetActiveTab, DockableWindow*);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(void, UpdateSelfTransform);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuCategory);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
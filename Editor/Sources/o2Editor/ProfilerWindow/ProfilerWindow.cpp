@@ -0,0 +1,376 @@
+#include "o2Editor/stdafx.h"
+#include "ProfilerWindow.h"
+
+#include "o2/Application/Input.h"
+#include "o2/Render/Render.h"
+#include "o2/Render/Sprite.h"
+#include "o2/Render/Text.h"
+#include "o2/Scene/UI/UIManager.h"
+#include "o2/Scene/UI/WidgetLayer.h"
+#include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Scene/UI/Widgets/Button.h"
+#include "o2/Scene/UI/Widgets/HorizontalLayout.h"
+#include "o2/Scene/UI/Widgets/Label.h"
+#include "o2/Scene/UI/Widgets/Toggle.h"
+
+namespace Editor
+{
+	ProfilerWindow::ProfilerWindow():
+		IEditorWindow()
+	{
+		InitializeWindow();
+	}
+
+	ProfilerWindow::ProfilerWindow(const ProfilerWindow& other):
+		IEditorWindow(other)
+	{
+		InitializeWindow();
+	}
+
+	ProfilerWindow::~ProfilerWindow()
+	{}
+
+	void ProfilerWindow::Update(float dt)
+	{
+		if (mPaused || !IsVisible())
+			return;
+
+		int lastFrame = o2Profiler.GetFramesCount() - 2;
+		if (lastFrame >= 0 && mTimeline->Capture(lastFrame))
+			UpdateFrameInfo();
+	}
+
+	void ProfilerWindow::InitializeWindow()
+	{
+		mWindow->caption = "Profiler";
+		mWindow->name = "profiler window";
+		mWindow->SetIcon(mnew Sprite("ui/UI4_log_wnd_icon.png"));
+		mWindow->SetIconLayout(Layout::Based(BaseCorner::LeftTop, Vec2F(20, 20), Vec2F(-1, 1)));
+		mWindow->SetViewLayout(Layout::BothStretch(-2, 0, 0, 18));
+		mWindow->SetClippingLayout(Layout::BothStretch(-1, 0, 0, 18));
+
+		mTimeline = mnew TimelineView();
+		*mTimeline->layout = WidgetLayout::BothStretch(0, 0, 0, 20);
+		mWindow->AddChild(mTimeline);
+
+		Widget* upPanel = mnew Widget();
+		*upPanel->layout = WidgetLayout::HorStretch(VerAlign::Top, 0, 0, 20);
+		upPanel->AddLayer("back", mnew Sprite("ui/UI4_small_panel_back.png"), Layout::BothStretch(-4, -4, -5, -5));
+		mWindow->AddChild(upPanel);
+
+		HorizontalLayout* controlsPanel = mnew HorizontalLayout();
+		*controlsPanel->layout = WidgetLayout::Based(BaseCorner::LeftTop, Vec2F(60.0f, 20.0f));
+		controlsPanel->expandWidth = false;
+		upPanel->AddChild(controlsPanel);
+
+		auto previousButton = o2UI.CreateWidget<Button>("menu move left");
+		previousButton->onClick = THIS_FUNC(OnPreviousFramePressed);
+		controlsPanel->AddChild(previousButton);
+
+		mPauseToggle = o2UI.CreateWidget<Toggle>("menu play-stop");
+		mPauseToggle->SetValue(true);
+		mPauseToggle->onToggleByUser = [&](bool value) { OnPauseToggled(!value); };
+		controlsPanel->AddChild(mPauseToggle);
+
+		auto nextButton = o2UI.CreateWidget<Button>("menu move right");
+		nextButton->onClick = THIS_FUNC(OnNextFramePressed);
+		controlsPanel->AddChild(nextButton);
+
+		auto saveButton = o2UI.CreateWidget<Button>("panel down");
+		saveButton->caption = "Save trace";
+		*saveButton->layout = WidgetLayout::Based(BaseCorner::RightTop, Vec2F(100.0f, 20.0f));
+		saveButton->onClick = THIS_FUNC(OnSaveTracePressed);
+		upPanel->AddChild(saveButton);
+
+		mFrameInfoLabel = o2UI.CreateLabel("");
+		mFrameInfoLabel->horAlign = HorAlign::Left;
+		*mFrameInfoLabel->layout = WidgetLayout::BothStretch(70, 0, 105, 0);
+		upPanel->AddChild(mFrameInfoLabel);
+	}
+
+	void ProfilerWindow::OnPauseToggled(bool value)
+	{
+		mPaused = value;
+		mPauseToggle->SetValue(!value);
+	}
+
+	void ProfilerWindow::OnPreviousFramePressed()
+	{
+		OnPauseToggled(true);
+
+		if (mTimeline->Capture(mTimeline->GetFrame() - 1))
+			UpdateFrameInfo();
+	}
+
+	void ProfilerWindow::OnNextFramePressed()
+	{
+		OnPauseToggled(true);
+
+		if (mTimeline->GetFrame() < o2Profiler.GetFramesCount() - 2 && mTimeline->Capture(mTimeline->GetFrame() + 1))
+			UpdateFrameInfo();
+	}
+
+	void ProfilerWindow::OnSaveTracePressed()
+	{
+		String path = "profiler_trace.json";
+
+		if (o2Profiler.SaveChromeTrace(path))
+			o2Debug.Log("Profiler trace saved to " + path);
+		else
+			o2Debug.LogError("Failed to save profiler trace to " + path);
+	}
+
+	void ProfilerWindow::UpdateFrameInfo()
+	{
+		mFrameInfoLabel->text = "Frame " + (String)mTimeline->GetFrame() +
+			": " + (String)mTimeline->GetFrameDuration() + " ms" +
+			"  Draw calls: " + (String)(int)mTimeline->GetCounterValue("Draw calls") +
+			"  Triangles: " + (String)(int)mTimeline->GetCounterValue("Triangles");
+	}
+
+	ProfilerWindow::TimelineView::TimelineView():
+		Widget()
+	{
+		AddLayer("back", mnew Sprite("ui/UI4_dopesheet_back.png"), Layout::BothStretch(-3, -3, -3, -3))->transparency = 0.5f;
+
+		mRectsMesh = mnew Mesh(TextureRef(), mMaxBatchRects*4, mMaxBatchRects*2);
+
+		mText = mnew Text("stdFont.ttf");
+		mText->horAlign = HorAlign::Left;
+		mText->verAlign = VerAlign::Middle;
+		mText->height = 8;
+		mText->color = Color4(44, 62, 80);
+	}
+
+	ProfilerWindow::TimelineView::TimelineView(const TimelineView& other):
+		Widget(other), mFrame(other.mFrame), mFrameBegin(other.mFrameBegin), mFrameEnd(other.mFrameEnd),
+		mThreads(other.mThreads)
+	{
+		mRectsMesh = mnew Mesh(TextureRef(), mMaxBatchRects*4, mMaxBatchRects*2);
+		mText = mnew Text(*other.mText);
+	}
+
+	ProfilerWindow::TimelineView::~TimelineView()
+	{
+		delete mRectsMesh;
+		delete mText;
+	}
+
+	ProfilerWindow::TimelineView& ProfilerWindow::TimelineView::operator=(const TimelineView& other)
+	{
+		Widget::operator=(other);
+
+		mFrame = other.mFrame;
+		mFrameBegin = other.mFrameBegin;
+		mFrameEnd = other.mFrameEnd;
+		mThreads = other.mThreads;
+		*mText = *other.mText;
+
+		return *this;
+	}
+
+	void ProfilerWindow::TimelineView::Draw()
+	{
+		Widget::Draw();
+
+		if (mFrameEnd <= mFrameBegin)
+			return;
+
+		RectF worldRect = layout->GetWorldRect();
+		o2Render.EnableScissorTest(worldRect);
+
+		double pixelsPerTick = (double)worldRect.Width()/(double)(mFrameEnd - mFrameBegin);
+		Vec2F cursor = o2Input.GetCursorPos();
+		bool cursorInside = worldRect.IsInside(cursor);
+
+		const Profiler::Event* hoveredEvent = nullptr;
+		float top = worldRect.top;
+
+		// Zones rectangles are batched first, captions are drawn over them
+		for (auto& thread : mThreads)
+		{
+			top -= mRowHeight;
+
+			for (auto& event : thread.events)
+			{
+				if (event.depth < 0)
+					continue;
+
+				float left = worldRect.left + (float)(((double)event.begin - (double)mFrameBegin)*pixelsPerTick);
+				float right = worldRect.left + (float)(((double)event.end - (double)mFrameBegin)*pixelsPerTick);
+				right = Math::Max(right, left + 1.0f);
+
+				float rowTop = top - mRowHeight*event.depth;
+				RectF rect(Math::Max(left, worldRect.left), rowTop, Math::Min(right, worldRect.right), rowTop - mRowHeight + 1.0f);
+
+				if (rect.right < worldRect.left || rect.left > worldRect.right)
+					continue;
+
+				AddRect(rect, GetZoneColor(event.name));
+
+				if (cursorInside && rect.IsInside(cursor))
+					hoveredEvent = &event;
+			}
+
+			top -= mRowHeight*(thread.maxDepth + 1) + mThreadSpacing;
+		}
+
+		FlushRects();
+
+		top = worldRect.top;
+		for (auto& thread : mThreads)
+		{
+			mText->SetText(thread.name);
+			mText->SetPosition(Vec2F(worldRect.left + 5.0f, top - mRowHeight*0.5f));
+			mText->Draw();
+
+			top -= mRowHeight;
+
+			for (auto& event : thread.events)
+			{
+				if (event.depth < 0)
+					continue;
+
+				float left = worldRect.left + (float)(((double)event.begin - (double)mFrameBegin)*pixelsPerTick);
+				float right = worldRect.left + (float)(((double)event.end - (double)mFrameBegin)*pixelsPerTick);
+				left = Math::Max(left, worldRect.left);
+				right = Math::Min(right, worldRect.right);
+
+				if (right - left < mMinCaptionWidth)
+					continue;
+
+				mText->SetText(event.name);
+				mText->SetPosition(Vec2F(left + 3.0f, top - mRowHeight*event.depth - mRowHeight*0.5f));
+				mText->Draw();
+			}
+
+			top -= mRowHeight*(thread.maxDepth + 1) + mThreadSpacing;
+		}
+
+		if (hoveredEvent)
+		{
+			double duration = Profiler::TicksToMilliseconds(hoveredEvent->end - hoveredEvent->begin);
+			mText->SetText((String)hoveredEvent->name + ": " + (String)duration + " ms");
+			mText->SetPosition(cursor + Vec2F(12.0f, -8.0f));
+
+			RectF textRect = mText->GetRealRect();
+			AddRect(RectF(textRect.left - 3.0f, textRect.top + 3.0f, textRect.right + 3.0f, textRect.bottom - 3.0f),
+					Color4(235, 235, 235));
+			FlushRects();
+
+			mText->Draw();
+		}
+
+		o2Render.DisableScissorTest();
+	}
+
+	bool ProfilerWindow::TimelineView::Capture(int frame)
+	{
+		UInt64 begin = o2Profiler.GetFrameBegin(frame);
+		UInt64 end = o2Profiler.GetFrameBegin(frame + 1);
+
+		if (begin == 0 || end == 0)
+			return false;
+
+		mFrame = frame;
+		mFrameBegin = begin;
+		mFrameEnd = end;
+
+		int threadsCount = o2Profiler.GetThreadsCount();
+		mThreads.Resize(threadsCount);
+
+		for (int i = 0; i < threadsCount; i++)
+		{
+			auto& thread = mThreads[i];
+			thread.name = o2Profiler.GetThreadName(i);
+			thread.events.Clear();
+			o2Profiler.GetEvents(i, begin, end, thread.events);
+
+			thread.maxDepth = 0;
+			for (auto& event : thread.events)
+				thread.maxDepth = Math::Max(thread.maxDepth, event.depth);
+		}
+
+		return true;
+	}
+
+	int ProfilerWindow::TimelineView::GetFrame() const
+	{
+		return mFrame;
+	}
+
+	float ProfilerWindow::TimelineView::GetFrameDuration() const
+	{
+		return (float)Profiler::TicksToMilliseconds(mFrameEnd - mFrameBegin);
+	}
+
+	float ProfilerWindow::TimelineView::GetCounterValue(const char* name) const
+	{
+		for (auto& thread : mThreads)
+		{
+			for (int i = thread.events.Count() - 1; i >= 0; i--)
+			{
+				auto& event = thread.events[i];
+				if (event.depth < 0 && strcmp(event.name, name) == 0)
+					return event.value;
+			}
+		}
+
+		return 0.0f;
+	}
+
+	String ProfilerWindow::TimelineView::GetCreateMenuCategory()
+	{
+		return "UI/Editor";
+	}
+
+	void ProfilerWindow::TimelineView::AddRect(const RectF& rect, const Color4& color)
+	{
+		if (mRectsMesh->vertexCount + 4 > mRectsMesh->GetMaxVertexCount())
+			FlushRects();
+
+		ULong dcolor = color.ABGR();
+		UInt16 vertex = (UInt16)mRectsMesh->vertexCount;
+		Vertex2* vertices = mRectsMesh->vertices + vertex;
+		UInt16* indexes = mRectsMesh->indexes + mRectsMesh->polyCount*3;
+
+		vertices[0] = Vertex2(rect.left, rect.top, dcolor, 0.0f, 0.0f);
+		vertices[1] = Vertex2(rect.right, rect.top, dcolor, 1.0f, 0.0f);
+		vertices[2] = Vertex2(rect.right, rect.bottom, dcolor, 1.0f, 1.0f);
+		vertices[3] = Vertex2(rect.left, rect.bottom, dcolor, 0.0f, 1.0f);
+
+		indexes[0] = vertex; indexes[1] = vertex + 1; indexes[2] = vertex + 2;
+		indexes[3] = vertex; indexes[4] = vertex + 2; indexes[5] = vertex + 3;
+
+		mRectsMesh->vertexCount += 4;
+		mRectsMesh->polyCount += 2;
+	}
+
+	void ProfilerWindow::TimelineView::FlushRects()
+	{
+		if (mRectsMesh->polyCount > 0)
+			mRectsMesh->Draw();
+
+		mRectsMesh->vertexCount = 0;
+		mRectsMesh->polyCount = 0;
+	}
+
+	Color4 ProfilerWindow::TimelineView::GetZoneColor(const char* name) const
+	{
+		static const Color4 palette[] = {
+			Color4(129, 199, 132), Color4(100, 181, 246), Color4(255, 183, 77), Color4(186, 104, 200),
+			Color4(77, 208, 225), Color4(240, 98, 146), Color4(174, 213, 129), Color4(255, 138, 101)
+		};
+
+		// Hash of characters, not of pointer, so same zones from different modules have same color
+		UInt hash = 0;
+		for (const char* c = name; *c; c++)
+			hash = hash*31 + (UInt)*c;
+
+		return palette[hash%8];
+	}
+}
+
+DECLARE_CLASS(Editor::ProfilerWindow);
+
+DECLARE_CLASS(Editor::ProfilerWindow::TimelineView);
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "o2/Render/Mesh.h"
+#include "o2/Scene/UI/Widget.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2Editor/Core/WindowsSystem/IEditorWindow.h"
+
+using namespace o2;
+
+namespace o2
+{
+	class Button;
+	class Label;
+	class Text;
+	class Toggle;
+}
+
+namespace Editor
+{
+	// -------------------------------------------------------------------------------------------
+	// Profiler window. Shows zones timeline of last or paused frame and exports Chrome trace JSON
+	// -------------------------------------------------------------------------------------------
+	class ProfilerWindow: public IEditorWindow
+	{
+	public:
+		// -----------------------------------------------------------------------------------
+		// Frame zones timeline. Each thread is drawn as rows of zones, one row for each depth
+		// -----------------------------------------------------------------------------------
+		class TimelineView: public Widget
+		{
+		public:
+			// -----------------------------------
+			// Captured frame events of one thread
+			// -----------------------------------
+			struct ThreadEvents
+			{
+				String                  name;         // Thread name
+				Vector<Profiler::Event> events;       // Zones and counters, intersecting frame
+				int                     maxDepth = 0; // Maximal zones depth
+			};
+
+		public:
+			// Default constructor
+			TimelineView();
+
+			// Copy-constructor
+			TimelineView(const TimelineView& other);
+
+			// Destructor
+			~TimelineView();
+
+			// Copy-operator
+			TimelineView& operator=(const TimelineView& other);
+
+			// Draws zones rectangles, captions and hovered zone info
+			void Draw() override;
+
+			// Captures events of frame from profiler. Returns false when frame isn't available anymore
+			bool Capture(int frame);
+
+			// Returns captured frame index
+			int GetFrame() const;
+
+			// Returns captured frame duration in milliseconds
+			float GetFrameDuration() const;
+
+			// Returns last value of counter in captured frame, or 0 if there is no one
+			float GetCounterValue(const char* name) const;
+
+			// Returns create menu category in editor
+			static String GetCreateMenuCategory();
+
+			SERIALIZABLE(TimelineView);
+
+		protected:
+			const float mRowHeight = 16.0f;       // Zone row height in pixels
+			const float mThreadSpacing = 8.0f;    // Spacing between threads zones
+			const float mMinCaptionWidth = 40.0f; // Minimal zone width in pixels to draw its caption
+			const int   mMaxBatchRects = 4096;    // Maximal rectangles in one mesh
+
+			int                  mFrame = -1;     // Captured frame index
+			UInt64               mFrameBegin = 0; // Captured frame beginning ticks
+			UInt64               mFrameEnd = 0;   // Captured frame ending ticks
+			Vector<ThreadEvents> mThreads;        // Captured threads events
+
+			Mesh* mRectsMesh = nullptr; // Zones rectangles batch
+			Text* mText = nullptr;      // Captions text, drawn for each caption
+
+		protected:
+			// Adds zone rectangle into batch, draws batch when it is full
+			void AddRect(const RectF& rect, const Color4& color);
+
+			// Draws and clears rectangles batch
+			void FlushRects();
+
+			// Returns zone color by name
+			Color4 GetZoneColor(const char* name) const;
+		};
+
+	public:
+		// Default constructor
+		ProfilerWindow();
+
+		// Copy-constructor
+		ProfilerWindow(const ProfilerWindow& other);
+
+		// Destructor
+		~ProfilerWindow();
+
+		// Updates window logic. Captures last frame when not paused
+		void Update(float dt) override;
+
+		IOBJECT(ProfilerWindow);
+
+	protected:
+		TimelineView* mTimeline = nullptr;       // Frame zones timeline
+		Toggle*       mPauseToggle = nullptr;    // Capturing pause toggle
+		Label*        mFrameInfoLabel = nullptr; // Captured frame info
+
+		bool mPaused = false; // Is capturing paused
+
+	protected:
+		// Initializes window
+		void InitializeWindow();
+
+		// It is called when pause toggled
+		void OnPauseToggled(bool value);
+
+		// It is called when previous frame button pressed, pauses and captures previous frame
+		void OnPreviousFramePressed();
+
+		// It is called when next frame button pressed, captures next frame
+		void OnNextFramePressed();
+
+		// It is called when save trace button pressed, saves Chrome trace JSON
+		void OnSaveTracePressed();
+
+		// Updates captured frame info label
+		void UpdateFrameInfo();
+	};
+}
+
+CLASS_BASES_META(Editor::ProfilerWindow)
+{
+	BASE_CLASS(Editor::IEditorWindow);
+}
+END_META;
+CLASS_FIELDS_META(Editor::ProfilerWindow)
+{
+	PROTECTED_FIELD(mTimeline).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mPauseToggle).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mFrameInfoLabel).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mPaused).DEFAULT_VALUE(false);
+}
+END_META;
+CLASS_METHODS_META(Editor::ProfilerWindow)
+{
+
+	PUBLIC_FUNCTION(void, Update, float);
+	PROTECTED_FUNCTION(void, InitializeWindow);
+	PROTECTED_FUNCTION(void, OnPauseToggled, bool);
+	PROTECTED_FUNCTION(void, OnPreviousFramePressed);
+	PROTECTED_FUNCTION(void, OnNextFramePressed);
+	PROTECTED_FUNCTION(void, OnSaveTracePressed);
+	PROTECTED_FUNCTION(void, UpdateFrameInfo);
+}
+END_META;
+
+CLASS_BASES_META(Editor::ProfilerWindow::TimelineView)
+{
+	BASE_CLASS(o2::Widget);
+}
+END_META;
+CLASS_FIELDS_META(Editor::ProfilerWindow::TimelineView)
+{
+	PROTECTED_FIELD(mRowHeight).DEFAULT_VALUE(16.0f);
+	PROTECTED_FIELD(mThreadSpacing).DEFAULT_VALUE(8.0f);
+	PROTECTED_FIELD(mMinCaptionWidth).DEFAULT_VALUE(40.0f);
+	PROTECTED_FIELD(mMaxBatchRects).DEFAULT_VALUE(4096);
+	PROTECTED_FIELD(mFrame).DEFAULT_VALUE(-1);
+	PROTECTED_FIELD(mFrameBegin).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mFrameEnd).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mThreads);
+	PROTECTED_FIELD(mRectsMesh).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mText).DEFAULT_VALUE(nullptr);
+}
+END_META;
+CLASS_METHODS_META(Editor::ProfilerWindow::TimelineView)
+{
+
+	PUBLIC_FUNCTION(void, Draw);
+	PUBLIC_FUNCTION(bool, Capture, int);
+	PUBLIC_FUNCTION(int, GetFrame);
+	PUBLIC_FUNCTION(float, GetFrameDuration);
+	PUBLIC_FUNCTION(float, GetCounterValue, const char*);
+	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuCategory);
+	PROTECTED_FUNCTION(void, AddRect, const RectF&, const Color4&);
+	PROTECTED_FUNCTION(void, FlushRects);
+	PROTECTED_FUNCTION(Color4, GetZoneColor, const char*);
+}
+END_META;
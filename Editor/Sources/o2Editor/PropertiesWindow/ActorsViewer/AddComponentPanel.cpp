@@ -56,6 +56,12 @@ namespace Editor
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool AddComponentPanel::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool AddComponentPanel::IsInputTransparent() const
 	{
 		return true;
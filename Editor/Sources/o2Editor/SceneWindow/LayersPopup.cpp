@@ -324,6 +324,12 @@ namespace Editor
 		return layout->IsPointInside(point);
 	}
 
+	bool LayerPopupItem::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	String LayerPopupItem::GetCreateMenuCategory()
 	{
 		return "UI/Editor";
@@ -116,6 +116,9 @@ namespace Editor
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns create menu category in editor
 		static String GetCreateMenuCategory();
 
@@ -225,6 +228,7 @@ CLASS_METHODS_META(Editor::LayerPopupItem)
 	PUBLIC_FUNCTION(void, BreakEditName);
 	PUBLIC_FUNCTION(void, Draw);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuCategory);
 	PRIVATE_FUNCTION(void, OnCursorDblClicked, const Input::Cursor&);
 	PRIVATE_FUNCTION(void, OnDragStart, const Input::Cursor&);
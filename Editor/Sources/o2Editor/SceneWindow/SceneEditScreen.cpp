@@ -158,8 +158,7 @@ namespace Editor
 			if (!layer->visible)
 				continue;
 
-			for (auto drw : layer->GetEnabledDrawables())
-				drw->Draw();
+			layer->Draw();
 		}
 
 		o2Scene.EndDrawingScene();
@@ -282,6 +281,12 @@ namespace Editor
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool SceneEditScreen::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	void SceneEditScreen::BindSceneTree()
 	{
 		mSceneTree = o2EditorWindows.GetWindow<TreeWindow>()->GetSceneTree();
@@ -29,10 +29,19 @@ b2BroadPhase::b2BroadPhase()
 	m_moveCapacity = 16;
 	m_moveCount = 0;
 	m_moveBuffer = (int32*)b2Alloc(m_moveCapacity * sizeof(int32));
+
+	m_threadPairBuffers = NULL;
+	m_threadPairBuffersCount = 0;
 }
 
 b2BroadPhase::~b2BroadPhase()
 {
+	for (int32 i = 0; i < m_threadPairBuffersCount; ++i)
+	{
+		b2Free(m_threadPairBuffers[i].pairs);
+	}
+	b2Free(m_threadPairBuffers);
+
 	b2Free(m_moveBuffer);
 	b2Free(m_pairBuffer);
 }
@@ -117,3 +126,110 @@ bool b2BroadPhase::QueryCallback(int32 proxyId)
 
 	return true;
 }
+
+void b2PairBuffer::Add(int32 proxyIdA, int32 proxyIdB)
+{
+	if (count == capacity)
+	{
+		b2Pair* oldPairs = pairs;
+		capacity *= 2;
+		pairs = (b2Pair*)b2Alloc(capacity * sizeof(b2Pair));
+		memcpy(pairs, oldPairs, count * sizeof(b2Pair));
+		b2Free(oldPairs);
+	}
+
+	pairs[count].proxyIdA = b2Min(proxyIdA, proxyIdB);
+	pairs[count].proxyIdB = b2Max(proxyIdA, proxyIdB);
+	++count;
+}
+
+// Tree query callback of one moving proxy, used in parallel pair finding.
+struct b2PairQueryCallback
+{
+	bool QueryCallback(int32 proxyId)
+	{
+		// A proxy cannot form a pair with itself.
+		if (proxyId != queryProxyId)
+		{
+			buffer->Add(proxyId, queryProxyId);
+		}
+
+		return true;
+	}
+
+	b2PairBuffer* buffer;
+	int32 queryProxyId;
+};
+
+// Queries the tree for a range of moving proxies. The tree isn't changing
+// while pairs are found, so queries are safe to run in parallel.
+void b2BroadPhase::QueryPairsTask(void* context, int32 index, int32 threadIndex)
+{
+	b2BroadPhase* broadPhase = (b2BroadPhase*)context;
+
+	b2PairQueryCallback callback;
+	callback.buffer = broadPhase->m_threadPairBuffers + threadIndex;
+
+	int32 begin = index * e_queriesPerTask;
+	int32 end = b2Min(begin + e_queriesPerTask, broadPhase->m_moveCount);
+	for (int32 i = begin; i < end; ++i)
+	{
+		callback.queryProxyId = broadPhase->m_moveBuffer[i];
+		if (callback.queryProxyId == e_nullProxy)
+		{
+			continue;
+		}
+
+		const b2AABB& fatAABB = broadPhase->m_tree.GetFatAABB(callback.queryProxyId);
+		broadPhase->m_tree.Query(&callback, fatAABB);
+	}
+}
+
+void b2BroadPhase::QueryPairs(b2TaskExecutor* executor)
+{
+	int32 threadsCount = executor->GetThreadsCount();
+	if (m_threadPairBuffersCount < threadsCount)
+	{
+		for (int32 i = 0; i < m_threadPairBuffersCount; ++i)
+		{
+			b2Free(m_threadPairBuffers[i].pairs);
+		}
+		b2Free(m_threadPairBuffers);
+
+		m_threadPairBuffersCount = threadsCount;
+		m_threadPairBuffers = (b2PairBuffer*)b2Alloc(threadsCount * sizeof(b2PairBuffer));
+		for (int32 i = 0; i < threadsCount; ++i)
+		{
+			m_threadPairBuffers[i].capacity = 16;
+			m_threadPairBuffers[i].pairs = (b2Pair*)b2Alloc(16 * sizeof(b2Pair));
+		}
+	}
+
+	for (int32 i = 0; i < threadsCount; ++i)
+	{
+		m_threadPairBuffers[i].count = 0;
+	}
+
+	int32 taskCount = (m_moveCount + e_queriesPerTask - 1) / e_queriesPerTask;
+	executor->Run(QueryPairsTask, this, taskCount);
+
+	// Gather pairs of all threads into the pair buffer.
+	int32 pairCount = 0;
+	for (int32 i = 0; i < threadsCount; ++i)
+	{
+		pairCount += m_threadPairBuffers[i].count;
+	}
+
+	if (pairCount > m_pairCapacity)
+	{
+		b2Free(m_pairBuffer);
+		m_pairCapacity = b2Max(pairCount, 2 * m_pairCapacity);
+		m_pairBuffer = (b2Pair*)b2Alloc(m_pairCapacity * sizeof(b2Pair));
+	}
+
+	for (int32 i = 0; i < threadsCount; ++i)
+	{
+		memcpy(m_pairBuffer + m_pairCount, m_threadPairBuffers[i].pairs, m_threadPairBuffers[i].count * sizeof(b2Pair));
+		m_pairCount += m_threadPairBuffers[i].count;
+	}
+}
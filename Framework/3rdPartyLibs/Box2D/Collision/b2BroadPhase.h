@@ -22,6 +22,7 @@
 #include <Box2D/Common/b2Settings.h>
 #include <Box2D/Collision/b2Collision.h>
 #include <Box2D/Collision/b2DynamicTree.h>
+#include <Box2D/Common/b2TaskExecutor.h>
 #include <algorithm>
 
 struct b2Pair
@@ -30,6 +31,17 @@ struct b2Pair
 	int32 proxyIdB;
 };
 
+/// Pairs gathered by one thread when pairs are found in parallel.
+struct b2PairBuffer
+{
+	/// Add a pair, growing the buffer as needed.
+	void Add(int32 proxyIdA, int32 proxyIdB);
+
+	b2Pair* pairs;
+	int32 count;
+	int32 capacity;
+};
+
 /// The broad-phase is used for computing pairs and performing volume queries and ray casts.
 /// This broad-phase does not persist pairs. Instead, this reports potentially new pairs.
 /// It is up to the client to consume the new pairs and to track subsequent overlap.
@@ -39,7 +51,8 @@ public:
 
 	enum
 	{
-		e_nullProxy = -1
+		e_nullProxy = -1,
+		e_queriesPerTask = 64
 	};
 
 	b2BroadPhase();
@@ -72,8 +85,9 @@ public:
 	int32 GetProxyCount() const;
 
 	/// Update the pairs. This results in pair callbacks. This can only add pairs.
+	/// Tree queries are performed in parallel when the executor is provided.
 	template <typename T>
-	void UpdatePairs(T* callback);
+	void UpdatePairs(T* callback, b2TaskExecutor* executor = NULL);
 
 	/// Query an AABB for overlapping proxies. The callback class
 	/// is called for each proxy that overlaps the supplied AABB.
@@ -113,6 +127,9 @@ private:
 
 	bool QueryCallback(int32 proxyId);
 
+	void QueryPairs(b2TaskExecutor* executor);
+	static void QueryPairsTask(void* context, int32 index, int32 threadIndex);
+
 	b2DynamicTree m_tree;
 
 	int32 m_proxyCount;
@@ -125,6 +142,9 @@ private:
 	int32 m_pairCapacity;
 	int32 m_pairCount;
 
+	b2PairBuffer* m_threadPairBuffers;
+	int32 m_threadPairBuffersCount;
+
 	int32 m_queryProxyId;
 };
 
@@ -182,26 +202,34 @@ inline float32 b2BroadPhase::GetTreeQuality() const
 }
 
 template <typename T>
-void b2BroadPhase::UpdatePairs(T* callback)
+void b2BroadPhase::UpdatePairs(T* callback, b2TaskExecutor* executor)
 {
 	// Reset pair buffer
 	m_pairCount = 0;
 
-	// Perform tree queries for all moving proxies.
-	for (int32 i = 0; i < m_moveCount; ++i)
+	if (executor != NULL && executor->GetThreadsCount() > 1 && m_moveCount > e_queriesPerTask)
 	{
-		m_queryProxyId = m_moveBuffer[i];
-		if (m_queryProxyId == e_nullProxy)
+		// Pairs are sorted below, so the result doesn't depend on threads.
+		QueryPairs(executor);
+	}
+	else
+	{
+		// Perform tree queries for all moving proxies.
+		for (int32 i = 0; i < m_moveCount; ++i)
 		{
-			continue;
-		}
+			m_queryProxyId = m_moveBuffer[i];
+			if (m_queryProxyId == e_nullProxy)
+			{
+				continue;
+			}
 
-		// We have to query the tree with the fat AABB so that
-		// we don't fail to create a pair that may touch later.
-		const b2AABB& fatAABB = m_tree.GetFatAABB(m_queryProxyId);
+			// We have to query the tree with the fat AABB so that
+			// we don't fail to create a pair that may touch later.
+			const b2AABB& fatAABB = m_tree.GetFatAABB(m_queryProxyId);
 
-		// Query tree, create pairs and add them pair buffer.
-		m_tree.Query(this, fatAABB);
+			// Query tree, create pairs and add them pair buffer.
+			m_tree.Query(this, fatAABB);
+		}
 	}
 
 	// Reset move buffer
@@ -0,0 +1,26 @@
+#ifndef B2_TASK_EXECUTOR_H
+#define B2_TASK_EXECUTOR_H
+
+#include <Box2D/Common/b2Settings.h>
+
+/// Task function. Index is the task index in range [0, count), threadIndex is
+/// the index of the thread executing the task in range [0, GetThreadsCount()).
+typedef void (*b2Task)(void* context, int32 index, int32 threadIndex);
+
+/// Implement this class to run island solving and broad-phase pair finding on
+/// several threads. Tasks are independent and don't depend on execution order,
+/// so simulation results are deterministic.
+/// See b2World::SetTaskExecutor
+class b2TaskExecutor
+{
+public:
+	virtual ~b2TaskExecutor() {}
+
+	/// Get the number of threads executing tasks, including the calling thread.
+	virtual int32 GetThreadsCount() const = 0;
+
+	/// Call task for each index in range [0, count). Must return when all tasks are finished.
+	virtual void Run(b2Task task, void* context, int32 count) = 0;
+};
+
+#endif
@@ -31,6 +31,7 @@ b2ContactManager::b2ContactManager()
 	m_contactCount = 0;
 	m_contactFilter = &b2_defaultFilter;
 	m_contactListener = &b2_defaultListener;
+	m_taskExecutor = NULL;
 	m_allocator = NULL;
 }
 
@@ -171,7 +172,7 @@ void b2ContactManager::Collide()
 
 void b2ContactManager::FindNewContacts()
 {
-	m_broadPhase.UpdatePairs(this);
+	m_broadPhase.UpdatePairs(this, m_taskExecutor);
 }
 
 void b2ContactManager::AddPair(void* proxyUserDataA, void* proxyUserDataB)
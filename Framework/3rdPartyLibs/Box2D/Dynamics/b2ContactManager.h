@@ -25,6 +25,7 @@ class b2Contact;
 class b2ContactFilter;
 class b2ContactListener;
 class b2BlockAllocator;
+class b2TaskExecutor;
 
 // Delegate of b2World.
 class b2ContactManager
@@ -46,6 +47,7 @@ public:
 	int32 m_contactCount;
 	b2ContactFilter* m_contactFilter;
 	b2ContactListener* m_contactListener;
+	b2TaskExecutor* m_taskExecutor;
 	b2BlockAllocator* m_allocator;
 };
 
@@ -150,31 +150,36 @@ b2Island::b2Island(
 	int32 contactCapacity,
 	int32 jointCapacity,
 	b2StackAllocator* allocator,
-	b2ContactListener* listener)
+	b2ContactListener* listener,
+	int32 staticCapacity)
 {
 	m_bodyCapacity = bodyCapacity;
 	m_contactCapacity = contactCapacity;
 	m_jointCapacity	 = jointCapacity;
+	m_staticCapacity = staticCapacity;
 	m_bodyCount = 0;
 	m_contactCount = 0;
 	m_jointCount = 0;
 
 	m_allocator = allocator;
 	m_listener = listener;
+	m_impulses = NULL;
 
 	m_bodies = (b2Body**)m_allocator->Allocate(bodyCapacity * sizeof(b2Body*));
 	m_contacts = (b2Contact**)m_allocator->Allocate(contactCapacity	 * sizeof(b2Contact*));
 	m_joints = (b2Joint**)m_allocator->Allocate(jointCapacity * sizeof(b2Joint*));
 
-	m_velocities = (b2Velocity*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Velocity));
-	m_positions = (b2Position*)m_allocator->Allocate(m_bodyCapacity * sizeof(b2Position));
+	// Static bodies state is placed before island bodies state.
+	int32 stateCapacity = m_staticCapacity + m_bodyCapacity;
+	m_velocities = (b2Velocity*)m_allocator->Allocate(stateCapacity * sizeof(b2Velocity)) + m_staticCapacity;
+	m_positions = (b2Position*)m_allocator->Allocate(stateCapacity * sizeof(b2Position)) + m_staticCapacity;
 }
 
 b2Island::~b2Island()
 {
 	// Warning: the order should reverse the constructor order.
-	m_allocator->Free(m_positions);
-	m_allocator->Free(m_velocities);
+	m_allocator->Free(m_positions - m_staticCapacity);
+	m_allocator->Free(m_velocities - m_staticCapacity);
 	m_allocator->Free(m_joints);
 	m_allocator->Free(m_contacts);
 	m_allocator->Free(m_bodies);
@@ -223,6 +228,22 @@ void b2Island::Solve(b2Profile* profile, const b2TimeStep& step, const b2Vec2& g
 		m_velocities[i].w = w;
 	}
 
+	// Initialize the state of static bodies, which aren't in the island.
+	if (m_staticCapacity > 0)
+	{
+		for (int32 i = 0; i < m_contactCount; ++i)
+		{
+			InitStaticState(m_contacts[i]->GetFixtureA()->GetBody());
+			InitStaticState(m_contacts[i]->GetFixtureB()->GetBody());
+		}
+
+		for (int32 i = 0; i < m_jointCount; ++i)
+		{
+			InitStaticState(m_joints[i]->GetBodyA());
+			InitStaticState(m_joints[i]->GetBodyB());
+		}
+	}
+
 	timer.Reset();
 
 	// Solver data
@@ -513,9 +534,22 @@ void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiInd
 	Report(contactSolver.m_velocityConstraints);
 }
 
+void b2Island::InitStaticState(b2Body* body)
+{
+	int32 index = body->m_islandIndex;
+	if (index < 0)
+	{
+		b2Assert(index >= -m_staticCapacity);
+		m_positions[index].c = body->m_sweep.c;
+		m_positions[index].a = body->m_sweep.a;
+		m_velocities[index].v = body->m_linearVelocity;
+		m_velocities[index].w = body->m_angularVelocity;
+	}
+}
+
 void b2Island::Report(const b2ContactVelocityConstraint* constraints)
 {
-	if (m_listener == NULL)
+	if (m_listener == NULL && m_impulses == NULL)
 	{
 		return;
 	}
@@ -534,6 +568,12 @@ void b2Island::Report(const b2ContactVelocityConstraint* constraints)
 			impulse.tangentImpulses[j] = vc->points[j].tangentImpulse;
 		}
 
+		if (m_impulses != NULL)
+		{
+			m_impulses[i] = impulse;
+			continue;
+		}
+
 		m_listener->PostSolve(c, &impulse);
 	}
 }
@@ -27,15 +27,19 @@ class b2Contact;
 class b2Joint;
 class b2StackAllocator;
 class b2ContactListener;
+struct b2ContactImpulse;
 struct b2ContactVelocityConstraint;
 struct b2Profile;
 
 /// This is an internal class.
+/// When islands are solved in parallel, static bodies aren't added to islands. They have
+/// negative island indices in range [-staticCapacity, -1], their state is stored before
+/// the state of island bodies.
 class b2Island
 {
 public:
 	b2Island(int32 bodyCapacity, int32 contactCapacity, int32 jointCapacity,
-			b2StackAllocator* allocator, b2ContactListener* listener);
+			b2StackAllocator* allocator, b2ContactListener* listener, int32 staticCapacity = 0);
 	~b2Island();
 
 	void Clear()
@@ -71,9 +75,15 @@ public:
 
 	void Report(const b2ContactVelocityConstraint* constraints);
 
+	void InitStaticState(b2Body* body);
+
 	b2StackAllocator* m_allocator;
 	b2ContactListener* m_listener;
 
+	// Reported impulses are stored here instead of calling the listener, when
+	// islands are solved in parallel.
+	b2ContactImpulse* m_impulses;
+
 	b2Body** m_bodies;
 	b2Contact** m_contacts;
 	b2Joint** m_joints;
@@ -88,6 +98,7 @@ public:
 	int32 m_bodyCapacity;
 	int32 m_contactCapacity;
 	int32 m_jointCapacity;
+	int32 m_staticCapacity;
 };
 
 #endif
@@ -60,6 +60,9 @@ b2World::b2World(const b2Vec2& gravity)
 
 	m_contactManager.m_allocator = &m_blockAllocator;
 
+	m_threadAllocators = NULL;
+	m_threadAllocatorsCount = 0;
+
 	memset(&m_profile, 0, sizeof(b2Profile));
 }
 
@@ -82,6 +85,8 @@ b2World::~b2World()
 
 		b = bNext;
 	}
+
+	ResizeThreadAllocators(0);
 }
 
 void b2World::SetDestructionListener(b2DestructionListener* listener)
@@ -99,6 +104,11 @@ void b2World::SetContactListener(b2ContactListener* listener)
 	m_contactManager.m_contactListener = listener;
 }
 
+void b2World::SetTaskExecutor(b2TaskExecutor* executor)
+{
+	m_contactManager.m_taskExecutor = executor;
+}
+
 void b2World::SetDebugDraw(b2Draw* debugDraw)
 {
 	m_debugDraw = debugDraw;
@@ -389,6 +399,44 @@ void b2World::Solve(const b2TimeStep& step)
 	m_profile.solveVelocity = 0.0f;
 	m_profile.solvePosition = 0.0f;
 
+	b2TaskExecutor* executor = m_contactManager.m_taskExecutor;
+	if (executor != NULL && executor->GetThreadsCount() > 1)
+	{
+		SolveIslandsParallel(step);
+	}
+	else
+	{
+		SolveIslands(step);
+	}
+
+	{
+		b2Timer timer;
+		// Synchronize fixtures, check for out of range bodies.
+		for (b2Body* b = m_bodyList; b; b = b->GetNext())
+		{
+			// If a body was not in an island then it did not move.
+			if ((b->m_flags & b2Body::e_islandFlag) == 0)
+			{
+				continue;
+			}
+
+			if (b->GetType() == b2_staticBody)
+			{
+				continue;
+			}
+
+			// Update fixtures (for broad-phase).
+			b->SynchronizeFixtures();
+		}
+
+		// Look for new contacts.
+		m_contactManager.FindNewContacts();
+		m_profile.broadphase = timer.GetMilliseconds();
+	}
+}
+
+void b2World::SolveIslands(const b2TimeStep& step)
+{
 	// Size the island for the worst case.
 	b2Island island(m_bodyCount,
 					m_contactManager.m_contactCount,
@@ -546,30 +594,310 @@ void b2World::Solve(const b2TimeStep& step)
 	}
 
 	m_stackAllocator.Free(stack);
+}
+
+// Range of an island in bodies, contacts and joints arrays.
+struct b2IslandRange
+{
+	int32 bodyStart;
+	int32 bodyCount;
+	int32 contactStart;
+	int32 contactCount;
+	int32 jointStart;
+	int32 jointCount;
+	b2Profile profile;
+};
 
+// Islands solving task context.
+struct b2SolveIslandsContext
+{
+	b2TimeStep step;
+	b2Vec2 gravity;
+	bool allowSleep;
+	b2Body** bodies;
+	b2Contact** contacts;
+	b2Joint** joints;
+	b2IslandRange* islands;
+	int32 staticCount;
+	b2ContactImpulse* impulses;
+	b2StackAllocator* allocators;
+};
+
+static void b2SolveIslandTask(void* userData, int32 index, int32 threadIndex)
+{
+	b2SolveIslandsContext* context = (b2SolveIslandsContext*)userData;
+	b2IslandRange* range = context->islands + index;
+
+	b2Island island(range->bodyCount,
+					range->contactCount,
+					range->jointCount,
+					context->allocators + threadIndex,
+					NULL,
+					context->staticCount);
+
+	if (context->impulses != NULL)
 	{
-		b2Timer timer;
-		// Synchronize fixtures, check for out of range bodies.
-		for (b2Body* b = m_bodyList; b; b = b->GetNext())
+		island.m_impulses = context->impulses + range->contactStart;
+	}
+
+	for (int32 i = 0; i < range->bodyCount; ++i)
+	{
+		island.Add(context->bodies[range->bodyStart + i]);
+	}
+	for (int32 i = 0; i < range->contactCount; ++i)
+	{
+		island.Add(context->contacts[range->contactStart + i]);
+	}
+	for (int32 i = 0; i < range->jointCount; ++i)
+	{
+		island.Add(context->joints[range->jointStart + i]);
+	}
+
+	island.Solve(&range->profile, context->step, context->gravity, context->allowSleep);
+}
+
+// Islands are built on the calling thread in the same order as in SolveIslands
+// and solved in parallel. Static bodies are shared between islands, so they
+// aren't added to islands and get negative island indices instead. Islands only
+// read static bodies.
+void b2World::SolveIslandsParallel(const b2TimeStep& step)
+{
+	b2TaskExecutor* executor = m_contactManager.m_taskExecutor;
+	b2ContactListener* listener = m_contactManager.m_contactListener;
+
+	ResizeThreadAllocators(executor->GetThreadsCount());
+
+	// Clear all the island flags.
+	for (b2Body* b = m_bodyList; b; b = b->m_next)
+	{
+		b->m_flags &= ~b2Body::e_islandFlag;
+	}
+	for (b2Contact* c = m_contactManager.m_contactList; c; c = c->m_next)
+	{
+		c->m_flags &= ~b2Contact::e_islandFlag;
+	}
+	for (b2Joint* j = m_jointList; j; j = j->m_next)
+	{
+		j->m_islandFlag = false;
+	}
+
+	b2SolveIslandsContext context;
+	context.step = step;
+	context.gravity = m_gravity;
+	context.allowSleep = m_allowSleep;
+	context.allocators = m_threadAllocators;
+	context.bodies = (b2Body**)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2Body*));
+	context.contacts = (b2Contact**)m_stackAllocator.Allocate(m_contactManager.m_contactCount * sizeof(b2Contact*));
+	context.joints = (b2Joint**)m_stackAllocator.Allocate(m_jointCount * sizeof(b2Joint*));
+	context.islands = (b2IslandRange*)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2IslandRange));
+	context.staticCount = 0;
+
+	b2Body** statics = (b2Body**)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2Body*));
+	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2Body*));
+
+	int32 bodyCount = 0;
+	int32 contactCount = 0;
+	int32 jointCount = 0;
+	int32 islandCount = 0;
+
+	// Build all awake islands.
+	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
+	{
+		if (seed->m_flags & b2Body::e_islandFlag)
 		{
-			// If a body was not in an island then it did not move.
-			if ((b->m_flags & b2Body::e_islandFlag) == 0)
+			continue;
+		}
+
+		if (seed->IsAwake() == false || seed->IsActive() == false)
+		{
+			continue;
+		}
+
+		// The seed can be dynamic or kinematic.
+		if (seed->GetType() == b2_staticBody)
+		{
+			continue;
+		}
+
+		b2IslandRange* island = context.islands + islandCount++;
+		island->bodyStart = bodyCount;
+		island->contactStart = contactCount;
+		island->jointStart = jointCount;
+
+		int32 stackCount = 0;
+		stack[stackCount++] = seed;
+		seed->m_flags |= b2Body::e_islandFlag;
+
+		// Perform a depth first search (DFS) on the constraint graph. Static
+		// bodies are never pushed to the stack, they don't propagate islands.
+		while (stackCount > 0)
+		{
+			b2Body* b = stack[--stackCount];
+			b2Assert(b->IsActive() == true);
+			context.bodies[bodyCount++] = b;
+
+			// Make sure the body is awake.
+			b->SetAwake(true);
+
+			// Search all contacts connected to this body.
+			for (b2ContactEdge* ce = b->m_contactList; ce; ce = ce->next)
 			{
-				continue;
+				b2Contact* contact = ce->contact;
+
+				// Has this contact already been added to an island?
+				if (contact->m_flags & b2Contact::e_islandFlag)
+				{
+					continue;
+				}
+
+				// Is this contact solid and touching?
+				if (contact->IsEnabled() == false ||
+					contact->IsTouching() == false)
+				{
+					continue;
+				}
+
+				// Skip sensors.
+				bool sensorA = contact->m_fixtureA->m_isSensor;
+				bool sensorB = contact->m_fixtureB->m_isSensor;
+				if (sensorA || sensorB)
+				{
+					continue;
+				}
+
+				context.contacts[contactCount++] = contact;
+				contact->m_flags |= b2Contact::e_islandFlag;
+
+				b2Body* other = ce->other;
+
+				// Was the other body already added to this island or got static index?
+				if (other->m_flags & b2Body::e_islandFlag)
+				{
+					continue;
+				}
+
+				other->m_flags |= b2Body::e_islandFlag;
+
+				if (other->GetType() == b2_staticBody)
+				{
+					statics[context.staticCount++] = other;
+					other->m_islandIndex = -context.staticCount;
+					continue;
+				}
+
+				stack[stackCount++] = other;
 			}
 
-			if (b->GetType() == b2_staticBody)
+			// Search all joints connect to this body.
+			for (b2JointEdge* je = b->m_jointList; je; je = je->next)
 			{
-				continue;
+				if (je->joint->m_islandFlag == true)
+				{
+					continue;
+				}
+
+				b2Body* other = je->other;
+
+				// Don't simulate joints connected to inactive bodies.
+				if (other->IsActive() == false)
+				{
+					continue;
+				}
+
+				context.joints[jointCount++] = je->joint;
+				je->joint->m_islandFlag = true;
+
+				if (other->m_flags & b2Body::e_islandFlag)
+				{
+					continue;
+				}
+
+				other->m_flags |= b2Body::e_islandFlag;
+
+				if (other->GetType() == b2_staticBody)
+				{
+					statics[context.staticCount++] = other;
+					other->m_islandIndex = -context.staticCount;
+					continue;
+				}
+
+				stack[stackCount++] = other;
 			}
+		}
 
-			// Update fixtures (for broad-phase).
-			b->SynchronizeFixtures();
+		island->bodyCount = bodyCount - island->bodyStart;
+		island->contactCount = contactCount - island->contactStart;
+		island->jointCount = jointCount - island->jointStart;
+	}
+
+	// Impulses are reported after all islands are solved.
+	context.impulses = NULL;
+	if (listener != NULL)
+	{
+		context.impulses = (b2ContactImpulse*)m_stackAllocator.Allocate(contactCount * sizeof(b2ContactImpulse));
+	}
+
+	executor->Run(b2SolveIslandTask, &context, islandCount);
+
+	for (int32 i = 0; i < islandCount; ++i)
+	{
+		const b2IslandRange* island = context.islands + i;
+		m_profile.solveInit += island->profile.solveInit;
+		m_profile.solveVelocity += island->profile.solveVelocity;
+		m_profile.solvePosition += island->profile.solvePosition;
+
+		if (context.impulses != NULL)
+		{
+			int32 contactEnd = island->contactStart + island->contactCount;
+			for (int32 j = island->contactStart; j < contactEnd; ++j)
+			{
+				listener->PostSolve(context.contacts[j], context.impulses + j);
+			}
 		}
+	}
 
-		// Look for new contacts.
-		m_contactManager.FindNewContacts();
-		m_profile.broadphase = timer.GetMilliseconds();
+	// Post solve cleanup. Allow static bodies to participate in other islands.
+	for (int32 i = 0; i < context.staticCount; ++i)
+	{
+		statics[i]->m_flags &= ~b2Body::e_islandFlag;
+	}
+
+	if (context.impulses != NULL)
+	{
+		m_stackAllocator.Free(context.impulses);
+	}
+
+	m_stackAllocator.Free(stack);
+	m_stackAllocator.Free(statics);
+	m_stackAllocator.Free(context.islands);
+	m_stackAllocator.Free(context.joints);
+	m_stackAllocator.Free(context.contacts);
+	m_stackAllocator.Free(context.bodies);
+}
+
+void b2World::ResizeThreadAllocators(int32 count)
+{
+	if (m_threadAllocatorsCount == count)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < m_threadAllocatorsCount; ++i)
+	{
+		m_threadAllocators[i].~b2StackAllocator();
+	}
+	b2Free(m_threadAllocators);
+
+	m_threadAllocators = NULL;
+	m_threadAllocatorsCount = count;
+
+	if (count > 0)
+	{
+		m_threadAllocators = (b2StackAllocator*)b2Alloc(count * sizeof(b2StackAllocator));
+		for (int32 i = 0; i < count; ++i)
+		{
+			new (m_threadAllocators + i) b2StackAllocator();
+		}
 	}
 }
 
@@ -61,6 +61,12 @@ public:
 	/// remain in scope.
 	void SetContactListener(b2ContactListener* listener);
 
+	/// Register a task executor to solve islands and find new contacts on several
+	/// threads. Results are the same as without the executor, except post solve
+	/// callbacks are called after all islands are solved. The executor is owned
+	/// by you and must remain in scope. Pass NULL to solve on the calling thread.
+	void SetTaskExecutor(b2TaskExecutor* executor);
+
 	/// Register a routine for debug drawing. The debug draw functions are called
 	/// inside with b2World::DrawDebugData method. The debug draw object is owned
 	/// by you and must remain in scope.
@@ -225,14 +231,22 @@ private:
 	friend class b2Controller;
 
 	void Solve(const b2TimeStep& step);
+	void SolveIslands(const b2TimeStep& step);
+	void SolveIslandsParallel(const b2TimeStep& step);
 	void SolveTOI(const b2TimeStep& step);
 
+	void ResizeThreadAllocators(int32 count);
+
 	void DrawJoint(b2Joint* joint);
 	void DrawShape(b2Fixture* shape, const b2Transform& xf, const b2Color& color);
 
 	b2BlockAllocator m_blockAllocator;
 	b2StackAllocator m_stackAllocator;
 
+	// Stack allocators of threads, solving islands in parallel.
+	b2StackAllocator* m_threadAllocators;
+	int32 m_threadAllocatorsCount;
+
 	int32 m_flags;
 
 	b2ContactManager m_contactManager;
@@ -0,0 +1,117 @@
+#include "o2/stdafx.h"
+#include "AnimationLODSystem.h"
+
+#include "o2/Scene/CameraActor.h"
+#include "o2/Scene/Components/AnimationComponent.h"
+
+namespace o2
+{
+	DECLARE_SINGLETON(AnimationLODSystem);
+
+	AnimationLODSystem::AnimationLODSystem()
+	{}
+
+	void AnimationLODSystem::SetTracksBudget(int tracks)
+	{
+		mTracksBudget = Math::Max(tracks, 0);
+	}
+
+	int AnimationLODSystem::GetTracksBudget() const
+	{
+		return mTracksBudget;
+	}
+
+	int AnimationLODSystem::GetEvaluatedTracksCount() const
+	{
+		return mEvaluatedTracks;
+	}
+
+	void AnimationLODSystem::BeginFrame(const Vector<CameraActor*>& cameras)
+	{
+		mEvaluatedTracks = 0;
+		mCamerasRects.Clear();
+
+		for (auto camera : cameras)
+		{
+			if (camera->IsEnabledInHierarchy())
+				mCamerasRects.Add(camera->GetRenderCamera().GetAxisAlignedRect());
+		}
+	}
+
+	float AnimationLODSystem::GetScreenPart(const RectF& bounds) const
+	{
+		if (mCamerasRects.IsEmpty())
+			return 1.0f;
+
+		float res = 0.0f;
+		for (auto& cameraRect : mCamerasRects)
+		{
+			if (!cameraRect.IsIntersects(bounds))
+				continue;
+
+			float widthPart = Math::Abs(bounds.Width())/Math::Max(Math::Abs(cameraRect.Width()), FLT_EPSILON);
+			float heightPart = Math::Abs(bounds.Height())/Math::Max(Math::Abs(cameraRect.Height()), FLT_EPSILON);
+
+			// Visible bounds are never considered as invisible, even when they are points
+			res = Math::Max(res, Math::Clamp(Math::Max(widthPart, heightPart), FLT_EPSILON, 1.0f));
+		}
+
+		return res;
+	}
+
+	bool AnimationLODSystem::TrySpendBudget(int tracks)
+	{
+		if (mTracksBudget > 0 && mEvaluatedTracks + tracks > mTracksBudget)
+			return false;
+
+		mEvaluatedTracks += tracks;
+		return true;
+	}
+
+	void AnimationLODSystem::SpendBudget(int tracks)
+	{
+		mEvaluatedTracks += tracks;
+	}
+
+	void AnimationLODSystem::ScheduleUpdate(AnimationComponent* component)
+	{
+		if (component->mLODUpdateScheduled)
+			return;
+
+		mScheduledComponents.Add(component);
+		component->mLODUpdateScheduled = true;
+	}
+
+	void AnimationLODSystem::CancelUpdate(AnimationComponent* component)
+	{
+		if (!component->mLODUpdateScheduled)
+			return;
+
+		mScheduledComponents.Remove(component);
+		component->mLODUpdateScheduled = false;
+	}
+
+	void AnimationLODSystem::UpdateScheduled()
+	{
+		if (mScheduledComponents.IsEmpty())
+			return;
+
+		// Components, delayed by budget, keep counting skipped frames and move to the beginning
+		std::stable_sort(mScheduledComponents.begin(), mScheduledComponents.end(),
+						 [](AnimationComponent* a, AnimationComponent* b) { return a->mLODSkippedFrames > b->mLODSkippedFrames; });
+
+		auto scheduled = mScheduledComponents;
+		mScheduledComponents.Clear();
+
+		for (auto component : scheduled)
+		{
+			component->mLODUpdateScheduled = false;
+
+			if (!TrySpendBudget(component->GetEvaluatingTracksCount()))
+				continue;
+
+			component->mLODSkippedFrames = 0;
+			component->UpdateAnimation();
+		}
+	}
+}
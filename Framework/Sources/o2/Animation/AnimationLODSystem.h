@@ -0,0 +1,69 @@
+#pragma once
+
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+// Animation LOD system access macros
+#define o2AnimationLOD o2::AnimationLODSystem::Instance()
+
+namespace o2
+{
+	class AnimationComponent;
+	class CameraActor;
+
+	// ------------------------------------------------------------------------------------------------
+	// Animation level of detail system. Collects scene cameras rectangles for checking animated actors
+	// visibility and limits count of tracks evaluated per frame by animations with reduced update rate.
+	// Reduced rate updates are scheduled during actors update and evaluated after it, longest waiting
+	// first, so components aren't starved by ones updated earlier in the scene
+	// ------------------------------------------------------------------------------------------------
+	class AnimationLODSystem: public Singleton<AnimationLODSystem>
+	{
+	public:
+		// Sets max count of tracks evaluated by reduced rate animations per frame. 0 means unlimited
+		void SetTracksBudget(int tracks);
+
+		// Returns max count of tracks evaluated by reduced rate animations per frame
+		int GetTracksBudget() const;
+
+		// Returns count of tracks evaluated in current frame
+		int GetEvaluatedTracksCount() const;
+
+		// Updates cameras rectangles and resets frame budget. It is called by scene before updating actors
+		void BeginFrame(const Vector<CameraActor*>& cameras);
+
+		// Returns biggest part of camera rectangle occupied by bounds in range 0...1. Returns 0 when bounds
+		// isn't visible by any camera and 1 when there are no cameras
+		float GetScreenPart(const RectF& bounds) const;
+
+		// Spends tracks from budget. Returns false and spends nothing when budget is exceeded
+		bool TrySpendBudget(int tracks);
+
+		// Spends tracks from budget without checking, used by animations with full update rate
+		void SpendBudget(int tracks);
+
+		// Schedules reduced rate update of component, it will be updated in UpdateScheduled() if budget allows
+		void ScheduleUpdate(AnimationComponent* component);
+
+		// Removes component from scheduled updates
+		void CancelUpdate(AnimationComponent* component);
+
+		// Updates scheduled components within budget, longest waiting first. Not updated components are
+		// scheduled again on next frames with bigger waiting time. It is called by scene after updating actors
+		void UpdateScheduled();
+
+	protected:
+		Vector<RectF> mCamerasRects;        // World rectangles of scene cameras
+		int           mTracksBudget = 0;    // Max count of tracks evaluated by reduced rate animations per frame. 0 means unlimited
+		int           mEvaluatedTracks = 0; // Count of tracks evaluated in current frame
+
+		Vector<AnimationComponent*> mScheduledComponents; // Components with scheduled reduced rate update
+
+	protected:
+		// Default constructor
+		AnimationLODSystem();
+
+		friend class Application;
+	};
+}
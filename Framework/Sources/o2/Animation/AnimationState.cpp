@@ -22,6 +22,17 @@ namespace o2
 		return mWeight;
 	}
 
+	void AnimationState::SetMask(const AnimationMask& mask)
+	{
+		this->mask = mask;
+		OnMaskChanged();
+	}
+
+	const AnimationMask& AnimationState::GetMask() const
+	{
+		return mask;
+	}
+
 	void AnimationState::SetAnimation(const AnimationAssetRef& animationAsset)
 	{
 		mAnimation = animationAsset;
@@ -38,6 +49,12 @@ namespace o2
 		player.SetClip(mAnimation ? &mAnimation->animation : nullptr);
 	}
 
+	void AnimationState::OnMaskChanged()
+	{
+		if (mOwner)
+			mOwner->InvalidateBindings();
+	}
+
 	void AnimationState::OnTrackPlayerAdded(IAnimationTrack::IPlayer* trackPlayer)
 	{
 		if (mOwner)
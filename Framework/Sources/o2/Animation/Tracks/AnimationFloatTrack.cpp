@@ -39,6 +39,26 @@ namespace o2
 		return curve.Evaluate(position, direction, cacheKey, cacheKeyApprox);
 	}
 
+	void AnimationTrack<float>::GetValues(const float* positions, float* results, int count) const
+	{
+		curve.Evaluate(positions, results, count);
+	}
+
+	void AnimationTrack<float>::Bake(int samplesCount /*= 256*/)
+	{
+		curve.Bake(samplesCount);
+	}
+
+	void AnimationTrack<float>::ResetBake()
+	{
+		curve.ResetBake();
+	}
+
+	bool AnimationTrack<float>::IsBaked() const
+	{
+		return curve.IsBaked();
+	}
+
 	void AnimationTrack<float>::BeginKeysBatchChange()
 	{
 		curve.BeginKeysBatchChange();
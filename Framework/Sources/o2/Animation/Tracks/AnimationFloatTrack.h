@@ -37,6 +37,18 @@ namespace o2
 		// Returns value at time
 		float GetValue(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
 
+		// Evaluates values at times array into results. Uses SIMD when curve is baked
+		void GetValues(const float* positions, float* results, int count) const;
+
+		// Bakes curve into uniformly sampled values table, see Curve::Bake
+		void Bake(int samplesCount = 256);
+
+		// Removes baked curve table
+		void ResetBake();
+
+		// Returns true when curve is baked
+		bool IsBaked() const;
+
 		// It is called when beginning keys batch change. After this call all keys modifications will not be update pproximation
 		// Used for optimizing many keys change
 		void BeginKeysBatchChange() override;
@@ -232,6 +244,10 @@ CLASS_METHODS_META(o2::AnimationTrack<float>)
 
 	PUBLIC_FUNCTION(float, GetValue, float);
 	PUBLIC_FUNCTION(float, GetValue, float, bool, int&, int&);
+	PUBLIC_FUNCTION(void, GetValues, const float*, float*, int);
+	PUBLIC_FUNCTION(void, Bake, int);
+	PUBLIC_FUNCTION(void, ResetBake);
+	PUBLIC_FUNCTION(bool, IsBaked);
 	PUBLIC_FUNCTION(void, BeginKeysBatchChange);
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(float, GetDuration);
@@ -40,6 +40,19 @@ namespace o2
 		// Returns value at time, with cached state
 		_type GetValue(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
 
+		// Evaluates values at times array into results. Times sorted in one direction are evaluated faster
+		void GetValues(const float* positions, _type* results, int count) const;
+
+		// Bakes transition curves into uniformly sampled tables with samplesCount segments between each keys pair.
+		// Evaluation uses baked tables until ResetBake() is called, they are rebaked when keys are changing
+		void Bake(int samplesCount = 32);
+
+		// Removes baked tables, evaluation uses keys approximation
+		void ResetBake();
+
+		// Returns true when track is baked
+		bool IsBaked() const;
+
 		// It is called when beginning keys batch change. After this call all keys modifications will not be update pproximation
 		// Used for optimizing many keys change
 		void BeginKeysBatchChange() override;
@@ -266,6 +279,9 @@ namespace o2
 
 		Vector<Key> mKeys; // Animation keys @SERIALIZABLE
 
+		int           mBakedSamplesCount = 0; // Count of baked table segments between keys pair, 0 when track isn't baked
+		Vector<float> mBakedCoefs;            // Baked transition coefficients, mBakedSamplesCount + 2 values for each keys pair
+
 	protected:
 		// Returns keys (for property)
 		Vector<Key> GetKeysNonContant();
@@ -273,6 +289,9 @@ namespace o2
 		// Updates keys approximation
 		void UpdateApproximation();
 
+		// Updates baked transition coefficients tables
+		void UpdateBake();
+
 		// Completion deserialization callback
 		void OnDeserialized(const DataValue& node) override;
 	};
@@ -292,7 +311,8 @@ namespace o2
 
 	template<typename _type>
 	AnimationTrack<_type>::AnimationTrack(const AnimationTrack<_type>& other):
-		IAnimationTrack(other), mKeys(other.mKeys), keys(this)
+		IAnimationTrack(other), mKeys(other.mKeys), mBakedSamplesCount(other.mBakedSamplesCount),
+		mBakedCoefs(other.mBakedCoefs), keys(this)
 	{}
 
 	template<typename _type>
@@ -300,6 +320,8 @@ namespace o2
 	{
 		IAnimationTrack::operator=(other);
 		mKeys = other.mKeys;
+		mBakedSamplesCount = other.mBakedSamplesCount;
+		mBakedCoefs = other.mBakedCoefs;
 
 		onKeysChanged();
 
@@ -333,6 +355,21 @@ namespace o2
 		const Key& leftKey = mKeys[keyLeftIdx];
 		const Key& rightKey = mKeys[keyRightIdx];
 
+		// Baked tables can be outdated during keys batch change
+		if (mBakedSamplesCount > 0 && mBakedCoefs.Count() == (count - 1)*(mBakedSamplesCount + 2))
+		{
+			const float* coefs = mBakedCoefs.Data() + keyLeftIdx*(mBakedSamplesCount + 2);
+
+			float dist = rightKey.position - leftKey.position;
+			float samplePos = dist > FLT_EPSILON ? Math::Clamp01((position - leftKey.position)/dist)*(float)mBakedSamplesCount :
+				(float)mBakedSamplesCount;
+
+			int sampleIdx = (int)samplePos;
+			float sampleCoef = samplePos - (float)sampleIdx;
+
+			return Math::Lerp(leftKey.value, rightKey.value, Math::Lerp(coefs[sampleIdx], coefs[sampleIdx + 1], sampleCoef));
+		}
+
 		int segLeftIdx = 0;
 		int segRightIdx = 1;
 
@@ -351,6 +388,38 @@ namespace o2
 		return Math::Lerp(leftKey.value, rightKey.value, curveCoef);
 	}
 
+	template<typename _type>
+	void AnimationTrack<_type>::GetValues(const float* positions, _type* results, int count) const
+	{
+		int cacheKey = 0, cacheKeyApprox = 0;
+		float prevPosition = count > 0 ? positions[0] : 0.0f;
+		for (int i = 0; i < count; i++)
+		{
+			results[i] = GetValue(positions[i], positions[i] >= prevPosition, cacheKey, cacheKeyApprox);
+			prevPosition = positions[i];
+		}
+	}
+
+	template<typename _type>
+	void AnimationTrack<_type>::Bake(int samplesCount /*= 32*/)
+	{
+		mBakedSamplesCount = Math::Max(samplesCount, 1);
+		UpdateBake();
+	}
+
+	template<typename _type>
+	void AnimationTrack<_type>::ResetBake()
+	{
+		mBakedSamplesCount = 0;
+		mBakedCoefs.Clear();
+	}
+
+	template<typename _type>
+	bool AnimationTrack<_type>::IsBaked() const
+	{
+		return mBakedSamplesCount > 0;
+	}
+
 	template<typename _type>
 	void AnimationTrack<_type>::BeginKeysBatchChange()
 	{
@@ -644,9 +713,48 @@ namespace o2
 			}
 		}
 
+		if (mBakedSamplesCount > 0)
+			UpdateBake();
+
 		onKeysChanged();
 	}
 
+	template<typename _type>
+	void AnimationTrack<_type>::UpdateBake()
+	{
+		int count = mKeys.Count();
+		int tableSize = mBakedSamplesCount + 2;
+		mBakedCoefs.Resize(Math::Max(count - 1, 0)*tableSize);
+
+		for (int i = 1; i < count; i++)
+		{
+			const Key& beginKey = mKeys[i - 1];
+			const Key& endKey = mKeys[i];
+
+			Vec2F curvea(beginKey.position, 0.0f);
+			Vec2F curveb(Math::Lerp(beginKey.position, endKey.position, beginKey.rightSupportPosition), beginKey.rightSupportValue);
+			Vec2F curvec(Math::Lerp(beginKey.position, endKey.position, endKey.leftSupportPosition), endKey.leftSupportValue);
+			Vec2F curved(endKey.position, 1.0f);
+
+			// Samples are calculated by exact transition curve instead of approximation values
+			float* coefs = mBakedCoefs.Data() + (i - 1)*tableSize;
+			for (int j = 0; j <= mBakedSamplesCount; j++)
+			{
+				float position = Math::Lerp(beginKey.position, endKey.position, (float)j/(float)mBakedSamplesCount);
+
+				if (endKey.position - beginKey.position < FLT_EPSILON)
+					coefs[j] = 1.0f;
+				else
+				{
+					float t = SolveMonotonicBezier(curvea.x, curveb.x, curvec.x, curved.x, position);
+					coefs[j] = Bezier(curvea.y, curveb.y, curvec.y, curved.y, t);
+				}
+			}
+
+			coefs[mBakedSamplesCount + 1] = coefs[mBakedSamplesCount];
+		}
+	}
+
 	template<typename _type>
 	void AnimationTrack<_type>::OnDeserialized(const DataValue& node)
 	{
@@ -897,6 +1005,8 @@ CLASS_FIELDS_META(o2::AnimationTrack<_type>)
 	PROTECTED_FIELD(mBatchChange).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mChangedKeys).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mKeys).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedSamplesCount).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mBakedCoefs);
 }
 END_META;
 META_TEMPLATES(typename _type)
@@ -905,6 +1015,10 @@ CLASS_METHODS_META(o2::AnimationTrack<_type>)
 
 	PUBLIC_FUNCTION(_type, GetValue, float);
 	PUBLIC_FUNCTION(_type, GetValue, float, bool, int&, int&);
+	PUBLIC_FUNCTION(void, GetValues, const float*, _type*, int);
+	PUBLIC_FUNCTION(void, Bake, int);
+	PUBLIC_FUNCTION(void, ResetBake);
+	PUBLIC_FUNCTION(bool, IsBaked);
 	PUBLIC_FUNCTION(void, BeginKeysBatchChange);
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(float, GetDuration);
@@ -933,6 +1047,7 @@ CLASS_METHODS_META(o2::AnimationTrack<_type>)
 	PUBLIC_STATIC_FUNCTION(AnimationTrack<_type>, Linear, const _type&, const _type&, float);
 	PROTECTED_FUNCTION(Vector<Key>, GetKeysNonContant);
 	PROTECTED_FUNCTION(void, UpdateApproximation);
+	PROTECTED_FUNCTION(void, UpdateBake);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
@@ -3,11 +3,13 @@
 
 #include <chrono>
 #include <thread>
+#include "o2/Animation/AnimationLODSystem.h"
 #include "o2/Application/Input.h"
 #include "o2/Assets/Assets.h"
 #include "o2/Config/ProjectConfig.h"
 #include "o2/Events/EventSystem.h"
 #include "o2/Physics/PhysicsWorld.h"
+#include "o2/Render/ParticlesSystem.h"
 #include "o2/Render/Render.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Scene/UI/UIManager.h"
@@ -15,6 +17,7 @@
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
 #include "o2/Utils/Debug/Log/FileLogStream.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Debug/StackTrace.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 #include "o2/Utils/System/Time/Time.h"
@@ -71,6 +74,11 @@ namespace o2
 		mPhysics->PostUpdate();
 	}
 
+	void Application::InterpolatePhysics(float coef)
+	{
+		mPhysics->Interpolate(coef);
+	}
+
 	void Application::InitalizeSystems()
 	{
 		srand((UInt)time(NULL));
@@ -95,6 +103,10 @@ namespace o2
 
 		mUIManager = mnew UIManager();
 
+		mParticlesSystem = mnew ParticlesSystem();
+
+		mAnimationLODSystem = mnew AnimationLODSystem();
+
 		mScene = mnew Scene();
 
 		mPhysics = mnew PhysicsWorld();
@@ -107,6 +119,8 @@ namespace o2
 		delete mUIManager;
 		delete mPhysics;
 		delete mScene;
+		delete mParticlesSystem;
+		delete mAnimationLODSystem;
 		delete mRender;
 		delete mInput;
 		delete mTime;
@@ -137,6 +151,9 @@ namespace o2
 
 		float dt = Math::Clamp(realdDt, 0.001f, 0.05f);
 
+		o2Profiler.BeginFrame();
+		PROFILE_SCOPE("Application::ProcessFrame");
+
 		mInput->PreUpdate();
 
 		mTime->Update(realdDt);
@@ -153,6 +170,8 @@ namespace o2
 		float fixedDT = 1.0f/(float)fixedFPS;
 		while (mAccumulatedDT > fixedDT)
 		{
+			PROFILE_SCOPE("Application::FixedUpdate");
+
 			OnFixedUpdate(fixedDT);
 			FixedUpdateScene(fixedDT);
 
@@ -163,16 +182,22 @@ namespace o2
 			mAccumulatedDT -= fixedDT;
 		}
 
+		InterpolatePhysics(mAccumulatedDT/fixedDT);
+
 		PostUpdateEventSystem();
 
-		OnDraw();
-		DrawScene();
+		{
+			PROFILE_SCOPE("Application::Draw");
 
-		DrawUIManager();
+			OnDraw();
+			DrawScene();
 
-		o2Debug.Draw();
+			DrawUIManager();
 
-		mRender->End();
+			o2Debug.Draw();
+
+			mRender->End();
+		}
 
 		mInput->Update(dt);
 	}
@@ -267,4 +292,5 @@ namespace o2
 	MemoryManager* MemoryManager::mInstance = new MemoryManager();
 	template<> Debug* Singleton<Debug>::mInstance = mnew Debug();
 	template<> FileSystem* Singleton<FileSystem>::mInstance = mnew FileSystem();
+	template<> Profiler* Singleton<Profiler>::mInstance = mnew Profiler();
 }
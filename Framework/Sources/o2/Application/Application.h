@@ -19,11 +19,13 @@
 
 namespace o2
 {
+	class AnimationLODSystem;
 	class Assets;
 	class EventSystem;
 	class FileSystem;
 	class Input;
 	class LogStream;
+	class ParticlesSystem;
 	class PhysicsWorld;
 	class ProjectConfig;
 	class Render;
@@ -172,19 +174,21 @@ namespace o2
 	protected:
 		bool mReady = false; // Is all systems is ready
 
-		Assets*        mAssets = nullptr;        // Assets
-		EventSystem*   mEventSystem = nullptr;   // Events processing system
-		FileSystem*    mFileSystem = nullptr;    // File system
-		Input*         mInput = nullptr;         // While application user input message
-		LogStream*     mLog = nullptr;           // Log stream with id "app", using only for application messages
-		PhysicsWorld*  mPhysics = nullptr;       // Physics
-		ProjectConfig* mProjectConfig = nullptr; // Project config
-		Render*        mRender = nullptr;        // Graphics render
-		Scene*         mScene = nullptr;         // Scene
-		TaskManager*   mTaskManager = nullptr;   // Tasks manager
-		Time*          mTime = nullptr;          // Time utilities
-		Timer*         mTimer = nullptr;         // Timer for detecting delta time for update
-		UIManager*     mUIManager = nullptr;     // UI manager
+		AnimationLODSystem* mAnimationLODSystem = nullptr; // Animations visibility and update budget system
+		Assets*             mAssets = nullptr;             // Assets
+		EventSystem*        mEventSystem = nullptr;        // Events processing system
+		FileSystem*         mFileSystem = nullptr;         // File system
+		Input*              mInput = nullptr;              // While application user input message
+		LogStream*          mLog = nullptr;                // Log stream with id "app", using only for application messages
+		ParticlesSystem*    mParticlesSystem = nullptr;    // Particles emitters parallel updating system
+		PhysicsWorld*       mPhysics = nullptr;            // Physics
+		ProjectConfig*      mProjectConfig = nullptr;      // Project config
+		Render*             mRender = nullptr;             // Graphics render
+		Scene*              mScene = nullptr;              // Scene
+		TaskManager*        mTaskManager = nullptr;        // Tasks manager
+		Time*               mTime = nullptr;               // Time utilities
+		Timer*              mTimer = nullptr;              // Timer for detecting delta time for update
+		UIManager*          mUIManager = nullptr;          // UI manager
 
 		bool  mCursorInfiniteModeEnabled = false; // Is cursor infinite mode enabled
 		Vec2F mCursorCorrectionDelta;             // Cursor corrections delta - result of infinite cursors offset
@@ -213,6 +217,9 @@ namespace o2
 		// After update physics
 		virtual void PostUpdatePhysics();
 
+		// Interpolates physics bodies transforms between fixed steps, coef is part of fixed step passed after last step
+		virtual void InterpolatePhysics(float coef);
+
 		// Draws scene
 		virtual void DrawScene();
 
@@ -4,6 +4,7 @@
 #include "o2/Assets/Assets.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 
 namespace o2
 {
@@ -91,6 +92,8 @@ namespace o2
 
 	void Asset::Load(const AssetInfo& info)
 	{
+		PROFILE_SCOPE("Asset::Load");
+
 		mInfo = info;
 		LoadData(GetBuiltFullPath());
 	}
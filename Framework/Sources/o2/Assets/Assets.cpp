@@ -8,6 +8,7 @@
 #include "o2/Config/ProjectConfig.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
 
 namespace o2
@@ -21,6 +22,10 @@ namespace o2
 
 		mAssetsBuilder = mnew AssetsBuilder();
 
+		// Assets are rebuilt often while developing, so images are compressed faster and bigger
+		if (::IsDevMode() && !::IsReleaseBuild())
+			mAssetsBuilder->SetImagesCompression(PngCompression::Fast);
+
 		LoadAssetTypes();
 
 		if (::IsAssetsPrebuildEnabled())
@@ -404,6 +409,8 @@ namespace o2
 
 	void Assets::LoadAssetsTree()
 	{
+		PROFILE_SCOPE("Assets::LoadAssetsTree");
+
 		mAssetsTrees.Clear();
 
 		auto editorAssetsTree = mnew AssetsTree();
@@ -85,6 +85,16 @@ namespace o2
 		return mBuiltAssetsPath;
 	}
 
+	void AssetsBuilder::SetImagesCompression(PngCompression compression)
+	{
+		mImagesCompression = compression;
+	}
+
+	PngCompression AssetsBuilder::GetImagesCompression() const
+	{
+		return mImagesCompression;
+	}
+
 	void AssetsBuilder::InitializeConverters()
 	{
 		auto converterTypes = TypeOf(IAssetConverter).GetDerivedTypes();
@@ -4,6 +4,7 @@
 #include "o2/Assets/AssetInfo.h"
 #include "o2/Assets/AssetsTree.h"
 #include "o2/Assets/Builder/StdAssetConverter.h"
+#include "o2/Utils/Bitmap/PngFormat.h"
 #include "o2/Utils/Types/String.h"
 
 namespace o2
@@ -33,6 +34,12 @@ namespace o2
 		// Returns built assets path in building
 		const String& GetBuiltAssetsPath() const;
 
+		// Sets compression of built images, like atlases pages
+		void SetImagesCompression(PngCompression compression);
+
+		// Returns compression of built images
+		PngCompression GetImagesCompression() const;
+
 	protected:
 		LogStream* mLog; // Asset builder log stream
 
@@ -45,6 +52,8 @@ namespace o2
 
 		Vector<UID> mModifiedAssets; // Modified assets infos
 
+		PngCompression mImagesCompression = PngCompression::Default; // Compression of built images
+
 		Map<const Type*, IAssetConverter*> mAssetConverters;   // Assets converters by type
 		StdAssetConverter                  mStdAssetConverter; // Standard assets converter
 
@@ -7,6 +7,7 @@
 #include "o2/Utils/Bitmap/Bitmap.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
 #include "o2/Utils/FileSystem/FileSystem.h"
+#include "o2/Utils/System/Time/Timer.h"
 
 namespace o2
 {
@@ -184,13 +185,13 @@ namespace o2
 		auto meta = (AtlasAsset::Meta*)atlasInfo->meta;
 
 		RectsPacker packer(meta->windows.maxSize);
-		float imagesBorder = (float)meta->border;
+		packer.SetExtrusion((float)meta->border);
 
-		// Initialize pack images
-		Vector<ImagePackDef> packImages;
+		// Find images infos
+		Vector<AssetInfo*> imagesInfos;
+		Vector<String> imagesPaths;
 		for (auto img : images)
 		{
-			// Find image info
 			AssetInfo* imgInfo = nullptr;
 			mAssetsBuilder->mBuiltAssetsTree->allAssetsByUID.TryGetValue(img.id, imgInfo);
 			if (!imgInfo)
@@ -199,20 +200,29 @@ namespace o2
 				continue;
 			}
 
-			String assetFullPath = mAssetsBuilder->GetSourceAssetsPath() + imgInfo->path;
+			imagesInfos.Add(imgInfo);
+			imagesPaths.Add(mAssetsBuilder->GetSourceAssetsPath() + imgInfo->path);
+		}
 
-			// Load bitmap
-			Bitmap* bitmap = mnew Bitmap();
-			if (!bitmap->Load(assetFullPath))
+		// Load bitmaps, they are decoded concurrently
+		Timer timer;
+		Vector<Bitmap*> bitmaps = LoadPngImages(imagesPaths, false);
+		float loadingTime = timer.GetDeltaTime();
+
+		// Initialize pack images
+		Vector<ImagePackDef> packImages;
+		for (int i = 0; i < imagesInfos.Count(); i++)
+		{
+			AssetInfo* imgInfo = imagesInfos[i];
+			Bitmap* bitmap = bitmaps[i];
+			if (!bitmap)
 			{
 				mAssetsBuilder->mLog->Error("Can't load bitmap for image asset: " + imgInfo->path);
-				delete bitmap;
 				continue;
 			}
 
 			// Create packing rect
-			RectsPacker::Rect* packRect = packer.AddRect(bitmap->GetSize() +
-														 Vec2F(imagesBorder*2.0f, imagesBorder*2.0f));
+			RectsPacker::Rect* packRect = packer.AddRect(bitmap->GetSize());
 
 			ImagePackDef imagePackDef;
 			imagePackDef.assetInfo = imgInfo;
@@ -250,11 +260,6 @@ namespace o2
 		// Save image assets data and fill pages
 		for (auto imgDef : packImages)
 		{
-			imgDef.packRect->rect.left += imagesBorder;
-			imgDef.packRect->rect.right -= imagesBorder;
-			imgDef.packRect->rect.top -= imagesBorder;
-			imgDef.packRect->rect.bottom += imagesBorder;
-
 			resAtlasBitmaps[imgDef.packRect->page]->CopyImage(imgDef.bitmap,
 															  imgDef.packRect->rect.LeftBottom());
 
@@ -265,14 +270,19 @@ namespace o2
 		}
 
 		// Save pages bitmaps
+		timer.Reset();
 		for (int i = 0; i < pagesCount; i++)
 		{
 			resAtlasBitmaps[i]->Save(mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path + (String)i + ".png",
-									 Bitmap::ImageType::Png);
+									 Bitmap::ImageType::Png, mAssetsBuilder->GetImagesCompression());
 
 			delete resAtlasBitmaps[i];
 		}
 
+		mAssetsBuilder->mLog->Out("Atlas " + atlasInfo->path + ": " + (String)packImages.Count() + " images loaded for " +
+								  (String)loadingTime + " seconds, " + (String)pagesCount + " pages saved for " +
+								  (String)timer.GetDeltaTime() + " seconds");
+
 		// Save atlas data
 		String atlasFullPath = mAssetsBuilder->GetSourceAssetsPath() + atlasInfo->path;
 		String atlasFullBuiltPath = mAssetsBuilder->GetBuiltAssetsPath() + atlasInfo->path;
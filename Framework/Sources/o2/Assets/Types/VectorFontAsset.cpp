@@ -18,6 +18,9 @@ namespace o2
 			return false;
 
 		Meta* otherMeta = (Meta*)other;
+		if (mDistanceField != otherMeta->mDistanceField)
+			return false;
+
 		for (auto eff : mEffects)
 		{
 			bool found = false;
@@ -120,7 +123,9 @@ namespace o2
 				clonedEffects.Add(eff->CloneAs<VectorFont::Effect>());
 		}
 
-		dynamic_cast<VectorFont*>(mFont.mFont)->SetEffects(clonedEffects);
+		VectorFont* font = dynamic_cast<VectorFont*>(mFont.mFont);
+		font->SetDistanceField(GetMeta()->mDistanceField);
+		font->SetEffects(clonedEffects);
 	}
 }
 
@@ -67,7 +67,8 @@ namespace o2
 			SERIALIZABLE(Meta);
 
 		protected:
-			Vector<VectorFont::Effect*> mEffects; // Font effects array @SERIALIZABLE @EDITOR_PROPERTY @EXPANDED_BY_DEFAULT @INVOKE_ON_CHANGE(UpdateFontEffects)
+			Vector<VectorFont::Effect*> mEffects;              // Font effects array @SERIALIZABLE @EDITOR_PROPERTY @EXPANDED_BY_DEFAULT @INVOKE_ON_CHANGE(UpdateFontEffects)
+			bool                        mDistanceField = false; // Is font rendered by signed distance field, one glyph set for all sizes. Effects are ignored @SERIALIZABLE @EDITOR_PROPERTY @INVOKE_ON_CHANGE(UpdateFontEffects)
 			
 			VectorFontAsset* mAsset = nullptr; // Asset pointer
 
@@ -140,6 +141,7 @@ END_META;
 CLASS_FIELDS_META(o2::VectorFontAsset::Meta)
 {
 	PROTECTED_FIELD(mEffects).EDITOR_PROPERTY_ATTRIBUTE().EXPANDED_BY_DEFAULT_ATTRIBUTE().INVOKE_ON_CHANGE_ATTRIBUTE(UpdateFontEffects).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mDistanceField).DEFAULT_VALUE(false).EDITOR_PROPERTY_ATTRIBUTE().INVOKE_ON_CHANGE_ATTRIBUTE(UpdateFontEffects).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mAsset).DEFAULT_VALUE(nullptr);
 }
 END_META;
@@ -99,6 +99,11 @@ const char* GetEditorBuiltAssetsTreePath()
 	return "BuiltAssets/Windows/EditorData.json";
 }
 
+const char* GetEditorThumbnailsCachePath()
+{
+	return "BuiltAssets/Windows/EditorThumbnails/";
+}
+
 #ifdef PLATFORM_ANDROID
 
 const char* GetAndroidAssetsPath()
@@ -15,6 +15,18 @@
 #define RENDER_DEBUG false
 #endif
 
+// Enables profiler zones and counters. When disabled, instrumentation macros are compiled out. Define
+// ENABLE_PROFILING=true in project configuration for profiling
+#ifndef ENABLE_PROFILING
+#define ENABLE_PROFILING false
+#endif
+
+// Enables counting of heap allocations and allocated bytes. Used by benchmarks for allocations and peak memory.
+// Adds overhead to each allocation, so it is enabled only for benchmarks builds
+#ifndef ENABLE_ALLOCATIONS_STATISTICS
+#define ENABLE_ALLOCATIONS_STATISTICS false
+#endif
+
 // Describes that engine running as editor
 #define IS_EDITOR true
 
@@ -64,6 +76,9 @@ const char* GetEditorBuiltAssetsPath();
 // Editor's built assets assets tree path
 const char* GetEditorBuiltAssetsTreePath();
 
+// Editor's assets thumbnails cache path. Relative from executable
+const char* GetEditorThumbnailsCachePath();
+
 
 // ----------------------
 // Platform configuration
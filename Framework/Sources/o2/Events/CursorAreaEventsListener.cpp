@@ -25,6 +25,11 @@ namespace o2
 		return false;
 	}
 
+	bool CursorAreaEventsListener::GetCursorAreaBounds(RectF& bounds) const
+	{
+		return false;
+	}
+
 	bool CursorAreaEventsListener::IsScrollable() const
 	{
 		return false;
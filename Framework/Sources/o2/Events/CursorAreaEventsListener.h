@@ -36,6 +36,10 @@ namespace o2
 		// Returns true if point is in this object
 		virtual bool IsUnderPoint(const Vec2F& point);
 
+		// Returns bounds, outside of which IsUnderPoint is always false. Returns false when bounds are unknown, such
+		// listener is checked for each cursor
+		virtual bool GetCursorAreaBounds(RectF& bounds) const;
+
 		// Returns is listener scrollable
 		virtual bool IsScrollable() const;
 
@@ -126,6 +130,7 @@ namespace o2
 
 		friend class EventSystem;
 		friend class CursorAreaEventListenersLayer;
+		friend class Widget;
 	};
 
 	// -----------------------
@@ -39,13 +39,18 @@ namespace o2
 	void CursorAreaEventListenersLayer::Update()
 	{
 		cursorEventAreaListeners.Reverse();
+		mListenersBounds.Reverse();
 		mDragListeners.Reverse();
 
-		mLastUnderCursorListeners = mUnderCursorListeners;
-		mUnderCursorListeners.Clear();
+		// Swapping instead of copying, under cursor vectors keep their memory between frames
+		std::swap(mLastUnderCursorListeners, mUnderCursorListeners);
+		for (auto& kv : mUnderCursorListeners)
+			kv.second.Clear();
 
 		if (mEnabled)
 		{
+			BuildHitTestGrid();
+
 			for (const Input::Cursor& cursor : o2Input.GetCursors())
 				ProcessCursorTracing(cursor);
 		}
@@ -96,7 +101,9 @@ namespace o2
 	void CursorAreaEventListenersLayer::PostUpdate()
 	{
 		cursorEventAreaListeners.Clear();
+		mListenersBounds.Clear();
 		mDragListeners.Clear();
+		mHitTestGridEnabled = false;
 	}
 
 	void CursorAreaEventListenersLayer::BreakCursorEvent()
@@ -113,9 +120,30 @@ namespace o2
 		mPressedListeners.Clear();
 	}
 
+	void CursorAreaEventListenersLayer::RegCursorAreaListener(CursorAreaEventsListener* listener)
+	{
+		ListenerBounds bounds;
+		bounds.bounded = listener->GetCursorAreaBounds(bounds.rect);
+
+		cursorEventAreaListeners.Add(listener);
+		mListenersBounds.Add(bounds);
+	}
+
 	void CursorAreaEventListenersLayer::UnregCursorAreaListener(CursorAreaEventsListener* listener)
 	{
-		cursorEventAreaListeners.RemoveAll([&](auto x) { return x == listener; });
+		for (int i = cursorEventAreaListeners.Count() - 1; i >= 0; i--)
+		{
+			if (cursorEventAreaListeners[i] != listener)
+				continue;
+
+			cursorEventAreaListeners.RemoveAt(i);
+
+			if (i < mListenersBounds.Count())
+				mListenersBounds.RemoveAt(i);
+		}
+
+		mHitTestGridEnabled = false;
+
 		mRightButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 		mMiddleButtonPressedListeners.RemoveAll([&](auto x) { return x == listener; });
 
@@ -163,32 +191,182 @@ namespace o2
 		return localCursor;
 	}
 
-	void CursorAreaEventListenersLayer::ProcessCursorTracing(const Input::Cursor& cursor)
+	void CursorAreaEventListenersLayer::BuildHitTestGrid()
 	{
-		auto localCursor = ConvertLocalCursor(cursor);
+		mHitTestGridEnabled = false;
 
-		for (auto listener : cursorEventAreaListeners)
+		int count = cursorEventAreaListeners.Count();
+		if (count < mHitTestGridMinListeners || count != mListenersBounds.Count())
+			return;
+
+		// Listener can't be under cursor outside of its scissor, so bounds are clipped. Scissor is known only
+		// after drawing, so it's done here instead of registering
+		bool anyBounded = false;
+		for (int i = 0; i < count; i++)
 		{
-			if (!listener->IsUnderPoint(localCursor.position) || !listener->mScissorRect.IsInside(localCursor.position))
+			ListenerBounds& bounds = mListenersBounds[i];
+			if (!bounds.bounded)
 				continue;
 
-			auto drag = dynamic_cast<DragableObject*>(listener);
-			if (drag && drag->IsDragging())
+			bounds.rect = bounds.rect.GetIntersection(cursorEventAreaListeners[i]->mScissorRect);
+			if (bounds.rect.Width() <= 0.0f || bounds.rect.Height() <= 0.0f)
 				continue;
 
-			if (!mUnderCursorListeners.ContainsKey(localCursor.id))
-				mUnderCursorListeners.Add(localCursor.id, {});
+			mHitTestGridRect = anyBounded ? mHitTestGridRect.Expand(bounds.rect) : bounds.rect;
+			anyBounded = true;
+		}
 
-			mUnderCursorListeners[localCursor.id].Add(listener);
+		if (!anyBounded)
+			return;
 
-			if (!listener->IsInputTransparent())
+		// About 4 listeners in cell when they are distributed uniformly
+		int cellsByAxis = Math::Clamp((int)Math::Sqrt(count*0.25f), 1, mHitTestGridMaxCells);
+		mHitTestGridSize.x = mHitTestGridRect.Width() > 0.0f ? cellsByAxis : 1;
+		mHitTestGridSize.y = mHitTestGridRect.Height() > 0.0f ? cellsByAxis : 1;
+		mHitTestGridCellSize.x = Math::Max(mHitTestGridRect.Width()/(float)mHitTestGridSize.x, FLT_EPSILON);
+		mHitTestGridCellSize.y = Math::Max(mHitTestGridRect.Height()/(float)mHitTestGridSize.y, FLT_EPSILON);
+
+		int cellsCount = mHitTestGridSize.x*mHitTestGridSize.y;
+		int maxListenerCells = Math::Max(1, cellsCount/4);
+
+		mHitTestCellsStarts.Resize(cellsCount + 1);
+		for (auto& start : mHitTestCellsStarts)
+			start = 0;
+
+		// Not bounded and big listeners are checked for each cursor, grid keeps only small ones
+		mAlwaysCheckedListeners.Clear();
+		for (int i = 0; i < count; i++)
+		{
+			const ListenerBounds& bounds = mListenersBounds[i];
+			if (!bounds.bounded)
+			{
+				mAlwaysCheckedListeners.Add(i);
+				continue;
+			}
+
+			if (bounds.rect.Width() <= 0.0f || bounds.rect.Height() <= 0.0f)
+				continue;
+
+			int minX, minY, maxX, maxY;
+			GetHitTestGridCell(bounds.rect.LeftBottom(), minX, minY);
+			GetHitTestGridCell(bounds.rect.RightTop(), maxX, maxY);
+
+			if ((maxX - minX + 1)*(maxY - minY + 1) > maxListenerCells)
+			{
+				mAlwaysCheckedListeners.Add(i);
+				continue;
+			}
+
+			for (int y = minY; y <= maxY; y++)
+			{
+				for (int x = minX; x <= maxX; x++)
+					mHitTestCellsStarts[y*mHitTestGridSize.x + x + 1]++;
+			}
+		}
+
+		for (int i = 1; i <= cellsCount; i++)
+			mHitTestCellsStarts[i] += mHitTestCellsStarts[i - 1];
+
+		mHitTestCellsFilling = mHitTestCellsStarts;
+		mHitTestCellsListeners.Resize(mHitTestCellsStarts[cellsCount]);
+
+		// Listeners are added in priority order, so each cell range stays sorted
+		int alwaysCheckedIdx = 0;
+		for (int i = 0; i < count; i++)
+		{
+			if (alwaysCheckedIdx < mAlwaysCheckedListeners.Count() && mAlwaysCheckedListeners[alwaysCheckedIdx] == i)
+			{
+				alwaysCheckedIdx++;
+				continue;
+			}
+
+			const ListenerBounds& bounds = mListenersBounds[i];
+			if (bounds.rect.Width() <= 0.0f || bounds.rect.Height() <= 0.0f)
+				continue;
+
+			int minX, minY, maxX, maxY;
+			GetHitTestGridCell(bounds.rect.LeftBottom(), minX, minY);
+			GetHitTestGridCell(bounds.rect.RightTop(), maxX, maxY);
+
+			for (int y = minY; y <= maxY; y++)
+			{
+				for (int x = minX; x <= maxX; x++)
+					mHitTestCellsListeners[mHitTestCellsFilling[y*mHitTestGridSize.x + x]++] = i;
+			}
+		}
+
+		mHitTestGridEnabled = true;
+	}
+
+	void CursorAreaEventListenersLayer::GetHitTestGridCell(const Vec2F& point, int& x, int& y) const
+	{
+		x = Math::Clamp((int)((point.x - mHitTestGridRect.left)/mHitTestGridCellSize.x), 0, mHitTestGridSize.x - 1);
+		y = Math::Clamp((int)((point.y - mHitTestGridRect.bottom)/mHitTestGridCellSize.y), 0, mHitTestGridSize.y - 1);
+	}
+
+	void CursorAreaEventListenersLayer::ProcessCursorTracing(const Input::Cursor& cursor)
+	{
+		auto localCursor = ConvertLocalCursor(cursor);
+		auto& underCursorListeners = mUnderCursorListeners[localCursor.id];
+
+		if (!mHitTestGridEnabled)
+		{
+			for (auto listener : cursorEventAreaListeners)
+			{
+				if (TraceListener(listener, localCursor, underCursorListeners))
+					return;
+			}
+
+			return;
+		}
+
+		int cellIdx = 0, cellEnd = 0;
+		if (mHitTestGridRect.IsInside(localCursor.position))
+		{
+			int x, y;
+			GetHitTestGridCell(localCursor.position, x, y);
+
+			int cell = y*mHitTestGridSize.x + x;
+			cellIdx = mHitTestCellsStarts[cell];
+			cellEnd = mHitTestCellsStarts[cell + 1];
+		}
+
+		// Merging cell listeners with always checked listeners, both are sorted by priority
+		int alwaysCheckedIdx = 0, alwaysCheckedEnd = mAlwaysCheckedListeners.Count();
+		while (cellIdx < cellEnd || alwaysCheckedIdx < alwaysCheckedEnd)
+		{
+			int listenerIdx;
+			if (alwaysCheckedIdx == alwaysCheckedEnd ||
+				(cellIdx < cellEnd && mHitTestCellsListeners[cellIdx] < mAlwaysCheckedListeners[alwaysCheckedIdx]))
+			{
+				listenerIdx = mHitTestCellsListeners[cellIdx++];
+			}
+			else
+				listenerIdx = mAlwaysCheckedListeners[alwaysCheckedIdx++];
+
+			if (TraceListener(cursorEventAreaListeners[listenerIdx], localCursor, underCursorListeners))
 				return;
 		}
 	}
 
+	bool CursorAreaEventListenersLayer::TraceListener(CursorAreaEventsListener* listener, const Input::Cursor& localCursor,
+													  Vector<CursorAreaEventsListener*>& underCursorListeners)
+	{
+		if (!listener->IsUnderPoint(localCursor.position) || !listener->mScissorRect.IsInside(localCursor.position))
+			return false;
+
+		auto drag = dynamic_cast<DragableObject*>(listener);
+		if (drag && drag->IsDragging())
+			return false;
+
+		underCursorListeners.Add(listener);
+
+		return !listener->IsInputTransparent();
+	}
+
 	void CursorAreaEventListenersLayer::ProcessCursorEnter()
 	{
-		for (auto underCursorListeners : mUnderCursorListeners)
+		for (auto& underCursorListeners : mUnderCursorListeners)
 		{
 			bool lastListenersHasSameCursor = mLastUnderCursorListeners.ContainsKey(underCursorListeners.first);
 			for (auto listener : underCursorListeners.second)
@@ -201,7 +379,7 @@ namespace o2
 
 	void CursorAreaEventListenersLayer::ProcessCursorExit()
 	{
-		for (auto lastUnderCursorListeners : mLastUnderCursorListeners)
+		for (auto& lastUnderCursorListeners : mLastUnderCursorListeners)
 		{
 			bool listenersHasSameCursor = mUnderCursorListeners.ContainsKey(lastUnderCursorListeners.first);
 			for (auto listener : lastUnderCursorListeners.second)
@@ -307,7 +485,7 @@ namespace o2
 	{
 		auto localCursor = ConvertLocalCursor(*o2Input.GetCursor(0));
 
-		if (!mUnderCursorListeners.ContainsKey(localCursor.id))
+		if (!mUnderCursorListeners.ContainsKey(localCursor.id) || mUnderCursorListeners[localCursor.id].IsEmpty())
 			return;
 
 		mRightButtonPressedListeners.Clear();
@@ -366,7 +544,7 @@ namespace o2
 	{
 		auto localCursor = ConvertLocalCursor(*o2Input.GetCursor(0));
 
-		if (!mUnderCursorListeners.ContainsKey(localCursor.id))
+		if (!mUnderCursorListeners.ContainsKey(localCursor.id) || mUnderCursorListeners[localCursor.id].IsEmpty())
 			return;
 
 		mMiddleButtonPressedListeners.Clear();
@@ -41,6 +41,9 @@ namespace o2
 		// Breaks cursor event. All pressed listeners will be unpressed with specific event OnPressBreak
 		void BreakCursorEvent();
 
+		// Registering drawn cursor area events listener and remembers its bounds for hit testing
+		void RegCursorAreaListener(CursorAreaEventsListener* listener);
+
 		// Unregistering cursor area events listener
 		void UnregCursorAreaListener(CursorAreaEventsListener* listener);
 
@@ -54,6 +57,19 @@ namespace o2
 		bool IsUnderPoint(const Vec2F& point) override;
 
 	private:
+		// ------------------------------------------------------------------
+		// Listener bounds for hit testing, same index as in listeners vector
+		// ------------------------------------------------------------------
+		struct ListenerBounds
+		{
+			RectF rect;            // Bounds rectangle
+			bool  bounded = false; // Is bounds known. Not bounded listeners are checked for each cursor
+		};
+
+	private:
+		const int mHitTestGridMinListeners = 64; // Minimal count of listeners when hit test grid is used
+		const int mHitTestGridMaxCells = 32;     // Maximum count of hit test grid cells by each axis
+
 		bool mEnabled = false;
 
 		Basis mLocalToWorldTransform = Basis::Identity();
@@ -67,6 +83,17 @@ namespace o2
 
 		Vector<DragableObject*> mDragListeners; // Drag events listeners
 
+		Vector<ListenerBounds> mListenersBounds; // Drawn listeners bounds, parallel to cursorEventAreaListeners
+
+		bool        mHitTestGridEnabled = false; // Is hit test grid built for this frame, otherwise listeners are checked one by one
+		RectF       mHitTestGridRect;            // Hit test grid area, union of bounded listeners
+		Vec2I       mHitTestGridSize;            // Hit test grid cells count
+		Vec2F       mHitTestGridCellSize;        // Hit test grid cell size
+		Vector<int> mHitTestCellsStarts;         // Beginnings of cells ranges in mHitTestCellsListeners, cells count + 1
+		Vector<int> mHitTestCellsFilling;        // Cells filling positions, used while building grid
+		Vector<int> mHitTestCellsListeners;      // Listeners indexes of all cells in priority order
+		Vector<int> mAlwaysCheckedListeners;     // Indexes of not bounded and too big for grid listeners in priority order
+
 	private:
 		// It is called when cursor enters this object
 		void OnCursorEnter(const Input::Cursor& cursor) override;
@@ -77,9 +104,19 @@ namespace o2
 		// Converts cursor to local coordinates
 		Input::Cursor ConvertLocalCursor(const Input::Cursor& cursor) const;
 
+		// Builds hit test grid by listeners bounds clipped by their scissors. Grid is used only with a lot of listeners
+		void BuildHitTestGrid();
+
+		// Returns hit test grid cell by point
+		void GetHitTestGridCell(const Vec2F& point, int& x, int& y) const;
+
 		// processes cursor tracing for cursor
 		void ProcessCursorTracing(const Input::Cursor& cursor);
 
+		// Checks listener under cursor and adds it to under cursor listeners. Returns true when tracing must be stopped
+		bool TraceListener(CursorAreaEventsListener* listener, const Input::Cursor& localCursor,
+						   Vector<CursorAreaEventsListener*>& underCursorListeners);
+
 		// Processes cursor enter event
 		void ProcessCursorEnter();
 
@@ -22,18 +22,18 @@ namespace o2
 	DrawableCursorEventsListener::~DrawableCursorEventsListener()
 	{
 		if (mEventHandleDrawable)
-			mEventHandleDrawable->onDraw -= MakeFunction(this, &DrawableCursorEventsListener::OnDrawn);
+			mEventHandleDrawable->onDraw.Remove(mOnDrawnHandle);
 	}
 
 	void DrawableCursorEventsListener::SetEventHandleDrawable(IDrawable* drawable)
 	{
 		if (mEventHandleDrawable)
-			mEventHandleDrawable->onDraw -= MakeFunction(this, &DrawableCursorEventsListener::OnDrawn);
+			mEventHandleDrawable->onDraw.Remove(mOnDrawnHandle);
 
 		mEventHandleDrawable = drawable;
 
 		if (mEventHandleDrawable)
-			mEventHandleDrawable->onDraw += MakeFunction(this, &DrawableCursorEventsListener::OnDrawn);
+			mOnDrawnHandle = mEventHandleDrawable->onDraw.Add(this, &DrawableCursorEventsListener::OnDrawn);
 	}
 
 	IDrawable* DrawableCursorEventsListener::GetEventHandleDrawable() const
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Events/CursorAreaEventsListener.h"
+#include "o2/Utils/Delegates.h"
 
 namespace o2
 {
@@ -33,7 +34,8 @@ namespace o2
 		bool IsUnderPoint(const Vec2F& point);
 
 	protected:
-		IDrawable* mEventHandleDrawable;
+		IDrawable*     mEventHandleDrawable; // Event handling drawable
+		FunctionHandle mOnDrawnHandle;       // Handle of OnDrawn() subscription to drawable's onDraw
 
 	protected:
 		// It is called when listener was drawn
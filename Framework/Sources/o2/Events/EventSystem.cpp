@@ -9,6 +9,7 @@
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Editor/DragAndDrop.h"
 #include "o2/Utils/Editor/EditorScope.h"
 #include "o2/Utils/System/Time/Time.h"
@@ -40,6 +41,8 @@ namespace o2
 
 	void EventSystem::Update()
 	{
+		PROFILE_SCOPE("EventSystem::Update");
+
 		for (auto layer : mCursorAreaEventsListenersLayers)
 			layer->Update();
 
@@ -280,7 +283,7 @@ namespace o2
 		if (!listener->IsListeningEvents())
 			return;
 
-		mInstance->mCurrentCursorAreaEventsLayer->cursorEventAreaListeners.Add(listener);
+		mInstance->mCurrentCursorAreaEventsLayer->RegCursorAreaListener(listener);
 	}
 
 	void EventSystem::UnregCursorAreaListener(CursorAreaEventsListener* listener)
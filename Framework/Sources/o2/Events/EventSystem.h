@@ -133,6 +133,7 @@ namespace o2
 		friend class CursorEventsListener;
 		friend class DragableObject;
 		friend class KeyboardEventsListener;
+		friend class Widget;
 		friend class WndProcFunc;
 	};
 
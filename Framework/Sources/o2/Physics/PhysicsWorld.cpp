@@ -1,23 +1,137 @@
 #include "o2/stdafx.h"
 #include "PhysicsWorld.h"
 
+#include "Box2D/Collision/b2Collision.h"
+#include "Box2D/Collision/Shapes/b2CircleShape.h"
 #include "Box2D/Dynamics/b2Body.h"
+#include "Box2D/Dynamics/b2Fixture.h"
+#include "Box2D/Dynamics/Contacts/b2Contact.h"
 #include "o2/Config/ProjectConfig.h"
 #include "o2/Scene/Physics/ICollider.h"
 #include "o2/Scene/Physics/RigidBody.h"
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/Tasks/WorkersPool.h"
 
 namespace o2
 {
 	DECLARE_SINGLETON(PhysicsWorld);
 
+	// Returns is fixture passing queries filter by layers mask and sensor flag
+	static bool IsFixturePassingFilter(b2Fixture* fixture, UInt layersMask, bool includeSensors)
+	{
+		if (!includeSensors && fixture->IsSensor())
+			return false;
+
+		auto collider = (ICollider*)fixture->GetUserData();
+		return collider && (collider->GetLayerMask() & layersMask) != 0;
+	}
+
+	// Fills ray cast hit from fixture and hit point and normal in physics coordinates
+	static void FillRayCastHit(PhysicsWorld::RayCastHit& hit, b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal,
+							   const Vec2F& from, float scale)
+	{
+		hit.collider = (ICollider*)fixture->GetUserData();
+		hit.body = hit.collider->GetRigidBody();
+		hit.point = Vec2F(point)*scale;
+		hit.normal = Vec2F(normal);
+		hit.distance = (hit.point - from).Length();
+	}
+
+	// -------------------------------------------------
+	// Box2D ray cast callback, searches for closest hit
+	// -------------------------------------------------
+	struct ClosestRayCastCallback: public b2RayCastCallback
+	{
+		PhysicsWorld::RayCastHit* hit;            // Result hit
+		Vec2F                     from;           // Ray beginning in world coordinates
+		float                     scale;          // Physics scale
+		UInt                      layersMask;     // Layers filter mask
+		bool                      includeSensors; // Are sensors hit
+
+		float32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction) override
+		{
+			if (!IsFixturePassingFilter(fixture, layersMask, includeSensors))
+				return -1.0f;
+
+			FillRayCastHit(*hit, fixture, point, normal, from, scale);
+			return fraction;
+		}
+	};
+
+	// ------------------------------------------
+	// Box2D ray cast callback, collects all hits
+	// ------------------------------------------
+	struct AllRayCastCallback: public b2RayCastCallback
+	{
+		Vector<PhysicsWorld::RayCastHit>* hits;           // Result hits
+		Vec2F                             from;           // Ray beginning in world coordinates
+		float                             scale;          // Physics scale
+		UInt                              layersMask;     // Layers filter mask
+		bool                              includeSensors; // Are sensors hit
+
+		float32 ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float32 fraction) override
+		{
+			if (!IsFixturePassingFilter(fixture, layersMask, includeSensors))
+				return -1.0f;
+
+			PhysicsWorld::RayCastHit hit;
+			FillRayCastHit(hit, fixture, point, normal, from, scale);
+			hits->Add(hit);
+
+			return 1.0f;
+		}
+	};
+
+	// ---------------------------------------------------------------------------------------
+	// Box2D AABB query callback. Collects colliders, which bounds and optional shape overlaps
+	// ---------------------------------------------------------------------------------------
+	struct OverlapQueryCallback: public b2QueryCallback
+	{
+		Vector<ICollider*>* colliders;       // Result colliders
+		b2AABB              aabb;            // Query bounds in physics coordinates
+		const b2Shape*      shape = nullptr; // Query shape in physics coordinates, when null only bounds are checked
+		UInt                layersMask;      // Layers filter mask
+		bool                includeSensors;  // Are sensors included
+
+		bool ReportFixture(b2Fixture* fixture) override
+		{
+			if (!IsFixturePassingFilter(fixture, layersMask, includeSensors))
+				return true;
+
+			b2Transform identity;
+			identity.SetIdentity();
+
+			for (int32 i = 0; i < fixture->GetShape()->GetChildCount(); i++)
+			{
+				if (!b2TestOverlap(aabb, fixture->GetAABB(i)))
+					continue;
+
+				if (shape && !b2TestOverlap(shape, 0, fixture->GetShape(), i, identity, fixture->GetBody()->GetTransform()))
+					continue;
+
+				colliders->Add((ICollider*)fixture->GetUserData());
+				break;
+			}
+
+			return true;
+		}
+	};
+
 	PhysicsWorld::PhysicsWorld():
 		mWorld(Vec2F())
 	{
 		auto debugDraw = mnew PhysicsDebugDraw();
 		mWorld.SetDebugDraw(debugDraw);
+		mWorld.SetTaskExecutor(this);
+		mWorld.SetContactListener(this);
 		debugDraw->SetFlags(b2Draw::e_shapeBit | b2Draw::e_aabbBit | b2Draw::e_pairBit | b2Draw::e_centerOfMassBit | b2Draw::e_jointBit);
 
 		mPrevPhysicsScale = o2Config.physics.scale;
+
+		// Default layer has first bit, it is default collider layer mask
+		mLayers.Add("Default");
+
+		mWorkersCount = o2Workers.GetWorkersCount();
 	}
 
 	void PhysicsWorld::PreUpdate()
@@ -30,30 +144,107 @@ namespace o2
 
 		float invScale = 1.0f/o2Config.physics.scale;
 
-		for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
+		for (auto rigidBody : mDirtyBodies)
 		{
-			auto rigidBody = (RigidBody*)body->GetUserData();
-			auto transform = rigidBody->transform;
+			rigidBody->mTransformDirty = false;
 
-			body->SetTransform(transform->GetWorldPosition()*invScale, transform->GetWorldAngle());
+			Vec2F position = rigidBody->transform->GetWorldPosition();
+			float angle = rigidBody->transform->GetWorldAngle();
+
+			// Transform can be dirty only because it was updated after physics sync
+			if (position == rigidBody->mSyncedPosition && Math::AnglesEquals(angle, rigidBody->mSyncedAngle))
+				continue;
+
+			rigidBody->mBody->SetTransform(position*invScale, angle);
+			rigidBody->mBody->SetAwake(true);
+			rigidBody->ResetSyncedTransform(position, angle);
 		}
+
+		mDirtyBodies.Clear();
 	}
 
 	void PhysicsWorld::Update(float dt)
 	{
+		PROFILE_SCOPE("PhysicsWorld::Update");
+
 		mWorld.Step(dt, o2Config.physics.velocityIterations, o2Config.physics.positionIterations);
 	}
 
 	void PhysicsWorld::PostUpdate()
 	{
+		PROFILE_SCOPE("PhysicsWorld::PostUpdate");
+
 		float scale = o2Config.physics.scale;
 		for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
 		{
+			if (body->GetType() == b2_staticBody)
+				continue;
+
 			auto rigidBody = (RigidBody*)body->GetUserData();
-			auto transform = rigidBody->transform;
 
-			transform->SetWorldPosition(Vec2F(body->GetPosition())*scale);
-			transform->SetWorldAngle(body->GetAngle());
+			rigidBody->mPrevStepPosition = rigidBody->mStepPosition;
+			rigidBody->mPrevStepAngle = rigidBody->mStepAngle;
+
+			if (!body->IsAwake())
+				continue;
+
+			rigidBody->mStepPosition = Vec2F(body->GetPosition())*scale;
+			rigidBody->mStepAngle = body->GetAngle();
+
+			if (!rigidBody->mIsInterpolated)
+				rigidBody->SetSyncedTransform(rigidBody->mStepPosition, rigidBody->mStepAngle);
+		}
+
+		mIsUpdatingPhysicsNow = false;
+
+		DispatchContactEvents();
+	}
+
+	void PhysicsWorld::DispatchContactEvents()
+	{
+		PROFILE_SCOPE("PhysicsWorld::DispatchContactEvents");
+
+		// Callbacks can destroy colliders and record new events, so events are taken by index and colliders
+		// are checked before each callback. New events are dispatched in this pass too
+		for (int i = 0; i < mContactEvents.Count(); i++)
+		{
+			DispatchContactEvent(i, true);
+			DispatchContactEvent(i, false);
+		}
+
+		for (auto& event : mContactEvents)
+		{
+			if (event.colliderA)
+				event.colliderA->mLastContactEvent = -1;
+
+			if (event.colliderB)
+				event.colliderB->mLastContactEvent = -1;
+		}
+
+		mContactEvents.Clear();
+	}
+
+	void PhysicsWorld::Interpolate(float coef)
+	{
+		mIsUpdatingPhysicsNow = true;
+
+		for (b2Body* body = mWorld.GetBodyList(); body; body = body->GetNext())
+		{
+			if (body->GetType() == b2_staticBody)
+				continue;
+
+			// Dirty transform was changed outside physics and will be pushed into body on next step
+			auto rigidBody = (RigidBody*)body->GetUserData();
+			if (!rigidBody->mIsInterpolated || rigidBody->mTransformDirty)
+				continue;
+
+			Vec2F position = Math::Lerp(rigidBody->mPrevStepPosition, rigidBody->mStepPosition, coef);
+			float angle = Math::Lerp(rigidBody->mPrevStepAngle, rigidBody->mStepAngle, coef);
+
+			if (position == rigidBody->mSyncedPosition && Math::AnglesEquals(angle, rigidBody->mSyncedAngle))
+				continue;
+
+			rigidBody->SetSyncedTransform(position, angle);
 		}
 
 		mIsUpdatingPhysicsNow = false;
@@ -69,6 +260,188 @@ namespace o2
 		return mIsUpdatingPhysicsNow;
 	}
 
+	UInt PhysicsWorld::GetLayerMask(const String& layer)
+	{
+		int idx = mLayers.IndexOf(layer);
+		if (idx < 0)
+		{
+			if (mLayers.Count() == maxLayers)
+			{
+				o2Debug.LogError("Can't register physics layer " + layer + ", there are too many layers");
+				return 0;
+			}
+
+			idx = mLayers.Count();
+			mLayers.Add(layer);
+		}
+
+		return 1u << idx;
+	}
+
+	UInt PhysicsWorld::GetLayersMask(const Vector<String>& layers)
+	{
+		UInt mask = 0;
+		for (auto& layer : layers)
+			mask |= GetLayerMask(layer);
+
+		return mask;
+	}
+
+	bool PhysicsWorld::RayCast(const Vec2F& from, const Vec2F& to, RayCastHit& hit, UInt layersMask /*= allLayers*/,
+							   bool includeSensors /*= false*/) const
+	{
+		float scale = o2Config.physics.scale;
+		float invScale = 1.0f/scale;
+
+		hit = RayCastHit();
+
+		ClosestRayCastCallback callback;
+		callback.hit = &hit;
+		callback.from = from;
+		callback.scale = scale;
+		callback.layersMask = layersMask;
+		callback.includeSensors = includeSensors;
+
+		if (from != to)
+			mWorld.RayCast(&callback, from*invScale, to*invScale);
+
+		return hit.collider != nullptr;
+	}
+
+	Vector<PhysicsWorld::RayCastHit> PhysicsWorld::RayCastAll(const Vec2F& from, const Vec2F& to, 
+															  UInt layersMask /*= allLayers*/,
+															  bool includeSensors /*= false*/) const
+	{
+		float scale = o2Config.physics.scale;
+		float invScale = 1.0f/scale;
+
+		Vector<RayCastHit> hits;
+
+		AllRayCastCallback callback;
+		callback.hits = &hits;
+		callback.from = from;
+		callback.scale = scale;
+		callback.layersMask = layersMask;
+		callback.includeSensors = includeSensors;
+
+		if (from != to)
+			mWorld.RayCast(&callback, from*invScale, to*invScale);
+
+		hits.Sort([](const RayCastHit& a, const RayCastHit& b) { return a.distance < b.distance; });
+		return hits;
+	}
+
+	Vector<ICollider*> PhysicsWorld::QueryRect(const RectF& rect, UInt layersMask /*= allLayers*/,
+											   bool includeSensors /*= true*/) const
+	{
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		Vector<ICollider*> colliders;
+
+		OverlapQueryCallback callback;
+		callback.colliders = &colliders;
+		callback.aabb.lowerBound = Vec2F(Math::Min(rect.left, rect.right), Math::Min(rect.bottom, rect.top))*invScale;
+		callback.aabb.upperBound = Vec2F(Math::Max(rect.left, rect.right), Math::Max(rect.bottom, rect.top))*invScale;
+		callback.layersMask = layersMask;
+		callback.includeSensors = includeSensors;
+
+		mWorld.QueryAABB(&callback, callback.aabb);
+
+		return colliders;
+	}
+
+	Vector<ICollider*> PhysicsWorld::OverlapCircle(const Vec2F& center, float radius, UInt layersMask /*= allLayers*/,
+												   bool includeSensors /*= true*/) const
+	{
+		float invScale = 1.0f/o2Config.physics.scale;
+
+		b2CircleShape circle;
+		circle.m_p = center*invScale;
+		circle.m_radius = radius*invScale;
+
+		Vector<ICollider*> colliders;
+
+		OverlapQueryCallback callback;
+		callback.colliders = &colliders;
+		callback.aabb.lowerBound = (center - Vec2F(radius, radius))*invScale;
+		callback.aabb.upperBound = (center + Vec2F(radius, radius))*invScale;
+		callback.shape = &circle;
+		callback.layersMask = layersMask;
+		callback.includeSensors = includeSensors;
+
+		mWorld.QueryAABB(&callback, callback.aabb);
+
+		return colliders;
+	}
+
+	void PhysicsWorld::RayCastBatch(const Vector<RayCastQuery>& queries, Vector<RayCastHit>& hits,
+									bool includeSensors /*= false*/)
+	{
+		PROFILE_SCOPE("PhysicsWorld::RayCastBatch");
+
+		hits.Resize(queries.Count());
+
+		mBatchQueries = &queries;
+		mBatchHits = &hits;
+		mBatchIncludeSensors = includeSensors;
+
+		Run(&PhysicsWorld::RayCastBatchTask, this, (queries.Count() + mQueriesPerTask - 1)/mQueriesPerTask);
+
+		mBatchQueries = nullptr;
+		mBatchHits = nullptr;
+	}
+
+	void PhysicsWorld::SetWorkersCount(int count)
+	{
+		mWorkersCount = Math::Max(count, 0);
+	}
+
+	int PhysicsWorld::GetWorkersCount() const
+	{
+		return mWorkersCount;
+	}
+
+	int32 PhysicsWorld::GetThreadsCount() const
+	{
+		return Math::Min(mWorkersCount, o2Workers.GetWorkersCount()) + 1;
+	}
+
+	void PhysicsWorld::Run(b2Task task, void* context, int32 count)
+	{
+		o2Workers.Run(task, context, count, mWorkersCount);
+	}
+
+	void PhysicsWorld::BeginContact(b2Contact* contact)
+	{
+		auto& event = AddContactEvent(contact, true);
+		if (event.trigger)
+			return;
+
+		b2WorldManifold worldManifold;
+		contact->GetWorldManifold(&worldManifold);
+
+		int pointsCount = contact->GetManifold()->pointCount;
+		if (pointsCount == 0)
+			return;
+
+		b2Vec2 point = worldManifold.points[0];
+		if (pointsCount > 1)
+			point = 0.5f*(worldManifold.points[0] + worldManifold.points[1]);
+
+		b2Vec2 velocityA = contact->GetFixtureA()->GetBody()->GetLinearVelocityFromWorldPoint(point);
+		b2Vec2 velocityB = contact->GetFixtureB()->GetBody()->GetLinearVelocityFromWorldPoint(point);
+
+		float scale = o2Config.physics.scale;
+		event.point = Vec2F(point)*scale;
+		event.normal = worldManifold.normal;
+		event.relativeVelocity = Vec2F(velocityB - velocityA)*scale;
+	}
+
+	void PhysicsWorld::EndContact(b2Contact* contact)
+	{
+		AddContactEvent(contact, false);
+	}
+
 	void PhysicsWorld::CheckPhysicsScale()
 	{
 		if (Math::Equals(mPrevPhysicsScale, o2Config.physics.scale))
@@ -82,6 +455,7 @@ namespace o2
 			auto transform = rigidBody->transform;
 
 			body->SetTransform(transform->GetWorldPosition()*invScale, transform->GetWorldAngle());
+			rigidBody->ResetSyncedTransform(transform->GetWorldPosition(), transform->GetWorldAngle());
 
 			auto colliders = rigidBody->mColliders;
 			for (auto collider : colliders)
@@ -91,6 +465,109 @@ namespace o2
 		mPrevPhysicsScale = scale;
 	}
 
+	void PhysicsWorld::RayCastBatchTask(void* context, int32 index, int32 threadIndex)
+	{
+		// Box2D queries only read broadphase tree and fixtures, they are safe to run in parallel while world isn't changing
+		auto world = (PhysicsWorld*)context;
+		int queriesCount = world->mBatchQueries->Count();
+		int end = Math::Min(queriesCount, (index + 1)*world->mQueriesPerTask);
+		for (int i = index*world->mQueriesPerTask; i < end; i++)
+		{
+			auto& query = (*world->mBatchQueries)[i];
+			world->RayCast(query.from, query.to, (*world->mBatchHits)[i], query.layersMask, world->mBatchIncludeSensors);
+		}
+	}
+
+	PhysicsWorld::ContactEvent& PhysicsWorld::AddContactEvent(b2Contact* contact, bool begin)
+	{
+		b2Fixture* fixtureA = contact->GetFixtureA();
+		b2Fixture* fixtureB = contact->GetFixtureB();
+
+		ContactEvent event;
+		event.colliderA = (ICollider*)fixtureA->GetUserData();
+		event.colliderB = (ICollider*)fixtureB->GetUserData();
+		event.prevEventA = event.colliderA->mLastContactEvent;
+		event.prevEventB = event.colliderB->mLastContactEvent;
+		event.begin = begin;
+		event.trigger = fixtureA->IsSensor() || fixtureB->IsSensor();
+
+		event.colliderA->mLastContactEvent = mContactEvents.Count();
+		event.colliderB->mLastContactEvent = mContactEvents.Count();
+
+		return mContactEvents.Add(event);
+	}
+
+	void PhysicsWorld::DispatchContactEvent(int eventIdx, bool toColliderA)
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			// Event is taken again after each callback, because events can be changed
+			const ContactEvent& event = mContactEvents[eventIdx];
+
+			ICollider* collider = toColliderA ? event.colliderA : event.colliderB;
+			if (!collider)
+				return;
+
+			Actor* actor = collider->GetOwnerActor();
+			if (i == 1)
+			{
+				RigidBody* body = collider->GetRigidBody();
+				if (body == actor)
+					return;
+
+				actor = body;
+			}
+
+			if (!actor)
+				continue;
+
+			float direction = toColliderA ? 1.0f : -1.0f;
+
+			Collision collision;
+			collision.collider = collider;
+			collision.otherCollider = toColliderA ? event.colliderB : event.colliderA;
+			collision.point = event.point;
+			collision.normal = event.normal*direction;
+			collision.relativeVelocity = event.relativeVelocity*direction;
+
+			if (event.trigger)
+			{
+				if (event.begin)
+					actor->OnTriggerEnter(collision);
+				else
+					actor->OnTriggerExit(collision);
+			}
+			else
+			{
+				if (event.begin)
+					actor->OnCollisionEnter(collision);
+				else
+					actor->OnCollisionExit(collision);
+			}
+		}
+	}
+
+	void PhysicsWorld::OnColliderDestroyed(ICollider* collider)
+	{
+		int eventIdx = collider->mLastContactEvent;
+		while (eventIdx >= 0)
+		{
+			auto& event = mContactEvents[eventIdx];
+			if (event.colliderA == collider)
+			{
+				event.colliderA = nullptr;
+				eventIdx = event.prevEventA;
+			}
+			else
+			{
+				event.colliderB = nullptr;
+				eventIdx = event.prevEventB;
+			}
+		}
+
+		collider->mLastContactEvent = -1;
+	}
+
 	void PhysicsDebugDraw::DrawCircle(const b2Vec2& center, float32 radius, const b2Color& color)
 	{
 		float scale = o2Config.physics.scale;
@@ -1,49 +1,186 @@
 #pragma once
 
+#include "o2/Utils/Math/Rect.h"
+#include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
 #include "Box2D/Dynamics/b2World.h"
+#include "Box2D/Dynamics/b2WorldCallbacks.h"
 #include "Box2D/Common/b2Draw.h"
+#include "Box2D/Common/b2TaskExecutor.h"
 
 // Render physics macros
 #define o2Physics o2::PhysicsWorld::Instance()
 
 namespace o2
 {
-	// -------------------
-	// Box2D Physics world
-	// -------------------
-	class PhysicsWorld : public Singleton<PhysicsWorld>
+	class ICollider;
+	class RigidBody;
+
+	// ----------------------------------------------------------------------------------------------------
+	// Box2D Physics world. Queries take and return world coordinates and filter colliders by layers mask,
+	// where each collider layer name has own bit. Shared pool workers solve independent islands, find new contacts and
+	// process batched queries in parallel, simulation results don't depend on workers count. Contacts
+	// beginnings and endings are recorded during step and dispatched to actors after PostUpdate
+	// ----------------------------------------------------------------------------------------------------
+	class PhysicsWorld : public Singleton<PhysicsWorld>, public b2TaskExecutor, public b2ContactListener
 	{
+	public:
+		static const UInt allLayers = 0xFFFFFFFF; // Mask of all colliders layers
+		static const int  maxLayers = 32;         // Maximum count of colliders layers
+
+		// ---------------------------------------------------------
+		// Ray cast hit. Point and distance are in world coordinates
+		// ---------------------------------------------------------
+		struct RayCastHit
+		{
+			ICollider* collider = nullptr; // Hit collider, null when nothing was hit
+			RigidBody* body = nullptr;     // Hit collider's rigid body
+			Vec2F      point;              // Hit point
+			Vec2F      normal;             // Surface normal at hit point
+			float      distance = 0.0f;    // Distance from ray beginning to hit point
+		};
+
+		// --------------------------------------
+		// Ray cast query for batched ray casting
+		// --------------------------------------
+		struct RayCastQuery
+		{
+			Vec2F from;                   // Ray beginning
+			Vec2F to;                     // Ray ending
+			UInt  layersMask = allLayers; // Mask of colliders layers, which can be hit
+		};
+
 	public:
 		// Default constructor
 		PhysicsWorld();
 
-		// Synchronize physics bodies with actors
+		// Synchronize physics bodies with actors. Only bodies, which actors transforms were changed outside physics,
+		// are moved
 		void PreUpdate();
 
 		// Updates physics world and sync bodies
 		void Update(float dt);
 
-		// Synchronize actors with bodies
+		// Synchronize actors with bodies. Only awake non static bodies are synchronized, interpolated bodies are
+		// synchronized in Interpolate()
 		void PostUpdate();
 
+		// Dispatches recorded contact events to colliders actors and their rigid bodies: OnCollisionEnter/Exit for
+		// solid contacts, OnTriggerEnter/Exit when one of colliders is sensor. It is called in PostUpdate
+		void DispatchContactEvents();
+
+		// Sets interpolated bodies actors transforms between two last fixed steps. Coefficient is part of fixed step
+		// passed after last step, from 0 to 1
+		void Interpolate(float coef);
+
 		// Draws debug graphics
 		void DrawDebug();
 
 		// Returns True when PreUpdate has just called, until PostUpdate finished
 		bool IsUpdatingPhysicsNow() const;
 
+		// Returns layer bit mask by layer name. Registers new layer, returns 0 when there are too many layers
+		UInt GetLayerMask(const String& layer);
+
+		// Returns combined mask of layers
+		UInt GetLayersMask(const Vector<String>& layers);
+
+		// Casts ray and returns closest hit. Returns false when nothing was hit
+		bool RayCast(const Vec2F& from, const Vec2F& to, RayCastHit& hit, UInt layersMask = allLayers,
+					 bool includeSensors = false) const;
+
+		// Casts ray and returns all hits, sorted by distance
+		Vector<RayCastHit> RayCastAll(const Vec2F& from, const Vec2F& to, UInt layersMask = allLayers,
+									  bool includeSensors = false) const;
+
+		// Returns colliders, which bounds intersect rectangle
+		Vector<ICollider*> QueryRect(const RectF& rect, UInt layersMask = allLayers, bool includeSensors = true) const;
+
+		// Returns colliders, which shapes overlap circle
+		Vector<ICollider*> OverlapCircle(const Vec2F& center, float radius, UInt layersMask = allLayers,
+										 bool includeSensors = true) const;
+
+		// Casts rays in parallel on workers and main thread, hits are closest hits for each query. Must be called
+		// outside physics updating, when bodies aren't changing
+		void RayCastBatch(const Vector<RayCastQuery>& queries, Vector<RayCastHit>& hits, bool includeSensors = false);
+
+		// Sets max count of shared pool workers for physics step and batched queries. With zero workers everything
+		// is processed on main thread
+		void SetWorkersCount(int count);
+
+		// Returns max count of shared pool workers for physics step and batched queries
+		int GetWorkersCount() const;
+
+		// Returns count of threads running tasks: workers and main thread. It is used by Box2D
+		int32 GetThreadsCount() const override;
+
+		// Runs tasks on workers and main thread, returns when all tasks are finished. It is used by Box2D
+		void Run(b2Task task, void* context, int32 count) override;
+
+		// It is called by Box2D when two fixtures begin to touch, records contact event
+		void BeginContact(b2Contact* contact) override;
+
+		// It is called by Box2D when two fixtures cease to touch or contact is destroyed, records contact event
+		void EndContact(b2Contact* contact) override;
+
 	private:
+		// -----------------------------------------------------------------------------------------------
+		// Recorded contact event. Events with same collider are linked into list, so collider destruction
+		// nulls it in events without searching
+		// -----------------------------------------------------------------------------------------------
+		struct ContactEvent
+		{
+			ICollider* colliderA;        // First collider, null when destroyed
+			ICollider* colliderB;        // Second collider, null when destroyed
+			int        prevEventA;       // Index of previous event with first collider
+			int        prevEventB;       // Index of previous event with second collider
+			Vec2F      point;            // Contact point in world coordinates
+			Vec2F      normal;           // Contact normal from first collider to second
+			Vec2F      relativeVelocity; // Velocity of second collider relative to first at contact point
+			bool       begin;            // Is contact began, otherwise ended
+			bool       trigger;          // Is one of colliders sensor
+		};
+
+	private:
+		const int mQueriesPerTask = 64; // Count of queries processed by one batch task
+
 		b2World mWorld;
 
 		bool mIsUpdatingPhysicsNow = false; // True when PreUpdate has just called, until PostUpdate finished
 
 		float mPrevPhysicsScale = 0.0f; // Previous physics scale
 
+		Vector<RigidBody*> mDirtyBodies; // Bodies, which actors transforms were changed outside physics since last PreUpdate
+
+		Vector<String> mLayers; // Registered colliders layers names. Layer bit is index in this list
+
+		Vector<ContactEvent> mContactEvents; // Contact events, recorded since last dispatch. Capacity is kept between steps
+
+		const Vector<RayCastQuery>* mBatchQueries = nullptr;      // Current batch queries
+		Vector<RayCastHit>*         mBatchHits = nullptr;         // Current batch results
+		bool                        mBatchIncludeSensors = false; // Are sensors included in current batch
+
+		int mWorkersCount = 0; // Max count of shared pool workers for physics step and batched queries
+
 	private:
 		// Checks phsyics scale config; updates bodies and colliders with new scale
 		void CheckPhysicsScale();
 
+		// Ray casts batch task, processes mQueriesPerTask queries
+		static void RayCastBatchTask(void* context, int32 index, int32 threadIndex);
+
+		// Records contact event and links it with colliders events
+		ContactEvent& AddContactEvent(b2Contact* contact, bool begin);
+
+		// Calls contact event callbacks of collider's actor and its rigid body, when collider is on child actor
+		void DispatchContactEvent(int eventIdx, bool toColliderA);
+
+		// It is called when collider with not dispatched contact events is destroyed, nulls it in events
+		void OnColliderDestroyed(ICollider* collider);
+
+		friend class ICollider;
 		friend class RigidBody;
 	}; 
 	
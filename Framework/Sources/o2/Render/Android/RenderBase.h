@@ -12,6 +12,7 @@ namespace o2
 		GLuint   mStdShader;                      // Standard shader program
 		GLint    mStdShaderMvpUniform;            // Standard shader matrix input parameter
 		GLint    mStdShaderTextureSample;         // Standard shader texture sample input parameter
+		GLint    mStdShaderTextureModeUniform;    // Standard shader texture mode: 0 - color, 1 - alpha only, 2 - distance field
         GLint    mStdShaderPosAttribute;          // Standard shader vertex position attribute
         GLint    mStdShaderColorAttribute;        // Standard shader vertex color attribute
         GLint    mStdShaderUVAttribute;           // Standard shader texture coords attribute
@@ -12,6 +12,7 @@
 #include "Render/Texture.h"
 #include "Utils/Debug/Debug.h"
 #include "Utils/Debug/Log/LogStream.h"
+#include "Utils/Debug/Profiler.h"
 #include "Utils/Math/Geometry.h"
 #include "Utils/Math/Interpolation.h"
 #include "Application/Input.h"
@@ -38,7 +39,11 @@ namespace o2
 		glDisable(GL_DEPTH_TEST);
 		glDisable(GL_CULL_FACE);
 
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+        // Single channel and RGB textures rows aren't aligned by 4 bytes
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
 
         glLineWidth(1.0f);
 
@@ -172,10 +177,17 @@ namespace o2
         varying vec2 v_texCoords;                                       \n \
                                                                         \n \
         uniform sampler2D u_texture;                                    \n \
+        uniform int u_textureMode;                                      \n \
                                                                         \n \
         void main()                                                     \n \
         {                                                               \n \
-            gl_FragColor = v_color * texture2D(u_texture, v_texCoords); \n \
+            vec4 tex = texture2D(u_texture, v_texCoords);               \n \
+            if (u_textureMode == 1)                                     \n \
+                tex = vec4(1.0, 1.0, 1.0, tex.a);                       \n \
+            else if (u_textureMode == 2)                                \n \
+                tex = vec4(1.0, 1.0, 1.0, smoothstep(0.4, 0.6, tex.a)); \n \
+                                                                        \n \
+            gl_FragColor = v_color * tex;                               \n \
         }";
 
 		const char* vtxShader = " uniform mat4 u_transformMatrix; \n \
@@ -203,6 +215,9 @@ namespace o2
         mStdShaderTextureSample = glGetUniformLocation(mStdShader, "u_texture");
         GL_CHECK_ERROR();
 
+        mStdShaderTextureModeUniform = glGetUniformLocation(mStdShader, "u_textureMode");
+        GL_CHECK_ERROR();
+
         mStdShaderPosAttribute = glGetAttribLocation(mStdShader, "a_position");
         GL_CHECK_ERROR();
 
@@ -248,6 +263,8 @@ namespace o2
 		mDIPCount = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
+		BeginStatsFrame();
+
 		mDrawingDepth = 0.0f;
 
 		mScissorInfos.Clear();
@@ -264,11 +281,13 @@ namespace o2
 		preRender.Clear();
 	}
 
-	void Render::DrawPrimitives()
+	void Render::DrawPrimitives(BatchBreakReason reason)
 	{
 		if (mLastDrawVertex < 1)
 			return;
 
+		PROFILE_SCOPE("Render::DrawPrimitives");
+
 		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
 
         glBufferData(GL_ARRAY_BUFFER, mLastDrawVertex * sizeof(Vertex2), mVertexData, GL_DYNAMIC_DRAW);
@@ -278,6 +297,8 @@ namespace o2
 
 		GL_CHECK_ERROR();
 
+		AddStatsDrawCall(reason);
+
 		mFrameTrianglesCount += mTrianglesCount;
 		mLastDrawVertex = mTrianglesCount = mLastDrawIdx = 0;
 
@@ -298,7 +319,12 @@ namespace o2
 		postRender();
 		postRender.Clear();
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::FrameEnd);
+
+		PROFILE_COUNTER("Draw calls", mDIPCount);
+		PROFILE_COUNTER("Triangles", mFrameTrianglesCount);
+
+		EndStatsFrame();
 
 		GL_CHECK_ERROR();
 
@@ -343,7 +369,7 @@ namespace o2
 
 	void Render::UpdateCameraTransforms()
 	{
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Camera);
 
 		float projMat[16];
 		Math::OrthoProjMatrix(projMat, 0.0f, (float)mCurrentResolution.x, (float)mCurrentResolution.y, 0.0f, 0.0f, 10.0f);
@@ -384,7 +410,7 @@ namespace o2
 		if (mStencilDrawing || mStencilTest)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glEnable(GL_STENCIL_TEST);
 		glStencilFunc(GL_ALWAYS, 0x1, 0xffffffff);
@@ -401,7 +427,7 @@ namespace o2
 		if (!mStencilDrawing)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glDisable(GL_STENCIL_TEST);
 		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -416,7 +442,7 @@ namespace o2
 		if (mStencilTest || mStencilDrawing)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glEnable(GL_STENCIL_TEST);
 		glStencilFunc(GL_EQUAL, 0x1, 0xffffffff);
@@ -431,7 +457,7 @@ namespace o2
 		if (!mStencilTest)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glDisable(GL_STENCIL_TEST);
 
@@ -446,9 +472,31 @@ namespace o2
 		GL_CHECK_ERROR();
 	}
 
+	void Render::SetBlendMode(BlendMode mode)
+	{
+		if (mBlendMode == mode)
+			return;
+
+		DrawPrimitives(BatchBreakReason::BlendMode);
+
+		if (mode == BlendMode::Premultiplied)
+			glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+		else
+			glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+		GL_CHECK_ERROR();
+
+		mBlendMode = mode;
+	}
+
+	BlendMode Render::GetBlendMode() const
+	{
+		return mBlendMode;
+	}
+
 	void Render::EnableScissorTest(const RectI& rect)
 	{
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Scissor);
 
 		RectI summaryScissorRect = rect;
 		if (!mStackScissors.IsEmpty())
@@ -481,7 +529,7 @@ namespace o2
 			return;
 		}
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Scissor);
 
 		if (forcible)
 		{
@@ -538,22 +586,40 @@ namespace o2
 		else
 			indexesCount = elementsCount*3;
 
-		if (mLastDrawTexture != texture.mTexture ||
-			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
-			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
-			mCurrentPrimitiveType != primitiveType)
+		bool textureChanged = mLastDrawTexture != texture.mTexture;
+		bool bufferOverflow = mLastDrawVertex + verticesCount >= mVertexBufferSize ||
+			mLastDrawIdx + indexesCount >= mIndexBufferSize;
+
+		if (textureChanged || bufferOverflow || mCurrentPrimitiveType != primitiveType)
 		{
-			DrawPrimitives();
+			if (textureChanged)
+				DrawPrimitives(BatchBreakReason::TextureChange);
+			else if (bufferOverflow)
+				DrawPrimitives(BatchBreakReason::BufferOverflow);
+			else
+				DrawPrimitives(BatchBreakReason::PrimitiveType);
 
 			mLastDrawTexture = texture.mTexture;
 			mCurrentPrimitiveType = primitiveType;
 
+			if (textureChanged && mLastDrawTexture)
+				mStats.textureBinds++;
+
 			if (mLastDrawTexture)
 			{
 				glActiveTexture(GL_TEXTURE0);
 				glBindTexture(GL_TEXTURE_2D, mLastDrawTexture->mHandle);
 				glUniform1i(mStdShaderTextureSample, 0);
 
+				// Alpha textures are sampled with black color, color is taken from vertices
+				int textureMode = 0;
+				if (mLastDrawTexture->mDistanceField)
+					textureMode = 2;
+				else if (mLastDrawTexture->mFormat == PixelFormat::R8)
+					textureMode = 1;
+
+				glUniform1i(mStdShaderTextureModeUniform, textureMode);
+
 				GL_CHECK_ERROR();
 			}
 			else
@@ -561,11 +627,14 @@ namespace o2
 				glActiveTexture(GL_TEXTURE0);
 				glBindTexture(GL_TEXTURE_2D, 0);
 				glUniform1i(mStdShaderTextureSample, 0);
+				glUniform1i(mStdShaderTextureModeUniform, 1);
 
 				GL_CHECK_ERROR();
 			}
 		}
 
+		AddStatsGeometry(verticesCount, primitiveType != PrimitiveType::Line ? elementsCount : 0);
+
 		memcpy(&mVertexData[sizeof(Vertex2)*mLastDrawVertex], vertices, sizeof(Vertex2)*verticesCount);
 
 		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount * 3; i++, j++)
@@ -600,7 +669,8 @@ namespace o2
 			return;
 		}
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::RenderTarget);
+		mStats.renderTargetSwitches++;
 
 		if (!mStackScissors.IsEmpty())
 		{
@@ -624,7 +694,8 @@ namespace o2
 		if (!mCurrentRenderTarget)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::RenderTarget);
+		mStats.renderTargetSwitches++;
 
 		glBindFramebuffer(GL_FRAMEBUFFER, 0);
 		GL_CHECK_ERROR();
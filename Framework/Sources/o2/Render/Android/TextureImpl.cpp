@@ -44,6 +44,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (format == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (format == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, (GLsizei)size.x, (GLsizei)size.y, 0, texFormat, GL_UNSIGNED_BYTE, NULL);
 
@@ -104,6 +106,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, bitmap->GetSize().x, bitmap->GetSize().y, 0, texFormat, GL_UNSIGNED_BYTE,
 					 bitmap->GetData());
@@ -125,6 +129,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, bitmap->GetSize().x, bitmap->GetSize().y, 0, texFormat, GL_UNSIGNED_BYTE,
 					 bitmap->GetData());
@@ -141,6 +147,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, bitmap->GetSize().x, bitmap->GetSize().y, texFormat, GL_UNSIGNED_BYTE,
 						bitmap->GetData());
@@ -157,6 +165,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		//glCopyTexImage2D(mHandle, 0, texFormat, rect.left, rect.top, rect.Width(), rect.Height(), 0);
 	}
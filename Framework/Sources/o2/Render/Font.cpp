@@ -50,11 +50,19 @@ namespace o2
 	void Font::CheckCharacters(const WString& needChararacters, int height)
 	{}
 
+	void Font::SetPagesUsed(const Vector<int>& pages)
+	{}
+
 	String Font::GetFileName() const
 	{
 		return String();
 	}
 
+	TextureRef Font::GetPageTexture(int page) const
+	{
+		return mTexture;
+	}
+
 	void Font::AddCharacter(const Character& character)
 	{
 		mCharacters[character.mHeight][character.mId] = character;
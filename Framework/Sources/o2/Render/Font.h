@@ -50,21 +50,28 @@ namespace o2
 		// Checks characters for preloading
 		virtual void CheckCharacters(const WString& needChararacters, int height);
 
+		// Marks texture pages as used by next characters check, so they aren't evicted while it renders new characters
+		virtual void SetPagesUsed(const Vector<int>& pages);
+
 		// Returns font file name
 		virtual String GetFileName() const;
 
+		// Returns texture of characters page
+		virtual TextureRef GetPageTexture(int page) const;
+
 	protected:
 		// --------------------
 		// Character definition
 		// --------------------
 		struct Character
 		{
-			RectF  mTexSrc;  // texture source rect
-			Vec2F  mSize;    // Size of source rect
-			Vec2F  mOrigin;  // Symbol origin point
-			float  mAdvance; // Symbol advance
-			UInt16 mId;      // Character id
-			int    mHeight;  // Character height
+			RectF  mTexSrc;   // texture source rect
+			Vec2F  mSize;     // Size of source rect
+			Vec2F  mOrigin;   // Symbol origin point
+			float  mAdvance;  // Symbol advance
+			UInt16 mId;       // Character id
+			int    mHeight;   // Character height
+			int    mPage = 0; // Texture page index
 
 			bool operator==(const Character& other) const;
 		};
@@ -5,6 +5,10 @@
 
 namespace o2
 {
+	// ---------------------------------------------------------------------------------
+	// Single particle data. Emitter stores particles packed in ParticlesData, this is a
+	// copy of one particle from it
+	// ---------------------------------------------------------------------------------
 	class Particle
 	{
 	public:
@@ -15,13 +19,12 @@ namespace o2
 		Vec2F  size;       // Size of particle
 		Color4 color;      // Particle's color
 		float  time;       // Estimate life time
-		bool   alive;      // Is particle alive
 
 		bool operator==(const Particle& other) const
 		{
-			return position == position && velocity == velocity && Math::Equals(angle, other.angle) &&
+			return position == other.position && velocity == other.velocity && Math::Equals(angle, other.angle) &&
 				Math::Equals(angleSpeed, other.angleSpeed) && Math::Equals(time, other.time) && size == other.size &&
-				color == other.color && alive == other.alive;
+				color == other.color;
 		}
 	};
 }
@@ -0,0 +1,201 @@
+#include "o2/stdafx.h"
+#include "ParticlesData.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define PARTICLES_SSE
+#include <emmintrin.h>
+#endif
+
+namespace o2
+{
+	int ParticlesData::GetCount() const
+	{
+		return mCount;
+	}
+
+	int ParticlesData::GetCapacity() const
+	{
+		return mCapacity;
+	}
+
+	void ParticlesData::SetCapacity(int capacity)
+	{
+		mCapacity = Math::Max(capacity, 0);
+		mCount = Math::Min(mCount, mCapacity);
+
+		positionX.Resize(mCapacity);
+		positionY.Resize(mCapacity);
+		velocityX.Resize(mCapacity);
+		velocityY.Resize(mCapacity);
+		angle.Resize(mCapacity);
+		angleSpeed.Resize(mCapacity);
+		sizeX.Resize(mCapacity);
+		sizeY.Resize(mCapacity);
+		time.Resize(mCapacity);
+		lifetime.Resize(mCapacity);
+		color.Resize(mCapacity);
+		startSizeX.Resize(mCapacity);
+		startSizeY.Resize(mCapacity);
+		startColor.Resize(mCapacity);
+	}
+
+	int ParticlesData::Add(const Particle& particle)
+	{
+		if (mCount >= mCapacity)
+			return -1;
+
+		Set(mCount, particle);
+		return mCount++;
+	}
+
+	void ParticlesData::RemoveAt(int idx)
+	{
+		mCount--;
+
+		if (idx != mCount)
+			Move(mCount, idx);
+	}
+
+	void ParticlesData::Clear()
+	{
+		mCount = 0;
+	}
+
+	Particle ParticlesData::Get(int idx) const
+	{
+		Particle res;
+		res.position.Set(positionX[idx], positionY[idx]);
+		res.velocity.Set(velocityX[idx], velocityY[idx]);
+		res.angle = angle[idx];
+		res.angleSpeed = angleSpeed[idx];
+		res.size.Set(sizeX[idx], sizeY[idx]);
+		res.color.SetARGB(color[idx]);
+		res.time = time[idx];
+		return res;
+	}
+
+	void ParticlesData::Set(int idx, const Particle& particle)
+	{
+		positionX[idx] = particle.position.x;
+		positionY[idx] = particle.position.y;
+		velocityX[idx] = particle.velocity.x;
+		velocityY[idx] = particle.velocity.y;
+		angle[idx] = particle.angle;
+		angleSpeed[idx] = particle.angleSpeed;
+		sizeX[idx] = particle.size.x;
+		sizeY[idx] = particle.size.y;
+		color[idx] = particle.color.ARGB();
+		time[idx] = particle.time;
+		lifetime[idx] = particle.time;
+		startSizeX[idx] = particle.size.x;
+		startSizeY[idx] = particle.size.y;
+		startColor[idx] = color[idx];
+	}
+
+	float ParticlesData::GetAge(int idx) const
+	{
+		if (lifetime[idx] < FLT_EPSILON)
+			return 1.0f;
+
+		return Math::Clamp01(1.0f - time[idx]/lifetime[idx]);
+	}
+
+	bool ParticlesData::Integrate(float dt)
+	{
+		float* px = positionX.Data();
+		float* py = positionY.Data();
+		float* vx = velocityX.Data();
+		float* vy = velocityY.Data();
+		float* a = angle.Data();
+		float* as = angleSpeed.Data();
+		float* t = time.Data();
+
+		int i = 0;
+		bool anyDead = false;
+
+#ifdef PARTICLES_SSE
+		__m128 dt4 = _mm_set1_ps(dt);
+		__m128 zero4 = _mm_setzero_ps();
+		__m128 dead4 = _mm_setzero_ps();
+
+		for (; i + 4 <= mCount; i += 4)
+		{
+			_mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt4)));
+			_mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt4)));
+			_mm_storeu_ps(a + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_mul_ps(_mm_loadu_ps(as + i), dt4)));
+
+			__m128 t4 = _mm_sub_ps(_mm_loadu_ps(t + i), dt4);
+			_mm_storeu_ps(t + i, t4);
+			dead4 = _mm_or_ps(dead4, _mm_cmplt_ps(t4, zero4));
+		}
+
+		anyDead = _mm_movemask_ps(dead4) != 0;
+#endif
+
+		for (; i < mCount; i++)
+		{
+			px[i] += vx[i]*dt;
+			py[i] += vy[i]*dt;
+			a[i] += as[i]*dt;
+			t[i] -= dt;
+
+			anyDead |= t[i] < 0;
+		}
+
+		return anyDead;
+	}
+
+	void ParticlesData::RemoveDead()
+	{
+		for (int i = 0; i < mCount; )
+		{
+			if (time[i] < 0)
+				RemoveAt(i);
+			else
+				i++;
+		}
+	}
+
+	void ParticlesData::AddVelocity(const Vec2F& delta)
+	{
+		float* vx = velocityX.Data();
+		float* vy = velocityY.Data();
+
+		int i = 0;
+
+#ifdef PARTICLES_SSE
+		__m128 dx4 = _mm_set1_ps(delta.x);
+		__m128 dy4 = _mm_set1_ps(delta.y);
+
+		for (; i + 4 <= mCount; i += 4)
+		{
+			_mm_storeu_ps(vx + i, _mm_add_ps(_mm_loadu_ps(vx + i), dx4));
+			_mm_storeu_ps(vy + i, _mm_add_ps(_mm_loadu_ps(vy + i), dy4));
+		}
+#endif
+
+		for (; i < mCount; i++)
+		{
+			vx[i] += delta.x;
+			vy[i] += delta.y;
+		}
+	}
+
+	void ParticlesData::Move(int from, int to)
+	{
+		positionX[to] = positionX[from];
+		positionY[to] = positionY[from];
+		velocityX[to] = velocityX[from];
+		velocityY[to] = velocityY[from];
+		angle[to] = angle[from];
+		angleSpeed[to] = angleSpeed[from];
+		sizeX[to] = sizeX[from];
+		sizeY[to] = sizeY[from];
+		color[to] = color[from];
+		time[to] = time[from];
+		lifetime[to] = lifetime[from];
+		startSizeX[to] = startSizeX[from];
+		startSizeY[to] = startSizeY[from];
+		startColor[to] = startColor[from];
+	}
+}
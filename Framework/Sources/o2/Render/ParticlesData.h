@@ -0,0 +1,75 @@
+#pragma once
+
+#include "o2/Render/Particle.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+namespace o2
+{
+	// ---------------------------------------------------------------------------------------------
+	// Particles storage as structure of arrays. Alive particles are always packed at the beginning:
+	// removed particle is replaced with the last one, so there are no dead slots
+	// ---------------------------------------------------------------------------------------------
+	class ParticlesData
+	{
+	public:
+		Vector<float> positionX;  // Particles centers X
+		Vector<float> positionY;  // Particles centers Y
+		Vector<float> velocityX;  // Particles velocities X
+		Vector<float> velocityY;  // Particles velocities Y
+		Vector<float> angle;      // Particles angles in radians
+		Vector<float> angleSpeed; // Particles angle speeds in radians/sec
+		Vector<float> sizeX;      // Particles widths
+		Vector<float> sizeY;      // Particles heights
+		Vector<float> time;       // Particles estimate life times
+		Vector<float> lifetime;   // Particles life times from emitting
+		Vector<ULong> color;      // Particles colors in ARGB
+		Vector<float> startSizeX; // Particles widths at emitting
+		Vector<float> startSizeY; // Particles heights at emitting
+		Vector<ULong> startColor; // Particles colors in ARGB at emitting
+
+	public:
+		// Returns count of alive particles
+		int GetCount() const;
+
+		// Returns maximum count of particles
+		int GetCapacity() const;
+
+		// Sets maximum count of particles. Particles over capacity are removed
+		void SetCapacity(int capacity);
+
+		// Adds particle and returns it's index, or -1 when there is no space
+		int Add(const Particle& particle);
+
+		// Removes particle, last particle moves to it's place
+		void RemoveAt(int idx);
+
+		// Removes all particles
+		void Clear();
+
+		// Returns copy of particle
+		Particle Get(int idx) const;
+
+		// Sets particle data. Start size, color and life time are also taken from particle
+		void Set(int idx, const Particle& particle);
+
+		// Returns particle life time passed part in range 0...1
+		float GetAge(int idx) const;
+
+		// Moves and rotates particles and decreases their life time. Returns true when some particles are dead
+		bool Integrate(float dt);
+
+		// Removes particles with expired life time
+		void RemoveDead();
+
+		// Adds value to all particles velocities
+		void AddVelocity(const Vec2F& delta);
+
+	protected:
+		int mCount = 0;    // Count of alive particles
+		int mCapacity = 0; // Maximum count of particles
+
+	protected:
+		// Copies particle data from one index to another
+		void Move(int from, int to);
+	};
+}
@@ -8,19 +8,305 @@ namespace o2
 	void ParticlesEffect::Update(float dt, ParticlesEmitter* emitter)
 	{}
 
-	Vector<Particle>& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
+	ParticlesData& ParticlesEffect::GetParticlesDirect(ParticlesEmitter* emitter)
 	{
 		return emitter->mParticles;
 	}
 
+	float ParticlesEffect::GetLastUpdateDuration() const
+	{
+		return mLastUpdateDuration;
+	}
+
+	void ParticlesCurveTable::Bake(const Curve& curve, float scale /*= 1.0f*/)
+	{
+		int cacheKey = 0, cacheKeyApprox = 0;
+		for (int i = 0; i <= tableSize; i++)
+			mValues[i] = curve.Evaluate((float)i/(float)tableSize, true, cacheKey, cacheKeyApprox)*scale;
+
+		mValues[tableSize + 1] = mValues[tableSize];
+	}
+
+	float ParticlesCurveTable::Sample(float age) const
+	{
+		float position = Math::Clamp01(age)*(float)tableSize;
+		int idx = (int)position;
+		float coef = position - (float)idx;
+
+		return mValues[idx] + (mValues[idx + 1] - mValues[idx])*coef;
+	}
+
+	ParticlesOverLifetimeEffect::ParticlesOverLifetimeEffect()
+	{}
+
+	ParticlesOverLifetimeEffect::ParticlesOverLifetimeEffect(const ParticlesOverLifetimeEffect& other):
+		ParticlesEffect(other)
+	{}
+
+	void ParticlesOverLifetimeEffect::Update(float dt, ParticlesEmitter* emitter)
+	{
+		UpdateParticles(dt, GetParticlesDirect(emitter));
+	}
+
+	void ParticlesOverLifetimeEffect::SetCurvesChanged()
+	{
+		BakeCurves();
+	}
+
+	void ParticlesOverLifetimeEffect::BakeCurves()
+	{}
+
+	void ParticlesOverLifetimeEffect::UpdateParticles(float dt, ParticlesData& particles)
+	{}
+
+	void ParticlesOverLifetimeEffect::OnDeserialized(const DataValue& node)
+	{
+		BakeCurves();
+	}
+
 	void ParticlesGravityEffect::Update(float dt, ParticlesEmitter* emitter)
 	{
-		Vec2F v = gravity*dt;
-		for (auto& p : GetParticlesDirect(emitter))
-			p.velocity += v;
+		GetParticlesDirect(emitter).AddVelocity(gravity*dt);
+	}
+
+	ParticlesColorEffect::ParticlesColorEffect():
+		colorA(Color4::White()), colorB(Color4(255, 255, 255, 0)), gradient(Curve::Linear())
+	{
+		gradient.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	ParticlesColorEffect::ParticlesColorEffect(const ParticlesColorEffect& other):
+		ParticlesOverLifetimeEffect(other), colorA(other.colorA), colorB(other.colorB), gradient(other.gradient)
+	{
+		gradient.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	void ParticlesColorEffect::BakeCurves()
+	{
+		ParticlesCurveTable gradientTable;
+		gradientTable.Bake(gradient);
+
+		auto lerpChannel = [](int a, int b, float coef) { return Math::RoundToInt(Math::Lerp((float)a, (float)b, coef)); };
+
+		for (int i = 0; i <= ParticlesCurveTable::tableSize; i++)
+		{
+			float coef = Math::Clamp01(gradientTable.Sample((float)i/(float)ParticlesCurveTable::tableSize));
+			Color4 color(lerpChannel(colorA.r, colorB.r, coef), lerpChannel(colorA.g, colorB.g, coef),
+						 lerpChannel(colorA.b, colorB.b, coef), lerpChannel(colorA.a, colorB.a, coef));
+
+			mColors[i] = color.ARGB();
+		}
+	}
+
+	void ParticlesColorEffect::UpdateParticles(float dt, ParticlesData& particles)
+	{
+		int count = particles.GetCount();
+		ULong* colors = particles.color.Data();
+		const ULong* startColors = particles.startColor.Data();
+
+		for (int i = 0; i < count; i++)
+		{
+			ULong a = startColors[i];
+			ULong b = mColors[(int)(particles.GetAge(i)*(float)ParticlesCurveTable::tableSize + 0.5f)];
+
+			// Multiply each 8 bit channel, x*y/255 is approximated as (x*y + 255)/256
+			ULong res = 0;
+			for (int shift = 0; shift < 32; shift += 8)
+			{
+				ULong channel = ((a >> shift) & 0xff)*((b >> shift) & 0xff);
+				res |= (((channel + 255) >> 8) & 0xff) << shift;
+			}
+
+			colors[i] = res;
+		}
+	}
+
+	ParticlesSizeEffect::ParticlesSizeEffect():
+		size(Vector<Vec2F>({ Vec2F(0.0f, 1.0f), Vec2F(1.0f, 1.0f) }))
+	{
+		size.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	ParticlesSizeEffect::ParticlesSizeEffect(const ParticlesSizeEffect& other):
+		ParticlesOverLifetimeEffect(other), size(other.size)
+	{
+		size.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	void ParticlesSizeEffect::BakeCurves()
+	{
+		mSizeTable.Bake(size);
+	}
+
+	void ParticlesSizeEffect::UpdateParticles(float dt, ParticlesData& particles)
+	{
+		int count = particles.GetCount();
+		float* sizeX = particles.sizeX.Data();
+		float* sizeY = particles.sizeY.Data();
+		const float* startSizeX = particles.startSizeX.Data();
+		const float* startSizeY = particles.startSizeY.Data();
+
+		for (int i = 0; i < count; i++)
+		{
+			float coef = mSizeTable.Sample(particles.GetAge(i));
+			sizeX[i] = startSizeX[i]*coef;
+			sizeY[i] = startSizeY[i]*coef;
+		}
+	}
+
+	ParticlesAngleSpeedEffect::ParticlesAngleSpeedEffect():
+		angleSpeed(Vector<Vec2F>({ Vec2F(0.0f, 0.0f), Vec2F(1.0f, 0.0f) }))
+	{
+		angleSpeed.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	ParticlesAngleSpeedEffect::ParticlesAngleSpeedEffect(const ParticlesAngleSpeedEffect& other):
+		ParticlesOverLifetimeEffect(other), angleSpeed(other.angleSpeed)
+	{
+		angleSpeed.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	void ParticlesAngleSpeedEffect::BakeCurves()
+	{
+		mAngleSpeedTable.Bake(angleSpeed, Math::Deg2rad(1.0f));
+	}
+
+	void ParticlesAngleSpeedEffect::UpdateParticles(float dt, ParticlesData& particles)
+	{
+		int count = particles.GetCount();
+		float* angleSpeeds = particles.angleSpeed.Data();
+
+		for (int i = 0; i < count; i++)
+			angleSpeeds[i] = mAngleSpeedTable.Sample(particles.GetAge(i));
+	}
+
+	ParticlesVelocityDampingEffect::ParticlesVelocityDampingEffect():
+		damping(Vector<Vec2F>({ Vec2F(0.0f, 1.0f), Vec2F(1.0f, 1.0f) }))
+	{
+		damping.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	ParticlesVelocityDampingEffect::ParticlesVelocityDampingEffect(const ParticlesVelocityDampingEffect& other):
+		ParticlesOverLifetimeEffect(other), damping(other.damping)
+	{
+		damping.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	void ParticlesVelocityDampingEffect::BakeCurves()
+	{
+		mDampingTable.Bake(damping);
+	}
+
+	void ParticlesVelocityDampingEffect::UpdateParticles(float dt, ParticlesData& particles)
+	{
+		int count = particles.GetCount();
+		float* velocityX = particles.velocityX.Data();
+		float* velocityY = particles.velocityY.Data();
+
+		for (int i = 0; i < count; i++)
+		{
+			float coef = Math::Max(0.0f, 1.0f - mDampingTable.Sample(particles.GetAge(i))*dt);
+			velocityX[i] *= coef;
+			velocityY[i] *= coef;
+		}
+	}
+
+	ParticlesNoiseEffect::ParticlesNoiseEffect():
+		strengthScale(Vector<Vec2F>({ Vec2F(0.0f, 1.0f), Vec2F(1.0f, 1.0f) }))
+	{
+		strengthScale.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	ParticlesNoiseEffect::ParticlesNoiseEffect(const ParticlesNoiseEffect& other):
+		ParticlesOverLifetimeEffect(other), strength(other.strength), frequency(other.frequency),
+		scrollSpeed(other.scrollSpeed), strengthScale(other.strengthScale), mTime(other.mTime)
+	{
+		strengthScale.onKeysChanged += THIS_FUNC(SetCurvesChanged);
+
+		BakeCurves();
+	}
+
+	void ParticlesNoiseEffect::BakeCurves()
+	{
+		mStrengthTable.Bake(strengthScale);
+	}
+
+	void ParticlesNoiseEffect::UpdateParticles(float dt, ParticlesData& particles)
+	{
+		mTime += dt*scrollSpeed;
+
+		int count = particles.GetCount();
+		const float* positionX = particles.positionX.Data();
+		const float* positionY = particles.positionY.Data();
+		float* velocityX = particles.velocityX.Data();
+		float* velocityY = particles.velocityY.Data();
+
+		float force = strength*dt;
+
+		for (int i = 0; i < count; i++)
+		{
+			float x = positionX[i]*frequency + mTime;
+			float y = positionY[i]*frequency - mTime;
+			float coef = mStrengthTable.Sample(particles.GetAge(i))*force;
+
+			velocityX[i] += Noise(x, y)*coef;
+			velocityY[i] += Noise(x + 31.7f, y + 17.3f)*coef;
+		}
+	}
+
+	float ParticlesNoiseEffect::Noise(float x, float y)
+	{
+		auto hash = [](int ix, int iy)
+		{
+			UInt h = (UInt)ix*374761393u + (UInt)iy*668265263u;
+			h = (h ^ (h >> 13))*1274126177u;
+			return (float)((h ^ (h >> 16)) & 0xffff)/32767.5f - 1.0f;
+		};
+
+		float fx = Math::Floor(x), fy = Math::Floor(y);
+		int ix = (int)fx, iy = (int)fy;
+
+		float tx = x - fx, ty = y - fy;
+		tx = tx*tx*(3.0f - 2.0f*tx);
+		ty = ty*ty*(3.0f - 2.0f*ty);
+
+		float bottom = Math::Lerp(hash(ix, iy), hash(ix + 1, iy), tx);
+		float top = Math::Lerp(hash(ix, iy + 1), hash(ix + 1, iy + 1), tx);
+
+		return Math::Lerp(bottom, top, ty);
 	}
 }
 
 DECLARE_CLASS(o2::ParticlesEffect);
 
+DECLARE_CLASS(o2::ParticlesOverLifetimeEffect);
+
 DECLARE_CLASS(o2::ParticlesGravityEffect);
+
+DECLARE_CLASS(o2::ParticlesColorEffect);
+
+DECLARE_CLASS(o2::ParticlesSizeEffect);
+
+DECLARE_CLASS(o2::ParticlesAngleSpeedEffect);
+
+DECLARE_CLASS(o2::ParticlesVelocityDampingEffect);
+
+DECLARE_CLASS(o2::ParticlesNoiseEffect);
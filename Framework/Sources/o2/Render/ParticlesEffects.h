@@ -1,7 +1,8 @@
 #pragma once
 
 #include "o2/Utils/Serialization/Serializable.h"
-#include "o2/Render/Particle.h"
+#include "o2/Render/ParticlesData.h"
+#include "o2/Utils/Math/Curve.h"
 
 namespace o2
 {
@@ -16,9 +17,72 @@ namespace o2
 
 	public:
 		virtual void Update(float dt, ParticlesEmitter* emitter);
-		Vector<Particle>& GetParticlesDirect(ParticlesEmitter* emitter);
+		ParticlesData& GetParticlesDirect(ParticlesEmitter* emitter);
+
+		// Returns duration of last update in seconds
+		float GetLastUpdateDuration() const;
+
+	protected:
+		float mLastUpdateDuration = 0.0f; // Duration of last update in seconds
+
+		friend class ParticlesEmitter;
 	};
 
+	// --------------------------------------------------------------------------------------
+	// Curve baked into lookup table by particle age in range 0...1. Curve keys positions are
+	// particle age too. Sampling is linear interpolation between two table values
+	// --------------------------------------------------------------------------------------
+	class ParticlesCurveTable
+	{
+	public:
+		static const int tableSize = 64; // Count of table segments
+
+	public:
+		// Bakes curve values into table, values are multiplied by scale
+		void Bake(const Curve& curve, float scale = 1.0f);
+
+		// Returns baked value by particle age in range 0...1
+		float Sample(float age) const;
+
+	protected:
+		float mValues[tableSize + 2]; // Baked values. Last value is duplicated for sampling without range check
+	};
+
+	// ------------------------------------------------------------------------------------------------
+	// Particles effect with curves by particle age. Curves are baked into tables when they are changed
+	// ------------------------------------------------------------------------------------------------
+	class ParticlesOverLifetimeEffect: public ParticlesEffect
+	{
+		SERIALIZABLE(ParticlesOverLifetimeEffect);
+
+	public:
+		// Default constructor
+		ParticlesOverLifetimeEffect();
+
+		// Copy-constructor. Derived effects bake curves in their constructors
+		ParticlesOverLifetimeEffect(const ParticlesOverLifetimeEffect& other);
+
+		// Updates particles with baked tables. Doesn't change tables, so it is safe on worker thread
+		void Update(float dt, ParticlesEmitter* emitter) override;
+
+		// Bakes curves again. It is called when curves keys are changed, call it on main thread after
+		// changing other baked parameters, like colors
+		void SetCurvesChanged();
+
+	protected:
+		// Bakes curves into tables
+		virtual void BakeCurves();
+
+		// Updates particles with baked tables
+		virtual void UpdateParticles(float dt, ParticlesData& particles);
+
+		// It is called when object was deserialized, bakes curves
+		void OnDeserialized(const DataValue& node) override;
+	};
+
+	// -----------------------------------------------
+	// Particles gravity effect. Accelerates particles
+	// -----------------------------------------------
 	class ParticlesGravityEffect : public ParticlesEffect
 	{
 		SERIALIZABLE(ParticlesGravityEffect);
@@ -29,6 +93,159 @@ namespace o2
 	public:
 		void Update(float dt, ParticlesEmitter* emitter) override;
 	};
+
+	// ---------------------------------------------------------------------------------------------
+	// Color over lifetime effect. Particle color is emitted color multiplied by color from gradient
+	// between colorA and colorB
+	// ---------------------------------------------------------------------------------------------
+	class ParticlesColorEffect: public ParticlesOverLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesColorEffect);
+
+	public:
+		Color4 colorA;   // Gradient begin color @SERIALIZABLE
+		Color4 colorB;   // Gradient end color @SERIALIZABLE
+		Curve  gradient; // Gradient coefficient from colorA to colorB by particle age @SERIALIZABLE
+
+	public:
+		// Default constructor
+		ParticlesColorEffect();
+
+		// Copy-constructor
+		ParticlesColorEffect(const ParticlesColorEffect& other);
+
+	protected:
+		ULong mColors[ParticlesCurveTable::tableSize + 1]; // Baked gradient colors in ARGB
+
+	protected:
+		// Bakes gradient colors
+		void BakeCurves() override;
+
+		// Updates particles colors
+		void UpdateParticles(float dt, ParticlesData& particles) override;
+	};
+
+	// ----------------------------------------------------------------------------
+	// Size over lifetime effect. Particle size is emitted size multiplied by curve
+	// ----------------------------------------------------------------------------
+	class ParticlesSizeEffect: public ParticlesOverLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesSizeEffect);
+
+	public:
+		Curve size; // Size multiplier by particle age @SERIALIZABLE
+
+	public:
+		// Default constructor
+		ParticlesSizeEffect();
+
+		// Copy-constructor
+		ParticlesSizeEffect(const ParticlesSizeEffect& other);
+
+	protected:
+		ParticlesCurveTable mSizeTable; // Baked size curve
+
+	protected:
+		// Bakes size curve
+		void BakeCurves() override;
+
+		// Updates particles sizes
+		void UpdateParticles(float dt, ParticlesData& particles) override;
+	};
+
+	// ------------------------------------------------------------------------
+	// Rotation speed over lifetime effect. Sets particles angle speed by curve
+	// ------------------------------------------------------------------------
+	class ParticlesAngleSpeedEffect: public ParticlesOverLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesAngleSpeedEffect);
+
+	public:
+		Curve angleSpeed; // Angle speed in degrees/sec by particle age @SERIALIZABLE
+
+	public:
+		// Default constructor
+		ParticlesAngleSpeedEffect();
+
+		// Copy-constructor
+		ParticlesAngleSpeedEffect(const ParticlesAngleSpeedEffect& other);
+
+	protected:
+		ParticlesCurveTable mAngleSpeedTable; // Baked angle speed curve in radians/sec
+
+	protected:
+		// Bakes angle speed curve
+		void BakeCurves() override;
+
+		// Updates particles angle speeds
+		void UpdateParticles(float dt, ParticlesData& particles) override;
+	};
+
+	// -------------------------------------------------------------------------------------
+	// Velocity damping over lifetime effect. Particles velocities are decreasing by damping
+	// coefficient from curve in 1/sec
+	// -------------------------------------------------------------------------------------
+	class ParticlesVelocityDampingEffect: public ParticlesOverLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesVelocityDampingEffect);
+
+	public:
+		Curve damping; // Damping coefficient by particle age @SERIALIZABLE
+
+	public:
+		// Default constructor
+		ParticlesVelocityDampingEffect();
+
+		// Copy-constructor
+		ParticlesVelocityDampingEffect(const ParticlesVelocityDampingEffect& other);
+
+	protected:
+		ParticlesCurveTable mDampingTable; // Baked damping curve
+
+	protected:
+		// Bakes damping curve
+		void BakeCurves() override;
+
+		// Updates particles velocities
+		void UpdateParticles(float dt, ParticlesData& particles) override;
+	};
+
+	// ---------------------------------------------------------------------------------------------
+	// Turbulence effect. Accelerates particles by smooth noise field, moving with time. Noise force
+	// is scaled by curve by particle age
+	// ---------------------------------------------------------------------------------------------
+	class ParticlesNoiseEffect: public ParticlesOverLifetimeEffect
+	{
+		SERIALIZABLE(ParticlesNoiseEffect);
+
+	public:
+		float strength = 50.0f;   // Noise acceleration @SERIALIZABLE
+		float frequency = 0.02f;  // Noise field frequency, inverted noise cell size @SERIALIZABLE
+		float scrollSpeed = 1.0f; // Noise field changing speed @SERIALIZABLE
+		Curve strengthScale;      // Noise strength multiplier by particle age @SERIALIZABLE
+
+	public:
+		// Default constructor
+		ParticlesNoiseEffect();
+
+		// Copy-constructor
+		ParticlesNoiseEffect(const ParticlesNoiseEffect& other);
+
+	protected:
+		ParticlesCurveTable mStrengthTable; // Baked strength multiplier curve
+
+		float mTime = 0.0f; // Noise field time
+
+	protected:
+		// Bakes strength multiplier curve
+		void BakeCurves() override;
+
+		// Updates particles velocities
+		void UpdateParticles(float dt, ParticlesData& particles) override;
+
+		// Returns smooth value noise in range -1...1
+		static float Noise(float x, float y);
+	};
 }
 
 CLASS_BASES_META(o2::ParticlesEffect)
@@ -38,13 +255,35 @@ CLASS_BASES_META(o2::ParticlesEffect)
 END_META;
 CLASS_FIELDS_META(o2::ParticlesEffect)
 {
+	PROTECTED_FIELD(mLastUpdateDuration).DEFAULT_VALUE(0.0f);
 }
 END_META;
 CLASS_METHODS_META(o2::ParticlesEffect)
 {
 
 	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
-	PUBLIC_FUNCTION(Vector<Particle>&, GetParticlesDirect, ParticlesEmitter*);
+	PUBLIC_FUNCTION(ParticlesData&, GetParticlesDirect, ParticlesEmitter*);
+	PUBLIC_FUNCTION(float, GetLastUpdateDuration);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesOverLifetimeEffect)
+{
+	BASE_CLASS(o2::ParticlesEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesOverLifetimeEffect)
+{
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesOverLifetimeEffect)
+{
+
+	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
+	PUBLIC_FUNCTION(void, SetCurvesChanged);
+	PROTECTED_FUNCTION(void, BakeCurves);
+	PROTECTED_FUNCTION(void, UpdateParticles, float, ParticlesData&);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 }
 END_META;
 
@@ -64,3 +303,105 @@ CLASS_METHODS_META(o2::ParticlesGravityEffect)
 	PUBLIC_FUNCTION(void, Update, float, ParticlesEmitter*);
 }
 END_META;
+
+CLASS_BASES_META(o2::ParticlesColorEffect)
+{
+	BASE_CLASS(o2::ParticlesOverLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesColorEffect)
+{
+	PUBLIC_FIELD(colorA).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(colorB).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(gradient).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mColors);
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesColorEffect)
+{
+
+	PROTECTED_FUNCTION(void, BakeCurves);
+	PROTECTED_FUNCTION(void, UpdateParticles, float, ParticlesData&);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesSizeEffect)
+{
+	BASE_CLASS(o2::ParticlesOverLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesSizeEffect)
+{
+	PUBLIC_FIELD(size).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mSizeTable);
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesSizeEffect)
+{
+
+	PROTECTED_FUNCTION(void, BakeCurves);
+	PROTECTED_FUNCTION(void, UpdateParticles, float, ParticlesData&);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesAngleSpeedEffect)
+{
+	BASE_CLASS(o2::ParticlesOverLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesAngleSpeedEffect)
+{
+	PUBLIC_FIELD(angleSpeed).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mAngleSpeedTable);
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesAngleSpeedEffect)
+{
+
+	PROTECTED_FUNCTION(void, BakeCurves);
+	PROTECTED_FUNCTION(void, UpdateParticles, float, ParticlesData&);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesVelocityDampingEffect)
+{
+	BASE_CLASS(o2::ParticlesOverLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesVelocityDampingEffect)
+{
+	PUBLIC_FIELD(damping).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mDampingTable);
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesVelocityDampingEffect)
+{
+
+	PROTECTED_FUNCTION(void, BakeCurves);
+	PROTECTED_FUNCTION(void, UpdateParticles, float, ParticlesData&);
+}
+END_META;
+
+CLASS_BASES_META(o2::ParticlesNoiseEffect)
+{
+	BASE_CLASS(o2::ParticlesOverLifetimeEffect);
+}
+END_META;
+CLASS_FIELDS_META(o2::ParticlesNoiseEffect)
+{
+	PUBLIC_FIELD(strength).DEFAULT_VALUE(50.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(frequency).DEFAULT_VALUE(0.02f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(scrollSpeed).DEFAULT_VALUE(1.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(strengthScale).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mStrengthTable);
+	PROTECTED_FIELD(mTime).DEFAULT_VALUE(0.0f);
+}
+END_META;
+CLASS_METHODS_META(o2::ParticlesNoiseEffect)
+{
+
+	PROTECTED_FUNCTION(void, BakeCurves);
+	PROTECTED_FUNCTION(void, UpdateParticles, float, ParticlesData&);
+	PROTECTED_STATIC_FUNCTION(float, Noise, float, float);
+}
+END_META;
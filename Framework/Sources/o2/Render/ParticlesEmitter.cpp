@@ -4,6 +4,8 @@
 #include "o2/Render/Mesh.h"
 #include "o2/Render/ParticlesEffects.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
+#include "o2/Render/ParticlesSystem.h"
+#include "o2/Utils/System/Time/Timer.h"
 
 namespace o2
 {
@@ -12,11 +14,16 @@ namespace o2
 	{
 		mShape = mnew CircleParticlesEmitterShape();
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mParticles.SetCapacity(mParticlesNumLimit);
 		mLastTransform = mTransform;
+		mRandom.SetSeed(GetNextRandomSeed());
 	}
 
 	ParticlesEmitter::~ParticlesEmitter()
 	{
+		if (mUpdateScheduled && ParticlesSystem::IsSingletonInitialzed())
+			o2Particles.CancelUpdate(this);
+
 		delete mParticlesMesh;
 
 		for (auto effect : mEffects)
@@ -41,11 +48,13 @@ namespace o2
 		image(this), shape(this)
 	{
 		mParticlesMesh = mnew Mesh(NoTexture(), mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mParticles.SetCapacity(mParticlesNumLimit);
 
 		for (auto effect : other.mEffects)
 			AddEffect(effect->CloneAs<ParticlesEffect>());
 
 		mLastTransform = mTransform;
+		mRandom.SetSeed(GetNextRandomSeed());
 	}
 
 	ParticlesEmitter& ParticlesEmitter::operator=(const ParticlesEmitter& other)
@@ -53,18 +62,7 @@ namespace o2
 		RemoveAllEffects();
 		delete mShape;
 
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (particle.alive)
-			{
-				mDeadParticles.Add(idx);
-				particle.alive = false;
-			}
-
-			idx++;
-		}
-		mNumAliveParticles = 0;
+		mParticles.Clear();
 
 		IRectDrawable::operator=(other);
 
@@ -107,6 +105,9 @@ namespace o2
 		mParticlesMesh->vertexCount = 0;
 		mParticlesMesh->polyCount = 0;
 		mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		mMeshIndexedParticles = 0;
+
+		mParticles.SetCapacity(mParticlesNumLimit);
 
 		mLastTransform = mTransform;
 
@@ -123,6 +124,53 @@ namespace o2
 		if (!mEnabled)
 			return;
 
+		UpdateBuffers();
+		UpdateSimulation(dt);
+	}
+
+	void ParticlesEmitter::UpdateBuffers()
+	{
+		if (mParticles.GetCapacity() != mParticlesNumLimit)
+			mParticles.SetCapacity(mParticlesNumLimit);
+
+		// Mesh indexes are 16 bit, particles over this limit aren't drawn
+		const int maxMeshParticles = 0x10000/4;
+		int meshParticlesLimit = Math::Min(mParticlesNumLimit, maxMeshParticles);
+
+		if (mParticlesMesh->GetMaxVertexCount() < (UInt)meshParticlesLimit*4)
+		{
+			mParticlesMesh->Resize(meshParticlesLimit*4, meshParticlesLimit*2);
+			mMeshIndexedParticles = 0;
+		}
+
+		Vec2F invTexSize(1.0f, 1.0f);
+		if (mParticlesMesh->GetTexture())
+		{
+			invTexSize.Set(1.0f/mParticlesMesh->GetTexture()->GetSize().x,
+						   1.0f/mParticlesMesh->GetTexture()->GetSize().y);
+		}
+
+		RectF textureSrcRect;
+		if (mImageAsset)
+			textureSrcRect = mImageAsset->GetAtlasRect();
+
+		mUVLeft = textureSrcRect.left*invTexSize.x;
+		mUVRight = textureSrcRect.right*invTexSize.x;
+		mUVUp = 1.0f - textureSrcRect.bottom*invTexSize.y;
+		mUVDown = 1.0f - textureSrcRect.top*invTexSize.y;
+	}
+
+	UInt ParticlesEmitter::GetNextRandomSeed()
+	{
+		static UInt createdEmitters = 0;
+		createdEmitters++;
+
+		// Spread consecutive numbers over whole range, neighbor emitters must not get similar sequences
+		return createdEmitters*0x9E3779B9u;
+	}
+
+	void ParticlesEmitter::UpdateSimulation(float dt)
+	{
 		if (mPlaying)
 		{
 			mCurrentTime += dt;
@@ -160,36 +208,27 @@ namespace o2
 		float halfAngleSpeedRange = mEmitParticlesAngleSpeedRange*0.5f;
 		while (mEmitTimeBuffer > particlesDelay)
 		{
-			if (mNumAliveParticles < mParticlesNumLimit)
+			if (mParticles.GetCount() < mParticles.GetCapacity())
 			{
-				Particle* p;
-
-				if (mDeadParticles.IsEmpty())
-				{
-					mParticles.Add(Particle());
-					p = &mParticles.Last();
-				}
-				else p = &mParticles[mDeadParticles.PopBack()];
-
-				p->position = Local2WorldPoint(mShape->GetEmittinPoint());
-				p->angle = mEmitParticlesAngle + Math::Random(-halfAngleRange, halfAngleRange);
+				Particle particle;
+				particle.position = Local2WorldPoint(mShape->GetEmittinPoint(mRandom));
+				particle.angle = mEmitParticlesAngle + mRandom.Random(-halfAngleRange, halfAngleRange);
 
-				p->size.Set(mEmitParticlesSize.x + Math::Random(-halfSizeRange.x, halfSizeRange.x),
-							mEmitParticlesSize.y + Math::Random(-halfSizeRange.y, halfSizeRange.y));
+				particle.size.Set(mEmitParticlesSize.x + mRandom.Random(-halfSizeRange.x, halfSizeRange.x),
+								  mEmitParticlesSize.y + mRandom.Random(-halfSizeRange.y, halfSizeRange.y));
 
-				p->velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + Math::Random(-halfDirRange, halfDirRange))*
-					(mEmitParticlesSpeed + Math::Random(-halfSpeedRange, halfSpeedRange));
+				particle.velocity = Vec2F::Rotated(mEmitParticlesMoveDirection + mRandom.Random(-halfDirRange, halfDirRange))*
+					(mEmitParticlesSpeed + mRandom.Random(-halfSpeedRange, halfSpeedRange));
 
-				p->angleSpeed = mEmitParticlesAngleSpeed + Math::Random(-halfAngleSpeedRange, halfAngleSpeedRange);
+				particle.angleSpeed = mEmitParticlesAngleSpeed + mRandom.Random(-halfAngleSpeedRange, halfAngleSpeedRange);
 
-				p->color.r = Math::Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
-				p->color.g = Math::Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
-				p->color.b = Math::Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
-				p->color.a = Math::Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
-				p->time = mParticlesLifetime;
-				p->alive = true;
+				particle.color.r = mRandom.Random(mEmitParticlesColorA.r, mEmitParticlesColorB.r);
+				particle.color.g = mRandom.Random(mEmitParticlesColorA.g, mEmitParticlesColorB.g);
+				particle.color.b = mRandom.Random(mEmitParticlesColorA.b, mEmitParticlesColorB.b);
+				particle.color.a = mRandom.Random(mEmitParticlesColorA.a, mEmitParticlesColorB.a);
+				particle.time = mParticlesLifetime;
 
-				mNumAliveParticles++;
+				mParticles.Add(particle);
 			}
 
 			mEmitTimeBuffer -= particlesDelay;
@@ -198,90 +237,69 @@ namespace o2
 
 	void ParticlesEmitter::UpdateEffects(float dt)
 	{
+		Timer timer;
 		for (auto effect : mEffects)
 		{
-			if (effect)
-				effect->Update(dt, this);
+			if (!effect)
+				continue;
+
+			effect->Update(dt, this);
+			effect->mLastUpdateDuration = timer.GetDeltaTime();
 		}
 	}
 
 	void ParticlesEmitter::UpdateParticles(float dt)
 	{
-		int idx = 0;
-		for (auto& particle : mParticles)
-		{
-			if (!particle.alive)
-			{
-				idx++;
-				continue;
-			}
-
-			particle.position += particle.velocity*dt;
-			particle.angle += particle.angleSpeed*dt;
-			particle.time -= dt;
-
-			if (particle.time < 0)
-			{
-				particle.alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		if (mParticles.Integrate(dt))
+			mParticles.RemoveDead();
 	}
 
 	void ParticlesEmitter::UpdateMesh()
 	{
-		if (mParticlesMesh->GetMaxVertexCount() < (UInt)mParticlesNumLimit*4)
-			mParticlesMesh->Resize(mParticlesNumLimit*4, mParticlesNumLimit*2);
+		int count = Math::Min(mParticles.GetCount(), (int)mParticlesMesh->GetMaxVertexCount()/4);
 
-		mParticlesMesh->vertexCount = 0;
-		mParticlesMesh->polyCount = 0;
-		int polyIndex = 0;
-
-		Vec2F invTexSize(1.0f, 1.0f);
-		if (mParticlesMesh->GetTexture())
+		// Quads indexes are the same every frame, fill only new ones
+		UInt16* indexes = mParticlesMesh->indexes + mMeshIndexedParticles*6;
+		for (int i = mMeshIndexedParticles; i < count; i++, indexes += 6)
 		{
-			invTexSize.Set(1.0f/mParticlesMesh->GetTexture()->GetSize().x,
-						   1.0f/mParticlesMesh->GetTexture()->GetSize().y);
+			UInt16 vertex = (UInt16)(i*4);
+
+			indexes[0] = vertex;
+			indexes[1] = vertex + 1;
+			indexes[2] = vertex + 2;
+
+			indexes[3] = vertex;
+			indexes[4] = vertex + 2;
+			indexes[5] = vertex + 3;
 		}
 
-		RectF textureSrcRect;
-		if (mImageAsset)
-			textureSrcRect = mImageAsset->GetAtlasRect();
+		mMeshIndexedParticles = Math::Max(mMeshIndexedParticles, count);
 
-		float uvLeft = textureSrcRect.left*invTexSize.x;
-		float uvRight = textureSrcRect.right*invTexSize.x;
-		float uvUp = 1.0f - textureSrcRect.bottom*invTexSize.y;
-		float uvDown = 1.0f - textureSrcRect.top*invTexSize.y;
+		const float* positionX = mParticles.positionX.Data();
+		const float* positionY = mParticles.positionY.Data();
+		const float* angle = mParticles.angle.Data();
+		const float* sizeX = mParticles.sizeX.Data();
+		const float* sizeY = mParticles.sizeY.Data();
+		const ULong* color = mParticles.color.Data();
 
-		for (auto& particle : mParticles)
+		Vertex2* vertices = mParticlesMesh->vertices;
+		for (int i = 0; i < count; i++, vertices += 4)
 		{
-			if (!particle.alive)
-				continue;
-
-			float sn = Math::Sin(particle.angle), cs = Math::Cos(particle.angle);
-			Vec2F hs = particle.size*0.5f;
-			Vec2F xv(cs*hs.x, sn*hs.x);
-			Vec2F yv(-sn*hs.y, cs*hs.y);
-			Vec2F o(particle.position);
-			ULong colr = particle.color.ARGB();
-
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv + yv, colr, uvLeft, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv + yv, colr, uvRight, uvUp);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o + xv - yv, colr, uvRight, uvDown);
-			mParticlesMesh->vertices[mParticlesMesh->vertexCount++].Set(o - xv - yv, colr, uvLeft, uvDown);
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 3;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 4;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 2;
-			mParticlesMesh->indexes[polyIndex++] = mParticlesMesh->vertexCount - 1;
-			mParticlesMesh->polyCount += 2;
+			float sn = Math::Sin(angle[i]), cs = Math::Cos(angle[i]);
+			float hx = sizeX[i]*0.5f, hy = sizeY[i]*0.5f;
+			float xvx = cs*hx, xvy = sn*hx;
+			float yvx = -sn*hy, yvy = cs*hy;
+			float ox = positionX[i], oy = positionY[i];
+			ULong colr = color[i];
+
+			vertices[0].Set(ox - xvx + yvx, oy - xvy + yvy, colr, mUVLeft, mUVUp);
+			vertices[1].Set(ox + xvx + yvx, oy + xvy + yvy, colr, mUVRight, mUVUp);
+			vertices[2].Set(ox + xvx - yvx, oy + xvy - yvy, colr, mUVRight, mUVDown);
+			vertices[3].Set(ox - xvx - yvx, oy - xvy - yvy, colr, mUVLeft, mUVDown);
 		}
+
+		mParticlesMesh->vertexCount = count*4;
+		mParticlesMesh->polyCount = count*2;
 	}
 
 	void ParticlesEmitter::BasisChanged()
@@ -290,8 +308,14 @@ namespace o2
 			return;
 
 		Basis change = mLastTransform.Inverted()*mTransform;
-		for (auto& particle : mParticles)
-			particle.position = change.Transform(particle.position);
+		float* positionX = mParticles.positionX.Data();
+		float* positionY = mParticles.positionY.Data();
+		for (int i = 0; i < mParticles.GetCount(); i++)
+		{
+			Vec2F position = change.Transform(Vec2F(positionX[i], positionY[i]));
+			positionX[i] = position.x;
+			positionY[i] = position.y;
+		}
 
 		mLastTransform = mTransform;
 	}
@@ -381,19 +405,7 @@ namespace o2
 	void ParticlesEmitter::SetMaxParticles(int count)
 	{
 		mParticlesNumLimit = count;
-
-		int idx = 0;
-		while (mNumAliveParticles > mParticlesNumLimit)
-		{
-			if (mParticles[idx].alive)
-			{
-				mParticles[idx].alive = false;
-				mDeadParticles.Add(idx);
-				mNumAliveParticles--;
-			}
-
-			idx++;
-		}
+		mParticles.SetCapacity(mParticlesNumLimit);
 	}
 
 	int ParticlesEmitter::GetMaxParticles() const
@@ -403,15 +415,15 @@ namespace o2
 
 	int ParticlesEmitter::GetParticlesCount() const
 	{
-		return mNumAliveParticles;
+		return mParticles.GetCount();
 	}
 
 	bool ParticlesEmitter::IsAliveParticles() const
 	{
-		return mNumAliveParticles > 0;
+		return mParticles.GetCount() > 0;
 	}
 
-	const Vector<Particle>& ParticlesEmitter::GetParticles() const
+	const ParticlesData& ParticlesEmitter::GetParticles() const
 	{
 		return mParticles;
 	}
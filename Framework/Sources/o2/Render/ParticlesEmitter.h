@@ -1,7 +1,7 @@
 #pragma once
 
 #include "o2/Assets/Types/ImageAsset.h"
-#include "o2/Render/Particle.h"
+#include "o2/Render/ParticlesData.h"
 #include "o2/Render/ParticlesEmitterShapes.h"
 #include "o2/Render/RectDrawable.h"
 #include "o2/Utils/Math/Curve.h"
@@ -124,8 +124,8 @@ namespace o2
 		// Returns has alive particles
 		bool IsAliveParticles() const;
 
-		// Returns particles list
-		const Vector<Particle>& GetParticles() const;
+		// Returns packed alive particles
+		const ParticlesData& GetParticles() const;
 
 		// Sets particles relativity
 		void SetParticlesRelativity(bool relative);
@@ -270,15 +270,32 @@ namespace o2
 		Color4 mEmitParticlesColorA; // Emitting particles color A (particle emitting with color in range from this and ColorB)  @SERIALIZABLE
 		Color4 mEmitParticlesColorB; // Emitting particles color B (particle emitting with color in range from this and ColorA) @SERIALIZABLE
 
-		float            mCurrentTime = 0;         // Current working time in seconds
-		float            mEmitTimeBuffer = 0;      // Emitting next particle time buffer
-		Mesh*            mParticlesMesh = nullptr; // Particles mesh
-		Vector<Particle> mParticles;               // Working particles
-		Vector<int>      mDeadParticles;           // Dead particles indexes
-		int              mNumAliveParticles = 0;   // Count of current alive particles
-		Basis            mLastTransform;           // Last transformation
+		float         mCurrentTime = 0;          // Current working time in seconds
+		float         mEmitTimeBuffer = 0;       // Emitting next particle time buffer
+		Mesh*         mParticlesMesh = nullptr;  // Particles mesh
+		int           mMeshIndexedParticles = 0; // Count of particles quads with filled mesh indexes
+		ParticlesData mParticles;                // Working particles, packed
+		Basis         mLastTransform;            // Last transformation
+
+		Math::XorShiftRandom mRandom; // Own random generator: emitting runs on worker threads, where global rand() isn't safe
+
+		float mUVLeft = 0.0f;  // Particle quad left texture coordinate
+		float mUVRight = 1.0f; // Particle quad right texture coordinate
+		float mUVUp = 1.0f;    // Particle quad up texture coordinate
+		float mUVDown = 0.0f;  // Particle quad down texture coordinate
+
+		bool mUpdateScheduled = false; // Is update scheduled in particles system
 
 	protected:
+		// Returns seed for next created emitter. Emitters are created on main thread, so seeds are reproducible
+		static UInt GetNextRandomSeed();
+
+		// Resizes particles and mesh buffers and updates texture coordinates. Must be called on main thread
+		void UpdateBuffers();
+
+		// Emits and updates particles, builds mesh. Doesn't allocate memory, can be called from worker thread
+		void UpdateSimulation(float dt);
+
 		// Emits particles hen updating
 		void UpdateEmitting(float dt);
 
@@ -295,6 +312,7 @@ namespace o2
 		void BasisChanged();
 
 		friend class ParticlesEffect;
+		friend class ParticlesSystem;
 	};
 
 	template<typename _type, typename ... _args>
@@ -359,10 +377,15 @@ CLASS_FIELDS_META(o2::ParticlesEmitter)
 	PROTECTED_FIELD(mCurrentTime).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mEmitTimeBuffer).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mParticlesMesh).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mMeshIndexedParticles).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mParticles);
-	PROTECTED_FIELD(mDeadParticles);
-	PROTECTED_FIELD(mNumAliveParticles).DEFAULT_VALUE(0);
 	PROTECTED_FIELD(mLastTransform);
+	PROTECTED_FIELD(mRandom);
+	PROTECTED_FIELD(mUVLeft).DEFAULT_VALUE(0.0f);
+	PROTECTED_FIELD(mUVRight).DEFAULT_VALUE(1.0f);
+	PROTECTED_FIELD(mUVUp).DEFAULT_VALUE(1.0f);
+	PROTECTED_FIELD(mUVDown).DEFAULT_VALUE(0.0f);
+	PROTECTED_FIELD(mUpdateScheduled).DEFAULT_VALUE(false);
 }
 END_META;
 CLASS_METHODS_META(o2::ParticlesEmitter)
@@ -388,7 +411,7 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(int, GetMaxParticles);
 	PUBLIC_FUNCTION(int, GetParticlesCount);
 	PUBLIC_FUNCTION(bool, IsAliveParticles);
-	PUBLIC_FUNCTION(const Vector<Particle>&, GetParticles);
+	PUBLIC_FUNCTION(const ParticlesData&, GetParticles);
 	PUBLIC_FUNCTION(void, SetParticlesRelativity, bool);
 	PUBLIC_FUNCTION(bool, IsParticlesRelative);
 	PUBLIC_FUNCTION(void, SetLoop, bool);
@@ -425,6 +448,9 @@ CLASS_METHODS_META(o2::ParticlesEmitter)
 	PUBLIC_FUNCTION(Color4, GetEmitParticlesColorB);
 	PUBLIC_FUNCTION(void, SetEmitParticlesColor, const Color4&);
 	PUBLIC_FUNCTION(void, SetEmitParticlesColor, const Color4&, const Color4&);
+	PROTECTED_STATIC_FUNCTION(UInt, GetNextRandomSeed);
+	PROTECTED_FUNCTION(void, UpdateBuffers);
+	PROTECTED_FUNCTION(void, UpdateSimulation, float);
 	PROTECTED_FUNCTION(void, UpdateEmitting, float);
 	PROTECTED_FUNCTION(void, UpdateEffects, float);
 	PROTECTED_FUNCTION(void, UpdateParticles, float);
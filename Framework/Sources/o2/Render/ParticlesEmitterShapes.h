@@ -13,7 +13,8 @@ namespace o2
 
 	public:
 		virtual ~ParticlesEmitterShape() {}
-		virtual Vec2F GetEmittinPoint();
+		// Returns random emitting point. Uses emitter's random generator, because it can be called from worker thread
+		virtual Vec2F GetEmittinPoint(Math::XorShiftRandom& random);
 	};
 
 	// ---------------------------------
@@ -26,7 +27,7 @@ namespace o2
 	public:
 		float radius = 0;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(Math::XorShiftRandom& random);
 	};
 
 	// ---------------------------------
@@ -39,7 +40,7 @@ namespace o2
 	public:
 		Vec2F size;
 
-		Vec2F GetEmittinPoint();
+		Vec2F GetEmittinPoint(Math::XorShiftRandom& random);
 	};
 }
 
@@ -55,7 +56,7 @@ END_META;
 CLASS_METHODS_META(o2::ParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, Math::XorShiftRandom&);
 }
 END_META;
 
@@ -72,7 +73,7 @@ END_META;
 CLASS_METHODS_META(o2::CircleParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, Math::XorShiftRandom&);
 }
 END_META;
 
@@ -89,6 +90,6 @@ END_META;
 CLASS_METHODS_META(o2::SquareParticlesEmitterShape)
 {
 
-	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint);
+	PUBLIC_FUNCTION(Vec2F, GetEmittinPoint, Math::XorShiftRandom&);
 }
 END_META;
@@ -0,0 +1,75 @@
+#include "o2/stdafx.h"
+#include "ParticlesSystem.h"
+
+#include "o2/Render/ParticlesEmitter.h"
+#include "o2/Utils/Tasks/WorkersPool.h"
+
+namespace o2
+{
+	DECLARE_SINGLETON(ParticlesSystem);
+
+	ParticlesSystem::ParticlesSystem()
+	{
+		mWorkersCount = o2Workers.GetWorkersCount();
+	}
+
+	void ParticlesSystem::ScheduleUpdate(ParticlesEmitter* emitter, float dt)
+	{
+		if (!emitter->mEnabled || emitter->mUpdateScheduled)
+			return;
+
+		Job job;
+		job.emitter = emitter;
+		job.dt = dt;
+		mJobs.Add(job);
+
+		emitter->mUpdateScheduled = true;
+	}
+
+	void ParticlesSystem::CancelUpdate(ParticlesEmitter* emitter)
+	{
+		if (!emitter->mUpdateScheduled)
+			return;
+
+		mJobs.RemoveFirst([=](const Job& job) { return job.emitter == emitter; });
+		emitter->mUpdateScheduled = false;
+	}
+
+	void ParticlesSystem::UpdateScheduled()
+	{
+		if (mJobs.IsEmpty())
+			return;
+
+		// Buffers allocations and textures references aren't thread safe, prepare them here
+		for (auto& job : mJobs)
+		{
+			job.emitter->mUpdateScheduled = false;
+			job.emitter->UpdateBuffers();
+		}
+
+		if (mWorkersCount == 0 || mJobs.Count() < mMinParallelJobs)
+		{
+			for (auto& job : mJobs)
+				job.emitter->UpdateSimulation(job.dt);
+		}
+		else
+		{
+			o2Workers.Run(mJobs.Count(), [&](int index, int threadIndex)
+			{
+				mJobs[index].emitter->UpdateSimulation(mJobs[index].dt);
+			}, mWorkersCount);
+		}
+
+		mJobs.Clear();
+	}
+
+	void ParticlesSystem::SetWorkersCount(int count)
+	{
+		mWorkersCount = Math::Max(count, 0);
+	}
+
+	int ParticlesSystem::GetWorkersCount() const
+	{
+		return mWorkersCount;
+	}
+}
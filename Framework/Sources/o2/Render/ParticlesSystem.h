@@ -0,0 +1,58 @@
+#pragma once
+
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+
+// Particles system access macros
+#define o2Particles o2::ParticlesSystem::Instance()
+
+namespace o2
+{
+	class ParticlesEmitter;
+
+	// ---------------------------------------------------------------------------------------------
+	// Particles system. Collects emitters updates during frame and updates them together as parallel
+	// jobs on shared pool workers and main thread. Particles effects of scheduled emitters must not
+	// change shared state, because they are updated on worker threads
+	// ---------------------------------------------------------------------------------------------
+	class ParticlesSystem: public Singleton<ParticlesSystem>
+	{
+	public:
+		// Schedules emitter update, it will be updated in UpdateScheduled()
+		void ScheduleUpdate(ParticlesEmitter* emitter, float dt);
+
+		// Removes emitter from scheduled updates
+		void CancelUpdate(ParticlesEmitter* emitter);
+
+		// Updates all scheduled emitters. Returns when all of them are updated
+		void UpdateScheduled();
+
+		// Sets max count of shared pool workers, updating emitters. With zero workers emitters are updated only on main thread
+		void SetWorkersCount(int count);
+
+		// Returns max count of shared pool workers, updating emitters
+		int GetWorkersCount() const;
+
+	protected:
+		// ----------------------------
+		// Scheduled emitter update job
+		// ----------------------------
+		struct Job
+		{
+			ParticlesEmitter* emitter = nullptr; // Updating emitter
+			float             dt = 0.0f;         // Update delta time
+		};
+
+	protected:
+		const int mMinParallelJobs = 4; // Minimal count of scheduled emitters, when updating on workers begins
+
+		int         mWorkersCount = 0; // Max count of shared pool workers, updating emitters
+		Vector<Job> mJobs;             // Scheduled updates
+
+	protected:
+		// Default constructor
+		ParticlesSystem();
+
+		friend class Application;
+	};
+}
@@ -75,6 +75,99 @@ namespace o2
 		return mDIPCount;
 	}
 
+	const RenderStats& Render::GetStats() const
+	{
+		return GetStatsHistory(0);
+	}
+
+	const RenderStats& Render::GetCurrentStats() const
+	{
+		return mStats;
+	}
+
+	int Render::GetStatsHistoryCount() const
+	{
+		return Math::Min(mStatsHistoryCount, statsHistoryLength);
+	}
+
+	const RenderStats& Render::GetStatsHistory(int framesAgo) const
+	{
+		static const RenderStats emptyStats;
+
+		if (framesAgo < 0 || framesAgo >= GetStatsHistoryCount())
+			return emptyStats;
+
+		return mStatsHistory[(mStatsHistoryCount - 1 - framesAgo)%statsHistoryLength];
+	}
+
+	void Render::SetStatsCamera(const String& name)
+	{
+		mStatsCameraIdx = name.IsEmpty() ? -1 : RenderStats::GetGroupIndex(mStats.cameras, name);
+	}
+
+	String Render::GetStatsCamera() const
+	{
+		return mStatsCameraIdx < 0 ? String() : mStats.cameras[mStatsCameraIdx].name;
+	}
+
+	void Render::SetStatsLayer(const String& name)
+	{
+		mStatsLayerIdx = name.IsEmpty() ? -1 : RenderStats::GetGroupIndex(mStats.layers, name);
+	}
+
+	String Render::GetStatsLayer() const
+	{
+		return mStatsLayerIdx < 0 ? String() : mStats.layers[mStatsLayerIdx].name;
+	}
+
+	void Render::BeginStatsFrame()
+	{
+		mStats.Reset();
+		mStatsCameraIdx = mStatsLayerIdx = -1;
+		mBatchCameraIdx = mBatchLayerIdx = -1;
+	}
+
+	void Render::EndStatsFrame()
+	{
+		mStatsHistory[mStatsHistoryCount%statsHistoryLength] = mStats;
+		mStatsHistoryCount++;
+	}
+
+	void Render::AddStatsGeometry(UInt verticesCount, UInt trianglesCount)
+	{
+		if (mLastDrawVertex == 0)
+		{
+			mBatchCameraIdx = mStatsCameraIdx;
+			mBatchLayerIdx = mStatsLayerIdx;
+		}
+
+		if (mStatsCameraIdx >= 0)
+		{
+			mStats.cameras[mStatsCameraIdx].vertices += verticesCount;
+			mStats.cameras[mStatsCameraIdx].triangles += trianglesCount;
+		}
+
+		if (mStatsLayerIdx >= 0)
+		{
+			mStats.layers[mStatsLayerIdx].vertices += verticesCount;
+			mStats.layers[mStatsLayerIdx].triangles += trianglesCount;
+		}
+	}
+
+	void Render::AddStatsDrawCall(BatchBreakReason reason)
+	{
+		mStats.drawCalls++;
+		mStats.triangles += mTrianglesCount;
+		mStats.vertices += mLastDrawVertex;
+		mStats.batchBreaks[(int)reason]++;
+
+		if (mBatchCameraIdx >= 0)
+			mStats.cameras[mBatchCameraIdx].drawCalls++;
+
+		if (mBatchLayerIdx >= 0)
+			mStats.layers[mBatchLayerIdx].drawCalls++;
+	}
+
 	void Render::SetCamera(const Camera& camera)
 	{
 		mCamera = camera;
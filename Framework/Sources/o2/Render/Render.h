@@ -10,6 +10,7 @@
 #endif
 
 #include "o2/Render/Camera.h"
+#include "o2/Render/RenderStats.h"
 #include "o2/Render/TextureRef.h"
 #include "o2/Utils/Math/Vertex2.h"
 #include "o2/Utils/Singleton.h"
@@ -24,6 +25,16 @@ namespace o2
 	class Sprite;
 	class CursorAreaEventListenersLayer;
 
+	// ---------------------------------------------------------------------------------------------
+	// Colors blending mode. Render textures, cleared with transparent color and drawn in Normal
+	// mode, accumulate premultiplied colors and must be drawn further in Premultiplied mode
+	// ---------------------------------------------------------------------------------------------
+	enum class BlendMode
+	{
+		Normal,        // Straight alpha colors: src*srcAlpha + dst*(1 - srcAlpha), target alpha accumulated as srcAlpha + dstAlpha*(1 - srcAlpha)
+		Premultiplied  // Premultiplied alpha colors: src + dst*(1 - srcAlpha)
+	};
+
 	// ------------------
 	// 2D Graphics render
 	// ------------------
@@ -73,6 +84,9 @@ namespace o2
 		Function<void()> preRender;  // Pre rendering event. Call after beginning drawing. Clearing every frame
 		Function<void()> postRender; // Post rendering event. Call before ending drawing. Clearing every frame
 
+	public:
+		static const int statsHistoryLength = 120; // Count of last frames, which statistics are stored
+
 	public:
 		// Default constructor
 		Render();
@@ -101,6 +115,30 @@ namespace o2
 		// Returns draw calls count at last frame
 		int GetDrawCallsCount();
 
+		// Returns statistics of last finished frame
+		const RenderStats& GetStats() const;
+
+		// Returns statistics of current frame, collected at this moment
+		const RenderStats& GetCurrentStats() const;
+
+		// Returns count of frames in statistics history
+		int GetStatsHistoryCount() const;
+
+		// Returns statistics of finished frame from history. 0 is last finished frame
+		const RenderStats& GetStatsHistory(int framesAgo) const;
+
+		// Sets camera name for statistics breakdown. Following drawing is accounted to it. Empty name resets camera
+		void SetStatsCamera(const String& name);
+
+		// Returns camera name for statistics breakdown
+		String GetStatsCamera() const;
+
+		// Sets layer name for statistics breakdown. Following drawing is accounted to it. Empty name resets layer
+		void SetStatsLayer(const String& name);
+
+		// Returns layer name for statistics breakdown
+		String GetStatsLayer() const;
+
 		// Binding camera. NULL - standard camera
 		void SetCamera(const Camera& camera);
 
@@ -212,6 +250,12 @@ namespace o2
 		// Clearing stencil buffer
 		void ClearStencil();
 
+		// Sets colors blending mode
+		void SetBlendMode(BlendMode mode);
+
+		// Returns colors blending mode
+		BlendMode GetBlendMode() const;
+
 		// Returns scissor rect
 		RectI GetScissorRect() const;
 
@@ -284,6 +328,14 @@ namespace o2
 		UInt     mFrameTrianglesCount;       // Total triangles at current frame
 		UInt     mDIPCount;                  // DrawIndexedPrimitives calls count
 
+		RenderStats mStats;                            // Current frame statistics
+		RenderStats mStatsHistory[statsHistoryLength]; // Ring of finished frames statistics
+		int         mStatsHistoryCount = 0;            // Count of finished frames with statistics
+		int         mStatsCameraIdx = -1;              // Current camera index in statistics breakdown
+		int         mStatsLayerIdx = -1;               // Current layer index in statistics breakdown
+		int         mBatchCameraIdx = -1;              // Camera index in statistics breakdown, where current batch was started
+		int         mBatchLayerIdx = -1;               // Layer index in statistics breakdown, where current batch was started
+
 		LogStream* mLog; // Render log stream
 
 		Vector<Texture*> mTextures; // Loaded textures
@@ -302,6 +354,8 @@ namespace o2
 		bool mStencilDrawing; // True, if drawing in stencil buffer
 		bool mStencilTest;    // True, if drawing with stencil test
 
+		BlendMode mBlendMode = BlendMode::Normal; // Current colors blending mode
+
 		Vector<ScissorInfo>       mScissorInfos;       // Scissor clipping depth infos vector
 		Vector<ScissorStackEntry> mStackScissors;      // Stack of scissors clippings
 		bool                      mClippingEverything; // Is everything clipped
@@ -343,7 +397,19 @@ namespace o2
 		void OnFrameResized();
 
 		// Send buffers to draw
-		void DrawPrimitives();
+		void DrawPrimitives(BatchBreakReason reason);
+
+		// Resets current frame statistics
+		void BeginStatsFrame();
+
+		// Stores current frame statistics into history
+		void EndStatsFrame();
+
+		// Accounts geometry added into batch. Remembers breakdown groups when batch is started
+		void AddStatsGeometry(UInt verticesCount, UInt trianglesCount);
+
+		// Accounts sent batch
+		void AddStatsDrawCall(BatchBreakReason reason);
 
 		// Sets orthographic view matrix by view size
 		void SetupViewMatrix(const Vec2I& viewSize);
@@ -0,0 +1,45 @@
+#include "o2/stdafx.h"
+#include "RenderStats.h"
+
+namespace o2
+{
+	void RenderStats::Reset()
+	{
+		drawCalls = 0;
+		triangles = 0;
+		vertices = 0;
+		textureBinds = 0;
+		renderTargetSwitches = 0;
+
+		for (auto& count : batchBreaks)
+			count = 0;
+
+		cameras.Clear();
+		layers.Clear();
+	}
+
+	int RenderStats::GetGroupIndex(Vector<Group>& groups, const String& name)
+	{
+		for (int i = 0; i < groups.Count(); i++)
+		{
+			if (groups[i].name == name)
+				return i;
+		}
+
+		Group group;
+		group.name = name;
+		groups.Add(group);
+
+		return groups.Count() - 1;
+	}
+
+	const char* RenderStats::GetBatchBreakReasonName(BatchBreakReason reason)
+	{
+		static const char* names[(int)BatchBreakReason::Count] = {
+			"Texture change", "Primitive type", "Buffer overflow", "Scissor", "Stencil", "Render target", "Camera",
+			"Texture update", "Blend mode", "Frame end"
+		};
+
+		return names[(int)reason];
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+namespace o2
+{
+	// ----------------------------------------------------
+	// Reason of sending accumulated geometry batch to draw
+	// ----------------------------------------------------
+	enum class BatchBreakReason
+	{
+		TextureChange,  // Next geometry uses another texture
+		PrimitiveType,  // Next geometry uses another primitive type
+		BufferOverflow, // Vertex or index buffer is full
+		Scissor,        // Scissor clipping changed
+		Stencil,        // Stencil drawing or test changed
+		RenderTarget,   // Render target changed
+		Camera,         // Camera transformation changed
+		TextureUpdate,  // Texture parameters or data changed
+		BlendMode,      // Colors blending mode changed
+		FrameEnd,       // Frame finished
+
+		Count
+	};
+
+	// ----------------------------------------------------------------------------------
+	// Render statistics of one frame: draw calls, geometry, state changes and breakdowns
+	// ----------------------------------------------------------------------------------
+	struct RenderStats
+	{
+		// -----------------------------------------
+		// Statistics of frame part: camera or layer
+		// -----------------------------------------
+		struct Group
+		{
+			String name;          // Camera or layer name
+			UInt   drawCalls = 0; // Draw calls of batches, started in group
+			UInt   triangles = 0; // Triangles drawn in group
+			UInt   vertices = 0;  // Vertices drawn in group
+		};
+
+		UInt drawCalls = 0;            // Draw calls count
+		UInt triangles = 0;            // Drawn triangles count
+		UInt vertices = 0;             // Uploaded vertices count
+		UInt textureBinds = 0;         // Texture binds count
+		UInt renderTargetSwitches = 0; // Render target binds and unbinds count
+
+		UInt batchBreaks[(int)BatchBreakReason::Count] = {}; // Draw calls count by reason of batch break
+
+		Vector<Group> cameras; // Statistics by cameras
+		Vector<Group> layers;  // Statistics by scene layers
+
+	public:
+		// Resets all counters and breakdowns
+		void Reset();
+
+		// Returns index of group with name in groups, adds new group if it isn't exist
+		static int GetGroupIndex(Vector<Group>& groups, const String& name);
+
+		// Returns readable batch break reason name
+		static const char* GetBatchBreakReasonName(BatchBreakReason reason);
+	};
+}
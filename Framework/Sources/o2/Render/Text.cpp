@@ -97,6 +97,7 @@ namespace o2
 		mWordWrap = other.mWordWrap;
 		mDotsEndings = other.mDotsEndings;
 		mHeight = other.mHeight;
+		mTextCharactersChecked = false;
 
 		if (mFont)
 			mFont->onCharactersRebuilt += ObjFunctionPtr<Text, void>(this, &Text::CheckCharactersAndRebuildMesh);
@@ -128,6 +129,7 @@ namespace o2
 			mFont->onCharactersRebuilt -= ObjFunctionPtr<Text, void>(this, &Text::CheckCharactersAndRebuildMesh);
 
 		mFont = font;
+		mTextCharactersChecked = false;
 
 		if (mFont)
 			mFont->onCharactersRebuilt += ObjFunctionPtr<Text, void>(this, &Text::CheckCharactersAndRebuildMesh);
@@ -155,6 +157,8 @@ namespace o2
 		else
 			mFont = FontRef();
 
+		mTextCharactersChecked = false;
+
 		if (mFont)
 		{
 			mFont->onCharactersRebuilt += ObjFunctionPtr<Text, void>(this, &Text::CheckCharactersAndRebuildMesh);
@@ -174,6 +178,7 @@ namespace o2
 	void Text::SetHeight(int height)
 	{
 		mHeight = height;
+		mTextCharactersChecked = false;
 	}
 
 	int Text::GetHeight() const
@@ -183,12 +188,34 @@ namespace o2
 
 	void Text::SetText(const WString& text)
 	{
+		// Characters of unchanged parts are already checked, only changed part is checked
+		int checkBegin = 0, checkEnd = text.Length();
+		if (mTextCharactersChecked)
+		{
+			int maxCommonLen = Math::Min(text.Length(), mText.Length());
+			while (checkBegin < maxCommonLen && text[checkBegin] == mText[checkBegin])
+				checkBegin++;
+
+			int suffixLen = 0;
+			while (suffixLen < maxCommonLen - checkBegin && text[checkEnd - 1 - suffixLen] == mText[mText.Length() - 1 - suffixLen])
+				suffixLen++;
+
+			checkEnd -= suffixLen;
+		}
+
 		mText = text;
 
 		if (mFont)
 		{
-			mFont->CheckCharacters(text, height);
+			// Pages of unchanged characters aren't touched by partial check, they are marked used explicitly
+			if (mTextCharactersChecked)
+				mFont->SetPagesUsed(mUsedPages);
+
+			if (checkEnd > checkBegin)
+				mFont->CheckCharacters(text.SubStr(checkBegin, checkEnd), height);
+
 			mFont->CheckCharacters(".", height);
+			mTextCharactersChecked = true;
 		}
 
 		UpdateMesh();
@@ -337,50 +364,95 @@ namespace o2
 		Basis transf = CalculateTextBasis();
 		mLastTransform = transf;
 
+		// Symbols from different font pages are placed into different meshes, page by page
+		int lastPage = 0;
+		mUsedPages.Clear();
 		for (auto& line : mSymbolsSet.mLines)
 		{
 			for (auto& symb : line.mSymbols)
 			{
-				if (currentMesh->polyCount + 2 >= currentMesh->GetMaxPolyCount())
-					currentMesh = mMeshes[currentMeshIdx++];
+				lastPage = Math::Max(lastPage, symb.mPage);
 
-				unsigned long color = mColor.ABGR();
-				Vec2F points[4] =
-				{
-					transf.Transform(symb.mFrame.LeftTop() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.RightTop() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.RightBottom() - mSymbolsSet.mPosition),
-					transf.Transform(symb.mFrame.LeftBottom() - mSymbolsSet.mPosition)
-				};
-
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[0], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.top);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[1], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.top);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[2], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.bottom);
-				currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[3], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.bottom);
-
-				int pp = currentMesh->polyCount*3;
-				currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
-				currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 3;
-				currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 2;
-				currentMesh->polyCount++;
-
-				pp += 3;
-				currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
-				currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 2;
-				currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 1;
-				currentMesh->polyCount++;
+				if (!mUsedPages.Contains(symb.mPage))
+					mUsedPages.Add(symb.mPage);
 			}
 		}
 
-		currentMesh->SetTexture(mFont->mTexture);
+		unsigned long color = mColor.ABGR();
+
+		for (int page = 0; page <= lastPage; page++)
+		{
+			TextureRef pageTexture = mFont->GetPageTexture(page);
+
+			if (currentMesh->polyCount > 0)
+				currentMesh = GetNextMesh(currentMeshIdx, pageTexture, textLen);
+			else
+				currentMesh->SetTexture(pageTexture);
+
+			for (auto& line : mSymbolsSet.mLines)
+			{
+				for (auto& symb : line.mSymbols)
+				{
+					if (symb.mPage != page)
+						continue;
+
+					if (currentMesh->polyCount + 2 > currentMesh->GetMaxPolyCount())
+						currentMesh = GetNextMesh(currentMeshIdx, pageTexture, textLen);
+
+					Vec2F points[4] =
+					{
+						transf.Transform(symb.mFrame.LeftTop() - mSymbolsSet.mPosition),
+						transf.Transform(symb.mFrame.RightTop() - mSymbolsSet.mPosition),
+						transf.Transform(symb.mFrame.RightBottom() - mSymbolsSet.mPosition),
+						transf.Transform(symb.mFrame.LeftBottom() - mSymbolsSet.mPosition)
+					};
+
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[0], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.top);
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[1], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.top);
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[2], color, symb.mTexSrc.right, 1.0f - symb.mTexSrc.bottom);
+					currentMesh->vertices[currentMesh->vertexCount++] = Vertex2(points[3], color, symb.mTexSrc.left, 1.0f - symb.mTexSrc.bottom);
+
+					int pp = currentMesh->polyCount*3;
+					currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
+					currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 3;
+					currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 2;
+					currentMesh->polyCount++;
+
+					pp += 3;
+					currentMesh->indexes[pp] = currentMesh->vertexCount - 4;
+					currentMesh->indexes[pp + 1] = currentMesh->vertexCount - 2;
+					currentMesh->indexes[pp + 2] = currentMesh->vertexCount - 1;
+					currentMesh->polyCount++;
+				}
+			}
+		}
 
 		mUpdatingMesh = false;
 	}
 
+	Mesh* Text::GetNextMesh(int& meshIdx, const TextureRef& texture, int charactersCount)
+	{
+		meshIdx++;
+		if (meshIdx == mMeshes.Count())
+		{
+			int polyCount = Math::Min<int>(charactersCount*2 + 15, mMeshMaxPolyCount);
+			mMeshes.Add(mnew Mesh(texture, polyCount*2, polyCount));
+		}
+
+		Mesh* mesh = mMeshes[meshIdx];
+		mesh->SetTexture(texture);
+		return mesh;
+	}
+
 	void Text::CheckCharactersAndRebuildMesh()
 	{
+		// Characters could be moved in font texture, cached symbols are invalid
+		mSymbolsSet.ResetCache();
+
 		mFont->CheckCharacters(mText, height);
 		mFont->CheckCharacters(".", height);
+		mTextCharactersChecked = true;
+
 		UpdateMesh();
 	}
 
@@ -479,8 +551,15 @@ namespace o2
 									  HorAlign horAlign, VerAlign verAlign, bool wordWrap, bool dotsEngings,
 									  float charsDistCoef, float linesDistCoef)
 	{
+		// Paragraphs layouts depend only on these parameters, alignment is applied over them
+		bool areaWidthUsed = (wordWrap && areaSize.x > FLT_EPSILON) || dotsEngings;
+		bool cacheValid = mFont == font && mHeight == height && mSymbolsDistCoef == charsDistCoef && mWordWrap == wordWrap &&
+			mDotsEndings == dotsEngings && (!areaWidthUsed || mAreaSize.x == areaSize.x);
+
+		if (!cacheValid)
+			mParagraphs.Clear();
+
 		mFont = font;
-		mText = text;
 		mHeight = height;
 		mPosition = Vec2F(Math::Round(position.x), Math::Round(position.y));
 		mAreaSize = areaSize;
@@ -492,31 +571,181 @@ namespace o2
 		mLinesDistCoef = linesDistCoef;
 		mDotsEndings = dotsEngings;
 
-		mLines.Clear();
-		int textLen = mText.Length();
+		int textLen = text.Length();
+		int oldTextLen = mText.Length();
 
 		if (textLen == 0)
+		{
+			mText = text;
+			mLines.Clear();
+			mParagraphs.Clear();
 			return;
+		}
+
+		// Searches unchanged parts at beginning and ending of text, paragraphs inside them are taken from previous layout
+		int maxCommonLen = Math::Min(textLen, oldTextLen);
+		int prefixLen = 0;
+		while (prefixLen < maxCommonLen && text[prefixLen] == mText[prefixLen])
+			prefixLen++;
+
+		int suffixLen = 0;
+		while (suffixLen < maxCommonLen - prefixLen && text[textLen - 1 - suffixLen] == mText[oldTextLen - 1 - suffixLen])
+			suffixLen++;
+
+		bool sameText = prefixLen == textLen && textLen == oldTextLen;
+
+		int headParagraphs = 0, headLength = 0, headLines = 0;
+		for (; headParagraphs < mParagraphs.Count(); headParagraphs++)
+		{
+			const Paragraph& paragraph = mParagraphs[headParagraphs];
+
+			// Last paragraph isn't ended by new line, it can be continued in new text
+			bool isLast = headParagraphs == mParagraphs.Count() - 1;
+			if (!sameText && (isLast || headLength + paragraph.mLength > prefixLen))
+				break;
+
+			headLength += paragraph.mLength;
+			headLines += paragraph.mLinesCount;
+		}
+
+		int tailParagraphs = 0, tailLength = 0, tailLines = 0;
+		for (int i = mParagraphs.Count() - 1; i >= headParagraphs; i--)
+		{
+			// Paragraph is reused only when new line before it is unchanged too
+			int paragraphBegin = oldTextLen - tailLength - mParagraphs[i].mLength;
+			if (paragraphBegin <= oldTextLen - suffixLen)
+				break;
+
+			tailParagraphs++;
+			tailLength += mParagraphs[i].mLength;
+			tailLines += mParagraphs[i].mLinesCount;
+		}
+
+		Vector<Line> lines;
+		Vector<Paragraph> paragraphs;
+		lines.Reserve(mLines.Count() + 1);
+		paragraphs.Reserve(mParagraphs.Count() + 1);
+
+		for (int i = 0; i < headLines; i++)
+			lines.push_back(std::move(mLines[i]));
+
+		for (int i = 0; i < headParagraphs; i++)
+			paragraphs.Add(mParagraphs[i]);
+
+		int middleEnd = textLen - tailLength;
+		for (int begin = headLength; begin < middleEnd; )
+		{
+			int end = begin;
+			while (end < middleEnd && text[end] != '\n')
+				end++;
+
+			if (end < middleEnd)
+				end++;
+
+			paragraphs.Add({ end - begin, LayoutParagraph(text, begin, end, lines) });
+			begin = end;
+		}
+
+		// Text ended by new line has empty last paragraph
+		if (tailParagraphs == 0 && paragraphs.Last().mLength > 0 && text[textLen - 1] == '\n')
+			paragraphs.Add({ 0, LayoutParagraph(text, textLen, textLen, lines) });
+
+		int tailShift = textLen - oldTextLen;
+		for (int i = mLines.Count() - tailLines; i < mLines.Count(); i++)
+		{
+			mLines[i].mLineBegSymbol += tailShift;
+			lines.push_back(std::move(mLines[i]));
+		}
+
+		for (int i = mParagraphs.Count() - tailParagraphs; i < mParagraphs.Count(); i++)
+			paragraphs.Add(mParagraphs[i]);
+
+		mText = text;
+		mLines = std::move(lines);
+		mParagraphs = std::move(paragraphs);
 
 		float linesDist = mFont->GetLineHeightPx(mHeight)*mLinesDistCoef;
 		float fontHeight = mFont->GetHeightPx(mHeight);
 
-		mLines.Add(Line());
-		Line* curLine = &mLines.Last();
-		curLine->mSize.y = fontHeight;
+		Vec2F fullSize(0, fontHeight + linesDist*(float)(mLines.Count() - 1));
+		for (auto& line : mLines)
+		{
+			line.mSize.y = linesDist;
+			fullSize.x = Math::Max(fullSize.x, line.mSize.x);
+		}
 
-		float dotsSize = mFont->GetCharacter('.', mHeight).mAdvance*3.0f;
+		mLines[0].mSize.y = fontHeight;
+
+		float lineHeight = linesDist;
+		float yOffset = mAreaSize.y - mLines[0].mSize.y;
+
+		if (mVerAlign == VerAlign::Both)
+			lineHeight = Math::Max(fontHeight, (mAreaSize.y - fontHeight)/(float)(mLines.Count() - 1));
+		else if (mVerAlign == VerAlign::Bottom)
+			yOffset = fullSize.y - mLines[0].mSize.y;
+		else if (mVerAlign == VerAlign::Middle)
+			yOffset -= mAreaSize.y*0.5f - fullSize.y*0.5f;
+
+		yOffset += mPosition.y;
 
-		Vec2F fullSize(0, fontHeight);
+		for (auto& line : mLines)
+		{
+			float xOffset = 0;
+			float additiveSpaceOffs = 0;
+
+			if (mHorAlign == HorAlign::Middle)
+				xOffset = (mAreaSize.x - line.mSize.x)*0.5f;
+			else if (mHorAlign == HorAlign::Right)
+				xOffset = mAreaSize.x - line.mSize.x;
+			else if (mHorAlign == HorAlign::Both)
+				additiveSpaceOffs = Math::Max(0.0f, (mAreaSize.x - line.mSize.x)/(float)line.mSpacesCount);
+
+			xOffset += mPosition.x;
+
+			Vec2F locOrigin((float)(int)xOffset, (float)(int)yOffset);
+			yOffset -= lineHeight;
+
+			// Symbols are moved from previous line position, new lines are at zero position
+			Vec2F offset = locOrigin - line.mPosition;
+			float spacesOffset = additiveSpaceOffs - line.mSpacesOffset;
+
+			line.mPosition = locOrigin;
+			line.mSpacesOffset = additiveSpaceOffs;
+
+			if (offset == Vec2F() && spacesOffset == 0.0f)
+				continue;
+
+			for (auto& symbol : line.mSymbols)
+			{
+				if (symbol.mCharId == ' ')
+					offset.x += spacesOffset;
+
+				symbol.mFrame = symbol.mFrame + offset;
+			}
+		}
+
+		mRealSize = fullSize;
+	}
+
+	int Text::SymbolsSet::LayoutParagraph(const WString& text, int begin, int end, Vector<Line>& lines)
+	{
+		lines.push_back(Line());
+		Line* curLine = &lines.Last();
+		curLine->mLineBegSymbol = begin;
+
+		int linesCount = 1;
+
+		float dotsSize = mFont->GetCharacter('.', mHeight).mAdvance*3.0f;
 		bool checkAreaBounds = mWordWrap && mAreaSize.x > FLT_EPSILON;
 		int wrapCharIdx = -1;
-		for (int i = 0; i < textLen; i++)
+
+		for (int i = begin; i < end; i++)
 		{
-			const Font::Character& ch = mFont->GetCharacter(mText[i], mHeight);
+			const Font::Character& ch = mFont->GetCharacter(text[i], mHeight);
 			Vec2F chSize = ch.mSize;
 			Vec2F chPos = Vec2F(curLine->mSize.x - ch.mOrigin.x, -ch.mOrigin.y);
 
-			if (mDotsEndings && mText[i] != '\n' && curLine->mSize.x + ch.mAdvance*mSymbolsDistCoef > mAreaSize.x - dotsSize)
+			if (mDotsEndings && text[i] != '\n' && curLine->mSize.x + ch.mAdvance*mSymbolsDistCoef > mAreaSize.x - dotsSize)
 			{
 				const Font::Character& dotCh = mFont->GetCharacter('.', mHeight);
 				Vec2F dotChSize = dotCh.mSize;
@@ -524,118 +753,94 @@ namespace o2
 				for (int j = 0; j < 3; j++)
 				{
 					Vec2F dotChPos = Vec2F(curLine->mSize.x - dotCh.mOrigin.x, -dotCh.mOrigin.y);
-					curLine->mSymbols.Add(Symbol(dotChPos, dotChSize, dotCh.mTexSrc, dotCh.mId, dotCh.mOrigin, dotCh.mAdvance));
+					curLine->mSymbols.Add(Symbol(dotChPos, dotChSize, dotCh.mTexSrc, dotCh.mId, dotCh.mOrigin, dotCh.mAdvance, dotCh.mPage));
 					curLine->mString += '.';
 					curLine->mSize.x += dotCh.mAdvance*mSymbolsDistCoef;
 				}
 
-				for (; i < textLen - 1; i++)
+				for (; i < end - 1; i++)
 				{
-					if (mText[i + 1] == '\n')
+					if (text[i + 1] == '\n')
 						break;
 				}
 
 				continue;
 			}
 
-			curLine->mSymbols.Add(Symbol(chPos, chSize, ch.mTexSrc, ch.mId, ch.mOrigin, ch.mAdvance));
+			curLine->mSymbols.Add(Symbol(chPos, chSize, ch.mTexSrc, ch.mId, ch.mOrigin, ch.mAdvance, ch.mPage));
 
-			if (mText[i] != '\n')
+			if (text[i] != '\n')
 				curLine->mSize.x += ch.mAdvance*mSymbolsDistCoef;
 
-			curLine->mString += mText[i];
-
-			bool outOfBounds = checkAreaBounds ? curLine->mSize.x > mAreaSize.x && i > curLine->mLineBegSymbol : false;
+			curLine->mString += text[i];
 
-			if (mText[i] == '\n' || outOfBounds)
+			// New line character is last in paragraph, next line belongs to next paragraph
+			if (text[i] == '\n')
 			{
-				if (outOfBounds)
-				{
-					if (wrapCharIdx < 0 || wrapCharIdx == curLine->mLineBegSymbol)
-						wrapCharIdx = i;
-					else
-						curLine->mSpacesCount--;
+				curLine->mSymbols.PopBack();
+				curLine->mString.PopBack();
+				curLine->mEndedNewLine = true;
+				break;
+			}
 
-					int cutLen = wrapCharIdx - curLine->mLineBegSymbol;
+			bool outOfBounds = checkAreaBounds ? curLine->mSize.x > mAreaSize.x && i > curLine->mLineBegSymbol : false;
 
-					curLine->mSymbols.RemoveRange(cutLen, curLine->mSymbols.Count());
-					curLine->mString.Erase(cutLen);
+			if (outOfBounds)
+			{
+				if (wrapCharIdx < 0 || wrapCharIdx == curLine->mLineBegSymbol)
+					wrapCharIdx = i;
+				else
+					curLine->mSpacesCount--;
 
+				int cutLen = wrapCharIdx - curLine->mLineBegSymbol;
 
-					if (curLine->mSymbols.Count() > 0)
-						curLine->mSize.x = curLine->mSymbols.Last().mFrame.right;
-					else
-						curLine->mSize.x = 0;
+				curLine->mSymbols.RemoveRange(cutLen, curLine->mSymbols.Count());
+				curLine->mString.Erase(cutLen);
 
-					i = wrapCharIdx - 1;
-					wrapCharIdx = -1;
-				}
+				if (curLine->mSymbols.Count() > 0)
+					curLine->mSize.x = curLine->mSymbols.Last().mFrame.right;
 				else
-				{
-					curLine->mSymbols.PopBack();
-					curLine->mString.PopBack();
-					curLine->mEndedNewLine = true;
-				}
+					curLine->mSize.x = 0;
 
-				fullSize.x = Math::Max(fullSize.x, curLine->mSize.x);
-				fullSize.y += linesDist;
+				i = wrapCharIdx - 1;
+				wrapCharIdx = -1;
 
-				mLines.Add(Line());
-				curLine = &mLines.Last();
-				curLine->mSize.y = linesDist;
+				lines.push_back(Line());
+				curLine = &lines.Last();
 				curLine->mLineBegSymbol = i + 1;
+				linesCount++;
 			}
-			else if (mText[i] == ' '/* || mFont->mAllSymbolReturn*/)
+			else if (text[i] == ' ')
 			{
 				curLine->mSpacesCount++;
 				wrapCharIdx = i;
 			}
 		}
 
-		fullSize.x = Math::Max(fullSize.x, curLine->mSize.x);
-
-		float lineHeight = linesDist;
-		float yOffset = mAreaSize.y - mLines[0].mSize.y;
-
-		if (mVerAlign == VerAlign::Both)
-			lineHeight = Math::Max(fontHeight, (mAreaSize.y - fontHeight)/(float)(mLines.Count() - 1));
-		else if (mVerAlign == VerAlign::Bottom)
-			yOffset = fullSize.y - mLines[0].mSize.y;
-		else if (mVerAlign == VerAlign::Middle)
-			yOffset -= mAreaSize.y*0.5f - fullSize.y*0.5f;
-
-		yOffset += mPosition.y;
+		return linesCount;
+	}
 
-		for (Vector<Line>::Iterator it = mLines.begin(); it != mLines.end(); ++it)
+	int Text::SymbolsSet::GetLineIndexByPosition(int position) const
+	{
+		// Lines are sorted by beginning symbol, their ends are increasing too
+		int left = 0, right = mLines.Count();
+		while (left < right)
 		{
-			Line* line = &(*it);
+			int middle = (left + right)/2;
+			const Line& line = mLines[middle];
 
-			float xOffset = 0;
-			float additiveSpaceOffs = 0;
-
-			if (mHorAlign == HorAlign::Middle)
-				xOffset = (mAreaSize.x - line->mSize.x)*0.5f;
-			else if (mHorAlign == HorAlign::Right)
-				xOffset = mAreaSize.x - line->mSize.x;
-			else if (mHorAlign == HorAlign::Both)
-				additiveSpaceOffs = Math::Max(0.0f, (mAreaSize.x - line->mSize.x)/(float)line->mSpacesCount);
-
-			xOffset += mPosition.x;
-
-			Vec2F locOrigin((float)(int)xOffset, (float)(int)yOffset);
-			line->mPosition = locOrigin;
-			yOffset -= lineHeight;
-
-			for (Vector<Symbol>::Iterator jt = line->mSymbols.begin(); jt != line->mSymbols.end(); ++jt)
-			{
-				if (jt->mCharId == ' ')
-					locOrigin.x += additiveSpaceOffs;
-
-				jt->mFrame = jt->mFrame + locOrigin;
-			}
+			if (line.mLineBegSymbol + line.mSymbols.Count() < position)
+				left = middle + 1;
+			else
+				right = middle;
 		}
 
-		mRealSize = fullSize;
+		return left;
+	}
+
+	void Text::SymbolsSet::ResetCache()
+	{
+		mParagraphs.Clear();
 	}
 
 	void Text::SymbolsSet::Move(const Vec2F& offs)
@@ -649,12 +854,14 @@ namespace o2
 		}
 	}
 
-	Text::SymbolsSet::Symbol::Symbol()
+	Text::SymbolsSet::Symbol::Symbol():
+		mPage(0)
 	{}
 
 	Text::SymbolsSet::Symbol::Symbol(const Vec2F& position, const Vec2F& size, const RectF& texSrc,
-									 UInt16 charId, const Vec2F& origin, float advance):
-		mFrame(position, position + size), mTexSrc(texSrc), mCharId(charId), mOrigin(origin), mAdvance(advance)
+									 UInt16 charId, const Vec2F& origin, float advance, int page /*= 0*/):
+		mFrame(position, position + size), mTexSrc(texSrc), mCharId(charId), mOrigin(origin), mAdvance(advance),
+		mPage(page)
 	{}
 
 	bool Text::SymbolsSet::Symbol::operator==(const Symbol& other) const
@@ -663,7 +870,7 @@ namespace o2
 	}
 
 	Text::SymbolsSet::Line::Line():
-		mLineBegSymbol(0), mSpacesCount(0), mEndedNewLine(false)
+		mLineBegSymbol(0), mSpacesCount(0), mSpacesOffset(0), mEndedNewLine(false)
 	{}
 
 	bool Text::SymbolsSet::Line::operator==(const Line& other) const
@@ -163,6 +163,7 @@ namespace o2
 				UInt16 mCharId;  // Character id
 				Vec2F  mOrigin;  // Character offset
 				float  mAdvance; // Character advance
+				int    mPage;    // Font texture page index
 
 			public:
 				// Default constructor
@@ -170,7 +171,7 @@ namespace o2
 
 				// Constructor
 				Symbol(const Vec2F& position, const Vec2F& size, const RectF& texSrc, UInt16 charId,
-					   const Vec2F& origin, float advance);
+					   const Vec2F& origin, float advance, int page = 0);
 
 			 // Equals operator
 				bool operator==(const Symbol& other) const;
@@ -187,6 +188,7 @@ namespace o2
 				Vec2F         mPosition;      // Position of line
 				int           mLineBegSymbol; // Index of line beginning symbol
 				int           mSpacesCount;   // Spaces count at line
+				float         mSpacesOffset;  // Additional offset of each space, used for justified line
 				bool          mEndedNewLine;  // True, if line ended by new line character
 
 			public:
@@ -197,6 +199,15 @@ namespace o2
 				bool operator==(const Line& other) const;
 			};
 
+			// -------------------------------------------------------------------------------------
+			// Paragraph layout cache: part of text ended by new line and count of its wrapped lines
+			// -------------------------------------------------------------------------------------
+			struct Paragraph
+			{
+				int mLength;     // Count of characters with new line character
+				int mLinesCount; // Count of lines
+			};
+
 		public:
 			FontRef  mFont;            // Font
 			int      mHeight;          // Text height
@@ -211,7 +222,8 @@ namespace o2
 			float    mSymbolsDistCoef; // Characters distance coefficient, 1 is standard
 			float    mLinesDistCoef;   // Lines distance coefficient, 1 is standard
 
-			Vector<Line> mLines; // Lines definitions
+			Vector<Line>      mLines;      // Lines definitions
+			Vector<Paragraph> mParagraphs; // Laid out paragraphs. Unchanged paragraphs aren't laid out again on next initialization
 
 		public:
 			// Calculating characters layout by parameters
@@ -221,6 +233,16 @@ namespace o2
 
 			// Moves symbols 
 			void Move(const Vec2F& offs);
+
+			// Returns index of first line, which end isn't less than symbol position. Returns lines count when there is no such line
+			int GetLineIndexByPosition(int position) const;
+
+			// Resets paragraphs cache, all text will be laid out again on next initialization. Used when font characters changed
+			void ResetCache();
+
+		protected:
+			// Lays out paragraph from begin to end character into lines. Returns count of added lines
+			int LayoutParagraph(const WString& text, int begin, int end, Vector<Line>& lines);
 		};
 
 	protected:
@@ -241,14 +263,19 @@ namespace o2
 		Vector<Mesh*> mMeshes;        // Meshes vector
 		Basis         mLastTransform; // Last mesh update transformation
 
-		SymbolsSet mSymbolsSet; // Symbols set definition
+		SymbolsSet  mSymbolsSet; // Symbols set definition
+		Vector<int> mUsedPages;  // Font pages, used by symbols at last mesh update
 
-		bool mUpdatingMesh; // True, when mesh is already updating
+		bool mUpdatingMesh;                  // True, when mesh is already updating
+		bool mTextCharactersChecked = false; // True, when characters of current text are checked in font with current height
 
 	protected:
 		// Updating meshes
 		void UpdateMesh();
 
+		// Switches to next mesh with texture, creates new mesh when all are used
+		Mesh* GetNextMesh(int& meshIdx, const TextureRef& texture, int charactersCount);
+
 		// Checks test's characters in font and rebuilds mesh. Used when fond is resetting
 		void CheckCharactersAndRebuildMesh();
 
@@ -303,7 +330,9 @@ CLASS_FIELDS_META(o2::Text)
 	PROTECTED_FIELD(mMeshes);
 	PROTECTED_FIELD(mLastTransform);
 	PROTECTED_FIELD(mSymbolsSet);
+	PROTECTED_FIELD(mUsedPages);
 	PROTECTED_FIELD(mUpdatingMesh);
+	PROTECTED_FIELD(mTextCharactersChecked).DEFAULT_VALUE(false);
 }
 END_META;
 CLASS_METHODS_META(o2::Text)
@@ -335,6 +364,7 @@ CLASS_METHODS_META(o2::Text)
 	PUBLIC_FUNCTION(RectF, GetRealRect);
 	PUBLIC_STATIC_FUNCTION(Vec2F, GetTextSize, const WString&, Font*, int, const Vec2F&, HorAlign, VerAlign, bool, bool, float, float);
 	PROTECTED_FUNCTION(void, UpdateMesh);
+	PROTECTED_FUNCTION(Mesh*, GetNextMesh, int&, const TextureRef&, int);
 	PROTECTED_FUNCTION(void, CheckCharactersAndRebuildMesh);
 	PROTECTED_FUNCTION(void, TransformMesh, const Basis&);
 	PROTECTED_FUNCTION(void, PrepareMesh, int);
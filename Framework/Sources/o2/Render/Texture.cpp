@@ -124,6 +124,16 @@ namespace o2
 		return mReady;
 	}
 
+	void Texture::SetDistanceField(bool distanceField)
+	{
+		mDistanceField = distanceField;
+	}
+
+	bool Texture::IsDistanceField() const
+	{
+		return mDistanceField;
+	}
+
 	bool Texture::IsAtlasPage() const
 	{
 		return mAtlasAssetId != 0;
@@ -108,6 +108,12 @@ namespace o2
 		// Returns true when texture ready to use
 		bool IsReady() const;
 
+		// Sets texture contains signed distance field in alpha channel. Render draws it with smooth edge at 0.5 level
+		void SetDistanceField(bool distanceField);
+
+		// Returns is texture contains signed distance field
+		bool IsDistanceField() const;
+
 		// Returns is texture from atlas page
 		bool IsAtlasPage() const;
 
@@ -126,6 +132,7 @@ namespace o2
 		UID         mAtlasAssetId;            // Atlas asset id. Equals 0 if it isn't atlas texture
 		int         mAtlasPage;               // Atlas page
 		bool        mReady;                   // Is texture ready to use
+		bool        mDistanceField = false;   // Is texture contains signed distance field in alpha channel
 
 		int mRefs = 0; // Texture references
 
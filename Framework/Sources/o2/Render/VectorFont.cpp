@@ -18,26 +18,17 @@ namespace o2
 {
 	VectorFont::VectorFont() :
 		Font(), mFreeTypeFace(nullptr)
-	{
-		mTexture = TextureRef(Vec2I(512, 512));
-		mTextureSrcRect.Set(0, 0, 512, 512);
-	}
+	{}
 
 	VectorFont::VectorFont(const String& fileName) :
 		Font(), mFreeTypeFace(nullptr)
 	{
-		mTexture = TextureRef(Vec2I(512, 512));
-		mTextureSrcRect.Set(0, 0, 512, 512);
-
 		Load(fileName);
 	}
 
 	VectorFont::VectorFont(const VectorFont& other) :
-		Font(), mFreeTypeFace(other.mFreeTypeFace)
-	{
-		mTexture = TextureRef(Vec2I(512, 512));
-		mTextureSrcRect.Set(0, 0, 512, 512);
-	}
+		Font(), mFreeTypeFace(other.mFreeTypeFace), mMaxPagesCount(other.mMaxPagesCount), mDistanceField(other.mDistanceField)
+	{}
 
 	VectorFont::~VectorFont()
 	{
@@ -46,6 +37,8 @@ namespace o2
 
 		for (auto effect : mEffects)
 			delete effect;
+
+		ClearPages();
 	}
 
 	const char* GetFreeTypeErrorMessage(FT_Error err)
@@ -134,19 +127,33 @@ namespace o2
 
 	void VectorFont::CheckCharacters(const WString& needChararacters, int height)
 	{
+		// Checks while notifying about rebuilt characters share one stamp, so they can't evict each other's pages.
+		// Check after marking used pages shares their stamp too
+		if (!mNotifyingRebuilt && !mPagesUsedMarked)
+			mUseStamp++;
+
+		mPagesUsedMarked = false;
+
+		// In distance field mode glyphs are rendered only with base height
+		int renderHeight = mDistanceField ? mDistanceFieldHeight : height;
+
 		int len = needChararacters.Length();
 		Vector<wchar_t> needToRenderChars;
 		needToRenderChars.Reserve(len);
 
+		auto fndHeight = mCharacters.find(renderHeight);
+
 		for (int i = 0; i < len; i++)
 		{
 			bool isNew = true;
 			wchar_t c = needChararacters[i];
-			auto fndHeight = mCharacters.find(height);
 			if (fndHeight != mCharacters.End())
 			{
 				auto fndId = fndHeight->second.find(c);
-				isNew = fndHeight->second.find(c) == fndHeight->second.End();
+				isNew = fndId == fndHeight->second.End();
+
+				if (!isNew)
+					mPages[fndId->second.mPage]->lastUseStamp = mUseStamp;
 			}
 
 			if (isNew)
@@ -159,7 +166,25 @@ namespace o2
 		}
 
 		if (needToRenderChars.Count() > 0)
-			UpdateCharacters(needToRenderChars, height);
+			UpdateCharacters(needToRenderChars, renderHeight);
+
+		if (renderHeight != height)
+			AddScaledCharacters(needChararacters, height);
+	}
+
+	void VectorFont::SetPagesUsed(const Vector<int>& pages)
+	{
+		if (!mNotifyingRebuilt)
+		{
+			mUseStamp++;
+			mPagesUsedMarked = true;
+		}
+
+		for (int page : pages)
+		{
+			if (page >= 0 && page < mPages.Count())
+				mPages[page]->lastUseStamp = mUseStamp;
+		}
 	}
 
 	VectorFont::Effect* VectorFont::AddEffect(Effect* effect)
@@ -203,13 +228,57 @@ namespace o2
 	void VectorFont::Reset()
 	{
 		mCharacters.Clear();
+		ClearPages();
 		onCharactersRebuilt();
 	}
 
+	TextureRef VectorFont::GetPageTexture(int page) const
+	{
+		if (page >= 0 && page < mPages.Count())
+			return mPages[page]->texture;
+
+		return mTexture;
+	}
+
+	int VectorFont::GetPagesCount() const
+	{
+		return mPages.Count();
+	}
+
+	void VectorFont::SetMaxPagesCount(int count)
+	{
+		mMaxPagesCount = Math::Max(count, 1);
+	}
+
+	int VectorFont::GetMaxPagesCount() const
+	{
+		return mMaxPagesCount;
+	}
+
+	void VectorFont::SetDistanceField(bool enabled)
+	{
+		if (mDistanceField == enabled)
+			return;
+
+		mDistanceField = enabled;
+		Reset();
+	}
+
+	bool VectorFont::IsDistanceField() const
+	{
+		return mDistanceField;
+	}
+
 	void VectorFont::UpdateCharacters(Vector<wchar_t>& newCharacters, int height)
 	{
 		RenderNewCharacters(newCharacters, height);
+		UploadPages();
+
+		// Users check their characters again while notifying, they must not evict pages used by each other
+		bool wasNotifying = mNotifyingRebuilt;
+		mNotifyingRebuilt = true;
 		onCharactersRebuilt();
+		mNotifyingRebuilt = wasNotifying;
 	}
 
 	void VectorFont::RenderNewCharacters(Vector<wchar_t>& newCharacters, int height)
@@ -218,119 +287,471 @@ namespace o2
 		FT_Set_Char_Size(mFreeTypeFace, 0, height * 64, dpi.x, dpi.y);
 
 		Vec2I border;
-		for (auto effect : mEffects)
+		if (mDistanceField)
+			border.Set(mDistanceFieldSpread + 1, mDistanceFieldSpread + 1);
+		else
 		{
-			Vec2I effectExt = effect->GetSizeExtend();
-			border.x = Math::Max(border.x, effectExt.x);
-			border.y = Math::Max(border.y, effectExt.y);
+			for (auto effect : mEffects)
+			{
+				Vec2I effectExt = effect->GetSizeExtend();
+				border.x = Math::Max(border.x, effectExt.x);
+				border.y = Math::Max(border.y, effectExt.y);
+			}
+
+			border += Vec2I(2, 2);
 		}
 
-		border += Vec2I(2, 2);
+		// Effects are processing colored bitmaps, without them only coverage or distance is stored
+		bool singleChannel = mEffects.IsEmpty() || mDistanceField;
+		Bitmap* glyphBitmap = singleChannel ? nullptr : mnew Bitmap(PixelFormat::R8G8B8A8, Vec2I(1, 1));
 
-		FT_Load_Char(mFreeTypeFace, 'A', FT_LOAD_RENDER);
-		int symbolsHeight = Math::CeilToInt((mFreeTypeFace->glyph->bitmap.rows + border.y*2)*1.25f);
+		Vec2F invPageSize(1.0f/mPageSize, 1.0f/mPageSize);
 
 		for (auto ch : newCharacters)
 		{
-			CharDef newCharDef;
-
 			FT_Load_Char(mFreeTypeFace, ch, FT_LOAD_RENDER);
 			auto glyph = mFreeTypeFace->glyph;
 
 			Vec2I glyphSize(glyph->bitmap.width, glyph->bitmap.rows);
+			Vec2I cellSize = glyphSize + border*2;
+
+			Character character;
+			character.mId = ch;
+			character.mHeight = height;
+			character.mSize = cellSize;
+			character.mAdvance = glyph->advance.x/64.0f;
+			character.mOrigin.x = -glyph->metrics.horiBearingX/64.0f + border.x;
+			character.mOrigin.y = (glyph->metrics.height - glyph->metrics.horiBearingY)/64.0f + border.y;
+
+			Vec2I position;
+			int pageIdx = AllocateGlyph(cellSize, position);
+			if (pageIdx < 0)
+			{
+				o2Render.mLog->Error("Failed to place glyph " + (String)(int)ch + " with height " + (String)height +
+									 " into font atlas");
+				continue;
+			}
 
-			Bitmap* newBitmap = mnew Bitmap(PixelFormat::R8G8B8A8, glyphSize + border*2);
-			newBitmap->Fill(Color4(255, 255, 255, 0));
-			UInt8* newBitmapData = newBitmap->GetData();
-			Vec2I newBitmapSize = newBitmap->GetSize();
+			Page* page = mPages[pageIdx];
+			page->lastUseStamp = mUseStamp;
 
-			for (int x = 0; x < (int)glyph->bitmap.width; x++)
+			UInt8* pageData = page->pixels->GetData();
+
+			if (mDistanceField)
+				WriteDistanceField(glyph->bitmap, border.x, pageData + position.y*mPageSize + position.x, cellSize);
+			else if (singleChannel)
 			{
-				for (int y = 0; y < (int)glyph->bitmap.rows; y++)
+				// Glyph rows are stored from top to bottom, page rows from bottom to top
+				for (int y = 0; y < glyphSize.y; y++)
 				{
-					Color4 c(255, 255, 255, glyph->bitmap.buffer[y*glyph->bitmap.width + x]);
-					ULong cl = c.ABGR();
-					memcpy(&newBitmapData[((newBitmapSize.y - y - 1 - border.y)*newBitmapSize.x + x + border.x)*4], &cl, 4);
+					int pageRow = position.y + cellSize.y - 1 - border.y - y;
+					memcpy(pageData + pageRow*mPageSize + position.x + border.x,
+						   glyph->bitmap.buffer + y*glyph->bitmap.pitch, glyphSize.x);
 				}
 			}
+			else
+			{
+				glyphBitmap->Create(PixelFormat::R8G8B8A8, cellSize);
+				glyphBitmap->Fill(Color4(255, 255, 255, 0));
 
-			for (auto effect : mEffects)
-				effect->Process(newBitmap);
+				ULong* glyphData = (ULong*)glyphBitmap->GetData();
+				for (int y = 0; y < glyphSize.y; y++)
+				{
+					ULong* row = glyphData + (cellSize.y - y - 1 - border.y)*cellSize.x + border.x;
+					const UInt8* srcRow = glyph->bitmap.buffer + y*glyph->bitmap.pitch;
+
+					for (int x = 0; x < glyphSize.x; x++)
+						row[x] = Color4(255, 255, 255, srcRow[x]).ABGR();
+				}
+
+				for (auto effect : mEffects)
+					effect->Process(glyphBitmap);
+
+				for (int y = 0; y < cellSize.y; y++)
+				{
+					memcpy(pageData + ((position.y + y)*mPageSize + position.x)*4,
+						   glyphBitmap->GetData() + y*cellSize.x*4, cellSize.x*4);
+				}
+			}
 
-			newCharDef.bitmap = newBitmap;
-			newCharDef.character.mId = ch;
-			newCharDef.character.mHeight = height;
-			newCharDef.character.mSize = newBitmapSize;
-			newCharDef.character.mAdvance = glyph->advance.x/64.0f;
-			newCharDef.character.mOrigin.x = -glyph->metrics.horiBearingX/64.0f + border.x;
-			newCharDef.character.mOrigin.y = (glyph->metrics.height - glyph->metrics.horiBearingY)/64.0f + border.y;
+			RectI rect(position.x, position.y + cellSize.y, position.x + cellSize.x, position.y);
+			MarkPageDirty(page, rect);
 
-			PackCharacter(newCharDef, symbolsHeight);
+			character.mPage = pageIdx;
+			character.mTexSrc.left = rect.left*invPageSize.x;
+			character.mTexSrc.right = rect.right*invPageSize.x;
+			character.mTexSrc.top = 1.0f - rect.top*invPageSize.y;
+			character.mTexSrc.bottom = 1.0f - rect.bottom*invPageSize.y;
+
+			AddCharacter(character);
 		}
+
+		delete glyphBitmap;
 	}
 
-	void VectorFont::PackCharacter(CharDef& character, int height)
+	void VectorFont::AddScaledCharacters(const WString& characters, int height)
 	{
-		PackLine* packLine = nullptr;
+		auto fndBaseHeight = mCharacters.find(mDistanceFieldHeight);
+		if (fndBaseHeight == mCharacters.End())
+			return;
+
+		auto& baseCharacters = fndBaseHeight->second;
+		auto& heightCharacters = mCharacters[height];
+		float scale = (float)height/(float)mDistanceFieldHeight;
 
-		while (!packLine)
+		int len = characters.Length();
+		for (int i = 0; i < len; i++)
 		{
-			packLine = mPackLines.FindOrDefault([&](PackLine* x) {
-				return x->height >= height && x->length + character.bitmap->GetSize().x < mTexture->GetSize().x; });
+			UInt16 id = characters[i];
+			if (heightCharacters.ContainsKey(id))
+				continue;
 
-			if (!packLine)
-			{
-				if (mLastPackLinePos + height <= mTexture->GetSize().y)
-				{
-					packLine = mnew PackLine();
-					packLine->position = mLastPackLinePos;
-					packLine->height = height;
+			auto fndBase = baseCharacters.find(id);
+			if (fndBase == baseCharacters.End())
+				continue;
+
+			// Scaled character uses same glyph area in page, only metrics are scaled
+			Character character = fndBase->second;
+			character.mHeight = height;
+			character.mSize *= scale;
+			character.mOrigin *= scale;
+			character.mAdvance *= scale;
 
-					mPackLines.Add(packLine);
+			AddCharacter(character);
+		}
+	}
 
-					mLastPackLinePos += height;
+	void VectorFont::WriteDistanceField(const FT_Bitmap& bitmap, int border, UInt8* dst, const Vec2I& cellSize) const
+	{
+		const float infinity = 1e20f;
+
+		int count = cellSize.x*cellSize.y;
+		int maxSide = Math::Max(cellSize.x, cellSize.y);
+
+		// Squared distances to glyph inside and outside. Fully covered and empty pixels are seeds at zero distance.
+		// Anti-aliased edge pixels are seeds too, with sub-pixel distance to edge from coverage: half covered
+		// pixel is right on edge, less covered pixel is outside at 0.5 - coverage, more covered is inside
+		Vector<float> toInside, toOutside;
+		toInside.Resize(count);
+		toOutside.Resize(count);
+
+		for (int y = 0; y < cellSize.y; y++)
+		{
+			int glyphY = y - border;
+			for (int x = 0; x < cellSize.x; x++)
+			{
+				int glyphX = x - border;
+				bool inGlyph = glyphX >= 0 && glyphY >= 0 && glyphX < (int)bitmap.width && glyphY < (int)bitmap.rows;
+				UInt8 coverage = inGlyph ? bitmap.buffer[glyphY*bitmap.pitch + glyphX] : 0;
+
+				int idx = y*cellSize.x + x;
+				if (coverage == 255)
+				{
+					toInside[idx] = 0.0f;
+					toOutside[idx] = infinity;
+				}
+				else if (coverage == 0)
+				{
+					toInside[idx] = infinity;
+					toOutside[idx] = 0.0f;
 				}
 				else
 				{
-					TextureRef lastTexture = mTexture;
-					mTexture = TextureRef(lastTexture->GetSize()*2, PixelFormat::R8G8B8A8, Texture::Usage::Default);
-					mTexture->Copy(*lastTexture.Get(), RectI(Vec2I(0, 0), lastTexture->GetSize()));
-
-					for (auto heightKV : mCharacters)
-					{
-						for (auto charKV : heightKV.second)
-						{
-							charKV.second.mTexSrc.left *= 0.5f;
-							charKV.second.mTexSrc.right *= 0.5f;
-							charKV.second.mTexSrc.top *= 0.5f;
-							charKV.second.mTexSrc.bottom *= 0.5f;
-						}
-					}
+					float edgeDistance = 0.5f - (float)coverage/255.0f;
+					toInside[idx] = edgeDistance > 0.0f ? edgeDistance*edgeDistance : 0.0f;
+					toOutside[idx] = edgeDistance < 0.0f ? edgeDistance*edgeDistance : 0.0f;
+				}
+			}
+		}
+
+		Vector<float> f, z;
+		Vector<int> v;
+		f.Resize(maxSide);
+		z.Resize(maxSide + 1);
+		v.Resize(maxSide);
+
+		// 2D transform is separable: by columns, then by rows
+		for (auto distances : { toInside.Data(), toOutside.Data() })
+		{
+			for (int x = 0; x < cellSize.x; x++)
+				DistanceTransform(distances + x, cellSize.y, cellSize.x, f.Data(), v.Data(), z.Data());
+
+			for (int y = 0; y < cellSize.y; y++)
+				DistanceTransform(distances + y*cellSize.x, cellSize.x, 1, f.Data(), v.Data(), z.Data());
+		}
+
+		// Signed distance is positive inside glyph, it is mapped from -spread..spread to 0..255 with edge at 128
+		float scale = 0.5f/(float)mDistanceFieldSpread;
+		for (int y = 0; y < cellSize.y; y++)
+		{
+			UInt8* row = dst + (cellSize.y - 1 - y)*mPageSize;
+			for (int x = 0; x < cellSize.x; x++)
+			{
+				int idx = y*cellSize.x + x;
+				float distance = Math::Sqrt(toOutside[idx]) - Math::Sqrt(toInside[idx]);
+				row[x] = (UInt8)(Math::Clamp01(0.5f + distance*scale)*255.0f + 0.5f);
+			}
+		}
+	}
+
+	void VectorFont::DistanceTransform(float* values, int count, int stride, float* f, int* v, float* z)
+	{
+		for (int i = 0; i < count; i++)
+			f[i] = values[i*stride];
+
+		auto intersection = [&](int q, int p) {
+			return ((f[q] + (float)(q*q)) - (f[p] + (float)(p*p)))/(float)(2*q - 2*p);
+		};
+
+		// Builds lower envelope of parabolas rooted at each value
+		int k = 0;
+		v[0] = 0;
+		z[0] = -FLT_MAX;
+		z[1] = FLT_MAX;
+
+		for (int q = 1; q < count; q++)
+		{
+			float s = intersection(q, v[k]);
+			while (s <= z[k])
+			{
+				k--;
+				s = intersection(q, v[k]);
+			}
+
+			k++;
+			v[k] = q;
+			z[k] = s;
+			z[k + 1] = FLT_MAX;
+		}
+
+		k = 0;
+		for (int q = 0; q < count; q++)
+		{
+			while (z[k + 1] < (float)q)
+				k++;
+
+			float delta = (float)(q - v[k]);
+			values[q*stride] = delta*delta + f[v[k]];
+		}
+	}
+
+	int VectorFont::AllocateGlyph(const Vec2I& size, Vec2I& position)
+	{
+		if (size.x > mPageSize || size.y > mPageSize)
+			return -1;
+
+		for (int i = 0; i < mPages.Count(); i++)
+		{
+			int nodeIdx = FindSkylinePosition(mPages[i], size, position);
+			if (nodeIdx >= 0)
+			{
+				AddSkylineLevel(mPages[i], nodeIdx, position, size);
+				return i;
+			}
+		}
+
+		// All pages are full: evict least recently used page, or create new one when all pages are in use now
+		int pageIdx = -1;
+		if (mPages.Count() >= mMaxPagesCount)
+		{
+			UInt oldestStamp = mUseStamp;
+			for (int i = 0; i < mPages.Count(); i++)
+			{
+				if (mPages[i]->lastUseStamp < oldestStamp)
+				{
+					oldestStamp = mPages[i]->lastUseStamp;
+					pageIdx = i;
 				}
 			}
 		}
 
-		character.packLine = packLine;
-		packLine->characters.Add(character);
+		if (pageIdx >= 0)
+			EvictPage(pageIdx);
+		else
+		{
+			mPages.Add(CreatePage());
+			pageIdx = mPages.Count() - 1;
+		}
 
-		character.rect.left = packLine->length;
-		character.rect.top = packLine->position + character.bitmap->GetSize().y;
-		character.rect.right = packLine->length + character.bitmap->GetSize().x;
-		character.rect.bottom = packLine->position;;
+		int nodeIdx = FindSkylinePosition(mPages[pageIdx], size, position);
+		AddSkylineLevel(mPages[pageIdx], nodeIdx, position, size);
 
-		packLine->length += character.bitmap->GetSize().x;
+		return pageIdx;
+	}
 
-		Vec2F invTexSize(1.0f/mTexture->GetSize().x, 1.0f/mTexture->GetSize().y);
-		character.character.mTexSrc.left = character.rect.left*invTexSize.x;
-		character.character.mTexSrc.right = character.rect.right*invTexSize.x;
-		character.character.mTexSrc.top = 1.0f - character.rect.top*invTexSize.y;
-		character.character.mTexSrc.bottom = 1.0f - character.rect.bottom*invTexSize.y;
+	int VectorFont::FindSkylinePosition(const Page* page, const Vec2I& size, Vec2I& position) const
+	{
+		int bestNodeIdx = -1;
+		int bestY = INT_MAX, bestWidth = INT_MAX;
 
-		mTexture->SetSubData(character.rect.LeftBottom(), character.bitmap);
+		for (int i = 0; i < page->skyline.Count(); i++)
+		{
+			int x = page->skyline[i].x;
+			if (x + size.x > mPageSize)
+				break;
 
-		AddCharacter(character.character);
+			// Glyph lays on highest node under it
+			int y = 0, widthLeft = size.x;
+			for (int j = i; widthLeft > 0; j++)
+			{
+				y = Math::Max(y, page->skyline[j].y);
+				widthLeft -= page->skyline[j].width;
+			}
+
+			if (y + size.y > mPageSize)
+				continue;
+
+			if (y < bestY || (y == bestY && page->skyline[i].width < bestWidth))
+			{
+				bestNodeIdx = i;
+				bestY = y;
+				bestWidth = page->skyline[i].width;
+				position.Set(x, y);
+			}
+		}
+
+		return bestNodeIdx;
+	}
+
+	void VectorFont::AddSkylineLevel(Page* page, int nodeIdx, const Vec2I& position, const Vec2I& size)
+	{
+		auto& skyline = page->skyline;
+		skyline.Insert({ position.x, position.y + size.y, size.x }, nodeIdx);
+
+		// Cut nodes covered by new one
+		int right = position.x + size.x;
+		for (int i = nodeIdx + 1; i < skyline.Count(); )
+		{
+			if (skyline[i].x >= right)
+				break;
+
+			int shrink = right - skyline[i].x;
+			if (skyline[i].width <= shrink)
+			{
+				skyline.RemoveAt(i);
+				continue;
+			}
+
+			skyline[i].x += shrink;
+			skyline[i].width -= shrink;
+			break;
+		}
+
+		// Merge neighbor nodes with same height
+		for (int i = 0; i < skyline.Count() - 1; )
+		{
+			if (skyline[i].y == skyline[i + 1].y)
+			{
+				skyline[i].width += skyline[i + 1].width;
+				skyline.RemoveAt(i + 1);
+			}
+			else
+				i++;
+		}
+	}
+
+	VectorFont::Page* VectorFont::CreatePage()
+	{
+		PixelFormat format = mEffects.IsEmpty() || mDistanceField ? PixelFormat::R8 : PixelFormat::R8G8B8A8;
+
+		Page* page = mnew Page();
+		page->texture = TextureRef(Vec2I(mPageSize, mPageSize), format, Texture::Usage::Default);
+		page->texture->SetDistanceField(mDistanceField);
+		page->pixels = mnew Bitmap(format, Vec2I(mPageSize, mPageSize));
+		page->skyline.Add({ 0, 0, mPageSize });
+
+		if (format == PixelFormat::R8)
+			memset(page->pixels->GetData(), 0, mPageSize*mPageSize);
+		else
+			page->pixels->Fill(Color4(255, 255, 255, 0));
+
+		MarkPageDirty(page, RectI(0, mPageSize, mPageSize, 0));
+
+		if (mPages.IsEmpty())
+		{
+			mTexture = page->texture;
+			mTextureSrcRect.Set(0, 0, mPageSize, mPageSize);
+		}
+
+		return page;
+	}
+
+	void VectorFont::EvictPage(int pageIdx)
+	{
+		Page* page = mPages[pageIdx];
+		page->skyline.Clear();
+		page->skyline.Add({ 0, 0, mPageSize });
+
+		if (page->pixels->GetFormat() == PixelFormat::R8)
+			memset(page->pixels->GetData(), 0, mPageSize*mPageSize);
+		else
+			page->pixels->Fill(Color4(255, 255, 255, 0));
+
+		MarkPageDirty(page, RectI(0, mPageSize, mPageSize, 0));
+
+		for (auto& heightKV : mCharacters)
+			heightKV.second.RemoveAll([=](const UInt16& id, const Character& character) { return character.mPage == pageIdx; });
+	}
+
+	void VectorFont::MarkPageDirty(Page* page, const RectI& rect)
+	{
+		if (!page->dirty)
+		{
+			page->dirtyRect = rect;
+			page->dirty = true;
+			return;
+		}
+
+		page->dirtyRect.left = Math::Min(page->dirtyRect.left, rect.left);
+		page->dirtyRect.right = Math::Max(page->dirtyRect.right, rect.right);
+		page->dirtyRect.bottom = Math::Min(page->dirtyRect.bottom, rect.bottom);
+		page->dirtyRect.top = Math::Max(page->dirtyRect.top, rect.top);
+	}
+
+	void VectorFont::UploadPages()
+	{
+		for (auto page : mPages)
+		{
+			if (!page->dirty)
+				continue;
+
+			page->dirty = false;
+
+			PixelFormat format = page->pixels->GetFormat();
+			int bytesPerPixel = format == PixelFormat::R8 ? 1 : 4;
+
+			if (page->dirtyRect.Width() == mPageSize && page->dirtyRect.Height() == mPageSize)
+			{
+				page->texture->SetData(page->pixels);
+				continue;
+			}
+
+			// Copy only changed rows part and upload it as sub rectangle
+			Vec2I size(page->dirtyRect.Width(), page->dirtyRect.Height());
+			Bitmap dirtyPixels(format, size);
+
+			const UInt8* src = page->pixels->GetData();
+			UInt8* dst = dirtyPixels.GetData();
+			for (int y = 0; y < size.y; y++)
+			{
+				memcpy(dst + y*size.x*bytesPerPixel,
+					   src + ((page->dirtyRect.bottom + y)*mPageSize + page->dirtyRect.left)*bytesPerPixel,
+					   size.x*bytesPerPixel);
+			}
+
+			page->texture->SetSubData(page->dirtyRect.LeftBottom(), &dirtyPixels);
+		}
+	}
+
+	void VectorFont::ClearPages()
+	{
+		for (auto page : mPages)
+		{
+			delete page->pixels;
+			delete page;
+		}
 
-		delete character.bitmap;
+		mPages.Clear();
 	}
 }
 
@@ -14,9 +14,13 @@ namespace o2
 	class RectsPacker;
 	class Bitmap;
 
-	// -----------
-	// Vector font
-	// -----------
+	// ------------------------------------------------------------------------------------------
+	// Vector font. Renders glyphs on demand into multi-page atlas, glyphs are packed by skyline.
+	// Without effects glyphs are stored in single channel pages, color is taken from vertices.
+	// When all pages are full, least recently used page is cleared and its glyphs are rendered
+	// again on demand. In distance field mode glyphs are rendered once as signed distance field
+	// and shared by all heights
+	// ------------------------------------------------------------------------------------------
 	class VectorFont: public Font
 	{
 	public:
@@ -66,6 +70,9 @@ namespace o2
 		// Checks characters for preloading
 		void CheckCharacters(const WString& needChararacters, int height);
 
+		// Marks texture pages as used by next characters check, so they aren't evicted while it renders new characters
+		void SetPagesUsed(const Vector<int>& pages);
+
 		// Adds effect
 		Effect* AddEffect(Effect* effect);
 
@@ -88,45 +95,65 @@ namespace o2
 		// Removes all cached characters
 		void Reset();
 
-	protected:
-		struct PackLine;
+		// Returns texture of characters page
+		TextureRef GetPageTexture(int page) const override;
 
-		//-------------------------------
-		// Font glyph rendering character
-		// ------------------------------
-		struct CharDef
-		{
-			PackLine* packLine;
-			RectI     rect;
-			Character character;
-			Bitmap*   bitmap;
+		// Returns count of atlas pages
+		int GetPagesCount() const;
 
-			bool operator==(const CharDef& other) const { return false; }
-		};
+		// Sets max count of atlas pages. When all of them are full, least recently used page is evicted
+		void SetMaxPagesCount(int count);
 
-		// -----------------------
-		// Characters packing line
-		// -----------------------
-		struct PackLine
-		{
-			int position = 0;
-			int height = 0;
-			int length = 0;
+		// Returns max count of atlas pages
+		int GetMaxPagesCount() const;
 
-			Vector<CharDef> characters;
+		// Sets signed distance field mode: glyphs are rendered once with base height and scaled for other heights. Effects are ignored
+		void SetDistanceField(bool enabled);
 
-		public:
-			bool operator==(const PackLine& other) const { return false; }
+		// Returns is signed distance field mode enabled
+		bool IsDistanceField() const;
+
+	protected:
+		// --------------------------------------------------
+		// Skyline segment: horizontal segment of filled area
+		// --------------------------------------------------
+		struct SkylineNode
+		{
+			int x;     // Segment left position
+			int y;     // Filled area height under segment
+			int width; // Segment width
+		};
+
+		// -------------------------------------------------------------------------------------
+		// Glyphs atlas page. Keeps pixels copy, glyphs are rendered into it and changed area is
+		// uploaded into texture once after rendering new characters
+		// -------------------------------------------------------------------------------------
+		struct Page
+		{
+			TextureRef          texture;          // Page texture
+			Bitmap*             pixels = nullptr; // Page pixels copy
+			Vector<SkylineNode> skyline;          // Skyline of filled area, sorted by x
+			RectI               dirtyRect;        // Changed area, not uploaded into texture. Top is greater than bottom
+			bool                dirty = false;    // True when page has changes, not uploaded into texture
+			UInt                lastUseStamp = 0; // Characters check stamp, when page's glyphs were used last time
 		};
 
 	protected:
+		const int mPageSize = 1024;           // Atlas page width and height
+		const int mDistanceFieldHeight = 48;  // Glyphs height in distance field mode, other heights are scaled from it
+		const int mDistanceFieldSpread = 6;   // Max distance to glyph edge in pixels, stored in distance field
+
 		String  mFileName;     // Source file name
 		FT_Face mFreeTypeFace; // Free Type font face
 
 		Vector<Effect*> mEffects; // Font effects
 
-		Vector<PackLine*> mPackLines;           // Packed symbols lines
-		int               mLastPackLinePos = 0; // Last packed line bottom pos
+		Vector<Page*> mPages;                    // Glyphs atlas pages
+		int           mMaxPagesCount = 4;        // Max count of pages, pages over limit are created only when all pages are in use
+		UInt          mUseStamp = 0;             // Current characters check stamp, increases on each check
+		bool          mNotifyingRebuilt = false; // True when font users are notified about rebuilt characters
+		bool          mPagesUsedMarked = false;  // True when pages were marked used by next check, it shares their stamp
+		bool          mDistanceField = false;    // Is signed distance field mode enabled
 
 		mutable Map<int, float> mHeights; // Cached line heights
 
@@ -134,11 +161,41 @@ namespace o2
 		// Updates characters set
 		void UpdateCharacters(Vector<wchar_t>& newCharacters, int height);
 
-		// Renders new characters
+		// Renders new characters into pages
 		void RenderNewCharacters(Vector<wchar_t>& newCharacters, int height);
 
-		// Packs character in line 
-		void PackCharacter(CharDef& character, int height);
+		// Adds characters with height, scaled from distance field characters
+		void AddScaledCharacters(const WString& characters, int height);
+
+		// Writes signed distance field of glyph bitmap into page data. Page rows are stored from bottom to top
+		void WriteDistanceField(const FT_Bitmap& bitmap, int border, UInt8* dst, const Vec2I& cellSize) const;
+
+		// Calculates squared distances to nearest zero values along line in place, by lower envelope of parabolas
+		static void DistanceTransform(float* values, int count, int stride, float* f, int* v, float* z);
+
+		// Searches place for glyph in pages, creates or evicts page when there is no place. Returns page index or -1
+		int AllocateGlyph(const Vec2I& size, Vec2I& position);
+
+		// Searches lowest skyline position for glyph. Returns skyline node index or -1 when glyph doesn't fit
+		int FindSkylinePosition(const Page* page, const Vec2I& size, Vec2I& position) const;
+
+		// Adds glyph rectangle at skyline node
+		void AddSkylineLevel(Page* page, int nodeIdx, const Vec2I& position, const Vec2I& size);
+
+		// Creates new empty page
+		Page* CreatePage();
+
+		// Clears page and removes its characters. They will be rendered again on next check
+		void EvictPage(int pageIdx);
+
+		// Marks page's area as changed
+		void MarkPageDirty(Page* page, const RectI& rect);
+
+		// Uploads changed areas of pages into textures
+		void UploadPages();
+
+		// Removes all pages
+		void ClearPages();
 	};
 
 	template<typename _eff_type, typename ... _args>
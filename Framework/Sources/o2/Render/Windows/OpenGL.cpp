@@ -24,6 +24,8 @@ void GetGLExtensions(o2::LogStream* log /*= nullptr*/)
 	glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteBuffers", log);
 	glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSPROC)GetSafeWGLProcAddress("glDeleteFramebuffersEXT", log);
 	glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)GetSafeWGLProcAddress("glCheckFramebufferStatusEXT", log);
+	glActiveTexture = (PFNGLACTIVETEXTUREPROC)GetSafeWGLProcAddress("glActiveTexture", log);
+	glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)GetSafeWGLProcAddress("glBlendFuncSeparate", log);
 
 }
 
@@ -97,5 +99,7 @@ extern PFNGLDRAWBUFFERSPROC               glDrawBuffers = NULL;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers = NULL;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT = NULL;
 extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT = NULL;
+extern PFNGLACTIVETEXTUREPROC             glActiveTexture = NULL;
+extern PFNGLBLENDFUNCSEPARATEPROC         glBlendFuncSeparate = NULL;
 
 #endif // PLATFORM_WINDOWS
@@ -39,5 +39,7 @@ extern PFNGLDRAWBUFFERSPROC               glDrawBuffers;
 extern PFNGLDELETEBUFFERSPROC             glDeleteBuffers;
 extern PFNGLDELETEFRAMEBUFFERSPROC        glDeleteFramebuffersEXT;
 extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
+extern PFNGLACTIVETEXTUREPROC             glActiveTexture;
+extern PFNGLBLENDFUNCSEPARATEPROC         glBlendFuncSeparate;
 
 #endif // PLATFORM_WINDOWS
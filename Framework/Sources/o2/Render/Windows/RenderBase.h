@@ -21,6 +21,12 @@ namespace o2
 		UInt16* mVertexIndexData;          // Index data buffer
 		UInt    mVertexBufferSize = 6000;  // Maximum size of vertex buffer
 		UInt    mIndexBufferSize = 6000*3; // Maximum size of index buffer
+
+		bool mDistanceFieldMode = false; // True when texture stages are set up for distance field texture
+
+	protected:
+		// Sets up texture stages for drawing distance field texture or restores default modulation
+		void SetDistanceFieldMode(bool enabled, GLuint textureHandle);
 	};
 };
 
@@ -13,6 +13,7 @@
 #include "o2/Render/Texture.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Utils/Math/Geometry.h"
 #include "o2/Utils/Math/Interpolation.h"
 
@@ -115,7 +116,11 @@ namespace o2
 		glVertexPointer(3, GL_FLOAT, sizeof(Vertex2), mVertexData + 0);
 
 		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+		// Single channel and RGB textures rows aren't aligned by 4 bytes
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
 
 		glLineWidth(1.0f);
 
@@ -208,6 +213,8 @@ namespace o2
 		mDIPCount = 0;
 		mCurrentPrimitiveType = PrimitiveType::Polygon;
 
+		BeginStatsFrame();
+
 		mDrawingDepth = 0.0f;
 
 		mScissorInfos.Clear();
@@ -222,17 +229,21 @@ namespace o2
 		preRender.Clear();
 	}
 
-	void Render::DrawPrimitives()
+	void Render::DrawPrimitives(BatchBreakReason reason)
 	{
 		if (mLastDrawVertex < 1)
 			return;
 
+		PROFILE_SCOPE("Render::DrawPrimitives");
+
 		static const GLenum primitiveType[3]{ GL_TRIANGLES, GL_TRIANGLES, GL_LINES };
 
 		glDrawElements(primitiveType[(int)mCurrentPrimitiveType], mLastDrawIdx, GL_UNSIGNED_SHORT, mVertexIndexData);
 
 		GL_CHECK_ERROR();
 
+		AddStatsDrawCall(reason);
+
 		mFrameTrianglesCount += mTrianglesCount;
 		mLastDrawVertex = mTrianglesCount = mLastDrawIdx = 0;
 
@@ -262,9 +273,14 @@ namespace o2
 		postRender();
 		postRender.Clear();
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::FrameEnd);
 		SwapBuffers(mHDC);
 
+		PROFILE_COUNTER("Draw calls", mDIPCount);
+		PROFILE_COUNTER("Triangles", mFrameTrianglesCount);
+
+		EndStatsFrame();
+
 		GL_CHECK_ERROR();
 
 		CheckTexturesUnloading();
@@ -281,7 +297,7 @@ namespace o2
 
 	void Render::UpdateCameraTransforms()
 	{
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Camera);
 
 		Vec2F resf = (Vec2F)mCurrentResolution;
 
@@ -317,7 +333,7 @@ namespace o2
 		if (mStencilDrawing || mStencilTest)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glEnable(GL_STENCIL_TEST);
 		glStencilFunc(GL_ALWAYS, 0x1, 0xffffffff);
@@ -334,7 +350,7 @@ namespace o2
 		if (!mStencilDrawing)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glDisable(GL_STENCIL_TEST);
 		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -349,7 +365,7 @@ namespace o2
 		if (mStencilTest || mStencilDrawing)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glEnable(GL_STENCIL_TEST);
 		glStencilFunc(GL_EQUAL, 0x1, 0xffffffff);
@@ -364,7 +380,7 @@ namespace o2
 		if (!mStencilTest)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Stencil);
 
 		glDisable(GL_STENCIL_TEST);
 
@@ -379,9 +395,31 @@ namespace o2
 		GL_CHECK_ERROR();
 	}
 
+	void Render::SetBlendMode(BlendMode mode)
+	{
+		if (mBlendMode == mode)
+			return;
+
+		DrawPrimitives(BatchBreakReason::BlendMode);
+
+		if (mode == BlendMode::Premultiplied)
+			glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+		else
+			glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+		GL_CHECK_ERROR();
+
+		mBlendMode = mode;
+	}
+
+	BlendMode Render::GetBlendMode() const
+	{
+		return mBlendMode;
+	}
+
 	void Render::EnableScissorTest(const RectI& rect)
 	{
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Scissor);
 
 		RectI summaryScissorRect = rect;
 		if (!mStackScissors.IsEmpty())
@@ -424,7 +462,7 @@ namespace o2
 			return;
 		}
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::Scissor);
 
 		if (forcible)
 		{
@@ -490,16 +528,25 @@ namespace o2
 		else
 			indexesCount = elementsCount * 3;
 
-		if (mLastDrawTexture != texture.mTexture ||
-			mLastDrawVertex + verticesCount >= mVertexBufferSize ||
-			mLastDrawIdx + indexesCount >= mIndexBufferSize ||
-			mCurrentPrimitiveType != primitiveType)
+		bool textureChanged = mLastDrawTexture != texture.mTexture;
+		bool bufferOverflow = mLastDrawVertex + verticesCount >= mVertexBufferSize ||
+			mLastDrawIdx + indexesCount >= mIndexBufferSize;
+
+		if (textureChanged || bufferOverflow || mCurrentPrimitiveType != primitiveType)
 		{
-			DrawPrimitives();
+			if (textureChanged)
+				DrawPrimitives(BatchBreakReason::TextureChange);
+			else if (bufferOverflow)
+				DrawPrimitives(BatchBreakReason::BufferOverflow);
+			else
+				DrawPrimitives(BatchBreakReason::PrimitiveType);
 
 			mLastDrawTexture = texture.mTexture;
 			mCurrentPrimitiveType = primitiveType;
 
+			if (textureChanged && mLastDrawTexture)
+				mStats.textureBinds++;
+
 			if (primitiveType == PrimitiveType::PolygonWire)
 				glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
 			else
@@ -510,11 +557,22 @@ namespace o2
 				glEnable(GL_TEXTURE_2D);
 				glBindTexture(GL_TEXTURE_2D, mLastDrawTexture->mHandle);
 
+				if (mLastDrawTexture->mDistanceField || mDistanceFieldMode)
+					SetDistanceFieldMode(mLastDrawTexture->mDistanceField, mLastDrawTexture->mHandle);
+
 				GL_CHECK_ERROR();
 			}
-			else glDisable(GL_TEXTURE_2D);
+			else
+			{
+				if (mDistanceFieldMode)
+					SetDistanceFieldMode(false, 0);
+
+				glDisable(GL_TEXTURE_2D);
+			}
 		}
 
+		AddStatsGeometry(verticesCount, primitiveType != PrimitiveType::Line ? elementsCount : 0);
+
 		memcpy(&mVertexData[mLastDrawVertex * sizeof(Vertex2)], vertices, sizeof(Vertex2)*verticesCount);
 
 		for (UInt i = mLastDrawIdx, j = 0; j < indexesCount; i++, j++)
@@ -527,6 +585,51 @@ namespace o2
 		mLastDrawIdx += indexesCount;
 	}
 
+	void RenderBase::SetDistanceFieldMode(bool enabled, GLuint textureHandle)
+	{
+		mDistanceFieldMode = enabled;
+
+		if (!enabled)
+		{
+			glActiveTexture(GL_TEXTURE1);
+			glDisable(GL_TEXTURE_2D);
+			glActiveTexture(GL_TEXTURE0);
+			glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+			return;
+		}
+
+		// There are no shaders in fixed pipeline, so edge smoothstep is approximated by linear ramp.
+		// First stage: color from vertices, alpha = (distance + 0.125 - 0.5)*4, it is 0..1 for distance 0.375..0.625
+		GLfloat rampOffset[] = { 0.0f, 0.0f, 0.0f, 0.125f };
+
+		glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+		glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_REPLACE);
+		glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_PRIMARY_COLOR);
+		glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_RGB, GL_SRC_COLOR);
+		glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_ADD_SIGNED);
+		glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA, GL_TEXTURE);
+		glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_ALPHA, GL_SRC_ALPHA);
+		glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_ALPHA, GL_CONSTANT);
+		glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA);
+		glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, rampOffset);
+		glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 4.0f);
+
+		// Second stage: multiplies alpha by vertices alpha. Stage is enabled only with complete texture, so same texture is bound
+		glActiveTexture(GL_TEXTURE1);
+		glEnable(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, textureHandle);
+		glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+		glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_REPLACE);
+		glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_PREVIOUS);
+		glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_RGB, GL_SRC_COLOR);
+		glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_MODULATE);
+		glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA, GL_PREVIOUS);
+		glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_ALPHA, GL_SRC_ALPHA);
+		glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_ALPHA, GL_PRIMARY_COLOR);
+		glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA);
+		glActiveTexture(GL_TEXTURE0);
+	}
+
 	void Render::BindRenderTexture(TextureRef renderTarget)
 	{
 		if (!renderTarget)
@@ -549,7 +652,8 @@ namespace o2
 			return;
 		}
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::RenderTarget);
+		mStats.renderTargetSwitches++;
 
 		if (!mStackScissors.IsEmpty())
 		{
@@ -573,7 +677,8 @@ namespace o2
 		if (!mCurrentRenderTarget)
 			return;
 
-		DrawPrimitives();
+		DrawPrimitives(BatchBreakReason::RenderTarget);
+		mStats.renderTargetSwitches++;
 
 		glBindFramebufferEXT(GL_FRAMEBUFFER, 0);
 		GL_CHECK_ERROR();
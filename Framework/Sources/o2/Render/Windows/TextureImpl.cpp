@@ -43,6 +43,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (format == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (format == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, (GLsizei)size.x, (GLsizei)size.y, 0, texFormat, GL_UNSIGNED_BYTE, NULL);
 
@@ -109,6 +111,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glTexImage2D(GL_TEXTURE_2D, 0, texFormat, bitmap->GetSize().x, bitmap->GetSize().y, 0, texFormat, GL_UNSIGNED_BYTE,
 					 bitmap->GetData());
@@ -133,6 +137,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		mSize = bitmap->GetSize();
 
@@ -154,6 +160,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, bitmap->GetSize().x, bitmap->GetSize().y, texFormat, GL_UNSIGNED_BYTE,
 						bitmap->GetData());
@@ -173,6 +181,8 @@ namespace o2
 			texFormat = GL_RGBA;
 		else if (mFormat == PixelFormat::R8G8B8)
 			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
 
 		glCopyTexImage2D(GL_TEXTURE_2D, 0, texFormat, rect.left, rect.top, rect.Width(), rect.Height(), 0);
 		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
@@ -182,9 +192,17 @@ namespace o2
 	{
 		Bitmap* bitmap = mnew Bitmap(mFormat, mSize);
 
+		GLint texFormat = GL_RGB;
+		if (mFormat == PixelFormat::R8G8B8A8)
+			texFormat = GL_RGBA;
+		else if (mFormat == PixelFormat::R8G8B8)
+			texFormat = GL_RGB;
+		else if (mFormat == PixelFormat::R8)
+			texFormat = GL_ALPHA;
+
 		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
 		glBindTexture(GL_TEXTURE_2D, mHandle);
-		glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, bitmap->GetData());
+		glGetTexImage(GL_TEXTURE_2D, 0, texFormat, GL_UNSIGNED_BYTE, bitmap->GetData());
 		glBindTexture(GL_TEXTURE_2D, prevTextureHandle);
 
 		return bitmap;
@@ -199,7 +217,7 @@ namespace o2
 			type = GL_NEAREST;
 
 		auto prevTextureHandle = o2Render.mLastDrawTexture ? o2Render.mLastDrawTexture->mHandle : 0;
-		o2Render.DrawPrimitives();
+		o2Render.DrawPrimitives(BatchBreakReason::TextureUpdate);
 
 		glBindTexture(GL_TEXTURE_2D, mHandle);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, type);
@@ -824,6 +824,30 @@ namespace o2
 			comp->OnComponentRemoving(component);
 	}
 
+	void Actor::OnCollisionEnter(const Collision& collision)
+	{
+		for (auto comp : mComponents)
+			comp->OnCollisionEnter(collision);
+	}
+
+	void Actor::OnCollisionExit(const Collision& collision)
+	{
+		for (auto comp : mComponents)
+			comp->OnCollisionExit(collision);
+	}
+
+	void Actor::OnTriggerEnter(const Collision& collision)
+	{
+		for (auto comp : mComponents)
+			comp->OnTriggerEnter(collision);
+	}
+
+	void Actor::OnTriggerExit(const Collision& collision)
+	{
+		for (auto comp : mComponents)
+			comp->OnTriggerExit(collision);
+	}
+
 	void Actor::UpdateResEnabled()
 	{
 		mResEnabled = mEnabled;
@@ -4,6 +4,7 @@
 #include "o2/Scene/ActorCreationMode.h"
 #include "o2/Scene/ActorRef.h"
 #include "o2/Scene/ActorTransform.h"
+#include "o2/Scene/Physics/Collision.h"
 #include "o2/Scene/Tags.h"
 #include "o2/Utils/Editor/Attributes/AnimatableAttribute.h"
 #include "o2/Utils/Editor/Attributes/EditorPropertyAttribute.h"
@@ -535,6 +536,20 @@ namespace o2
 		// It is called when component going to be removed from actor
 		virtual void OnComponentRemoving(Component* component);
 
+		// It is called after physics step when actor's collider began touching other collider. Calls components
+		virtual void OnCollisionEnter(const Collision& collision);
+
+		// It is called after physics step when actor's collider stopped touching other collider. Calls components
+		virtual void OnCollisionExit(const Collision& collision);
+
+		// It is called after physics step when actor's collider began overlapping sensor or actor's sensor began
+		// overlapping other collider. Calls components
+		virtual void OnTriggerEnter(const Collision& collision);
+
+		// It is called after physics step when actor's collider stopped overlapping sensor or actor's sensor stopped
+		// overlapping other collider. Calls components
+		virtual void OnTriggerExit(const Collision& collision);
+
 #if IS_EDITOR
 
 		// -----------------------------
@@ -606,6 +621,7 @@ namespace o2
 		friend class Component;
 		friend class DrawableComponent;
 		friend class ISceneDrawable;
+		friend class PhysicsWorld;
 		friend class Scene;
 		friend class SceneLayer;
 		friend class Tag;
@@ -892,6 +908,10 @@ CLASS_METHODS_META(o2::Actor)
 	PROTECTED_FUNCTION(void, OnLayerChanged, SceneLayer*);
 	PROTECTED_FUNCTION(void, OnComponentAdded, Component*);
 	PROTECTED_FUNCTION(void, OnComponentRemoving, Component*);
+	PROTECTED_FUNCTION(void, OnCollisionEnter, const Collision&);
+	PROTECTED_FUNCTION(void, OnCollisionExit, const Collision&);
+	PROTECTED_FUNCTION(void, OnTriggerEnter, const Collision&);
+	PROTECTED_FUNCTION(void, OnTriggerExit, const Collision&);
 	PROTECTED_FUNCTION(void, SerializeWithProto, DataValue&);
 	PROTECTED_FUNCTION(void, DeserializeWithProto, const DataValue&);
 	PROTECTED_FUNCTION(void, ProcessPrototypeMaking, Actor*, Actor*, Vector<Actor**>&, Vector<Component**>&, _tmp7, _tmp8, bool);
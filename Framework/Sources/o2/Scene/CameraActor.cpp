@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "CameraActor.h"
 
+#include "o2/Render/Render.h"
 #include "o2/Scene/Scene.h"
 
 namespace o2
@@ -42,12 +43,13 @@ namespace o2
 		Camera prevCamera = o2Render.GetCamera();
 		Setup();
 
+		String prevStatsCamera = o2Render.GetStatsCamera();
+		o2Render.SetStatsCamera(mName);
+
 		for (auto layer : drawLayers.GetLayers())
-		{
-			for (auto comp : layer->mEnabledDrawables)
-				comp->Draw();
-		}
+			layer->Draw();
 
+		o2Render.SetStatsCamera(prevStatsCamera);
 		o2Render.SetCamera(prevCamera);
 	}
 
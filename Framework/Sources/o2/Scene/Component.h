@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Scene/Physics/Collision.h"
 #include "o2/Scene/SceneLayer.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
@@ -152,6 +153,18 @@ namespace o2
 		// It is called when component going to be removed from actor
 		virtual void OnComponentRemoving(Component* component) {}
 
+		// It is called after physics step when actor's collider began touching other collider
+		virtual void OnCollisionEnter(const Collision& collision) {}
+
+		// It is called after physics step when actor's collider stopped touching other collider
+		virtual void OnCollisionExit(const Collision& collision) {}
+
+		// It is called after physics step when actor's collider began overlapping other collider, one of them is sensor
+		virtual void OnTriggerEnter(const Collision& collision) {}
+
+		// It is called after physics step when actor's collider stopped overlapping other collider, one of them is sensor
+		virtual void OnTriggerExit(const Collision& collision) {}
+
 		friend class Actor;
 		friend class Scene;
 		friend class Widget;
@@ -262,5 +275,9 @@ CLASS_METHODS_META(o2::Component)
 	PROTECTED_FUNCTION(void, OnLayerChanged, SceneLayer*);
 	PROTECTED_FUNCTION(void, OnComponentAdded, Component*);
 	PROTECTED_FUNCTION(void, OnComponentRemoving, Component*);
+	PROTECTED_FUNCTION(void, OnCollisionEnter, const Collision&);
+	PROTECTED_FUNCTION(void, OnCollisionExit, const Collision&);
+	PROTECTED_FUNCTION(void, OnTriggerEnter, const Collision&);
+	PROTECTED_FUNCTION(void, OnTriggerExit, const Collision&);
 }
 END_META;
@@ -1,14 +1,28 @@
 #include "o2/stdafx.h"
 #include "AnimationComponent.h"
 
+#include "o2/Animation/AnimationLODSystem.h"
 #include "o2/Animation/Tracks/AnimationTrack.h"
+#include "o2/Scene/Actor.h"
 
 namespace o2
 {
-	AnimationComponent::AnimationComponent()
+	// Returns initial LOD frames phase for new component. Phase spreads reduced rate updates of many components
+	// between frames; it depends on creation order, so it is the same on each run
+	static int GetNextLODPhase()
+	{
+		static int createdComponents = 0;
+		return createdComponents++%8;
+	}
+
+	AnimationComponent::AnimationComponent():
+		mLODSkippedFrames(GetNextLODPhase())
 	{}
 
-	AnimationComponent::AnimationComponent(const AnimationComponent& other)
+	AnimationComponent::AnimationComponent(const AnimationComponent& other):
+		lodEnabled(other.lodEnabled), lodBoundsMargin(other.lodBoundsMargin), lodSmallScreenPart(other.lodSmallScreenPart),
+		lodSmallUpdatePeriod(other.lodSmallUpdatePeriod), lodInvisibleUpdatePeriod(other.lodInvisibleUpdatePeriod),
+		mLODSkippedFrames(GetNextLODPhase())
 	{
 		for (auto state : other.mStates)
 			AddState(state->CloneAs<AnimationState>());
@@ -16,6 +30,9 @@ namespace o2
 
 	AnimationComponent::~AnimationComponent()
 	{
+		if (mLODUpdateScheduled && AnimationLODSystem::IsSingletonInitialzed())
+			o2AnimationLOD.CancelUpdate(this);
+
 		RemoveAllStates();
 	}
 
@@ -26,6 +43,12 @@ namespace o2
 		for (auto state : other.mStates)
 			AddState(state->CloneAs<AnimationState>());
 
+		lodEnabled = other.lodEnabled;
+		lodBoundsMargin = other.lodBoundsMargin;
+		lodSmallScreenPart = other.lodSmallScreenPart;
+		lodSmallUpdatePeriod = other.lodSmallUpdatePeriod;
+		lodInvisibleUpdatePeriod = other.lodInvisibleUpdatePeriod;
+
 		return *this;
 	}
 
@@ -34,17 +57,32 @@ namespace o2
 		if (mInEditMode)
 			return;
 
+		mLODSkippedTime += dt;
+
+		if (!CheckLODUpdate())
+			return;
+
+		UpdateAnimation();
+	}
+
+	void AnimationComponent::UpdateAnimation()
+	{
+		float updateDt = mLODSkippedTime;
+		mLODSkippedTime = 0.0f;
+
 		for (auto state : mStates)
 		{
 			if (state->mAnimation)
-				state->player.Update(dt);
+				state->player.Update(updateDt);
 		}
 
+		UpdateBindings();
+
 		for (auto val : mValues)
 			val->Update();
 
 		if (mBlend.time > 0)
-			mBlend.Update(dt);
+			mBlend.Update(updateDt);
 	}
 
 	AnimationState* AnimationComponent::AddState(AnimationState* state)
@@ -239,6 +277,11 @@ namespace o2
 		mInEditMode = false;
 	}
 
+	void AnimationComponent::InvalidateBindings()
+	{
+		mBindingsChanged = true;
+	}
+
 	void AnimationComponent::UnregTrack(IAnimationTrack::IPlayer* player, const String& path)
 	{
 		for (auto val : mValues)
@@ -246,6 +289,7 @@ namespace o2
 			if (val->path == path)
 			{
 				val->RemoveTrack(player);
+				mBindingsChanged = true;
 
 				if (val->IsEmpty())
 				{
@@ -258,6 +302,65 @@ namespace o2
 		}
 	}
 
+	void AnimationComponent::UpdateBindings()
+	{
+		if (!mBindingsChanged)
+			return;
+
+		for (auto val : mValues)
+			val->Bind();
+
+		mBindingsChanged = false;
+	}
+
+	bool AnimationComponent::CheckLODUpdate()
+	{
+		if (!lodEnabled || !mOwner)
+			return true;
+
+		RectF bounds = mOwner->transform->GetWorldAxisAlignedRect();
+		bounds.left -= lodBoundsMargin;
+		bounds.right += lodBoundsMargin;
+		bounds.bottom -= lodBoundsMargin;
+		bounds.top += lodBoundsMargin;
+
+		float screenPart = o2AnimationLOD.GetScreenPart(bounds);
+
+		int updatePeriod = 1;
+		if (screenPart <= 0.0f)
+			updatePeriod = lodInvisibleUpdatePeriod;
+		else if (screenPart < lodSmallScreenPart)
+			updatePeriod = lodSmallUpdatePeriod;
+
+		if (updatePeriod == 1)
+		{
+			o2AnimationLOD.SpendBudget(GetEvaluatingTracksCount());
+			mLODSkippedFrames = 0;
+			return true;
+		}
+
+		mLODSkippedFrames++;
+
+		if (updatePeriod <= 0 || mLODSkippedFrames < updatePeriod)
+			return false;
+
+		// Reduced rate updates share budget, LOD system updates them after all actors, longest waiting first
+		o2AnimationLOD.ScheduleUpdate(this);
+		return false;
+	}
+
+	int AnimationComponent::GetEvaluatingTracksCount() const
+	{
+		int res = 0;
+		for (auto state : mStates)
+		{
+			if (state->mAnimation)
+				res += state->player.GetTrackPlayers().Count();
+		}
+
+		return res;
+	}
+
 	void AnimationComponent::OnStateAnimationTrackAdded(AnimationState* state, IAnimationTrack::IPlayer* player)
 	{
 		player->RegMixer(state, player->GetTrack()->path);
@@ -295,45 +398,49 @@ namespace o2
 	template<>
 	void AnimationComponent::TrackMixer<int>::Update()
 	{
-		AnimationState* firstValueState = tracks[0].first;
-		AnimationTrack<int>::Player* firstValue = tracks[0].second;
+		float weightsSum = 0.0f;
+		float valueSum = 0.0f;
 
-		float weightsSum = firstValueState->mWeight*firstValueState->blend*firstValueState->mask.GetNodeWeight(path);
-		float valueSum = (float)firstValue->GetValue();
-
-		for (int i = 1; i < tracks.Count(); i++)
+		for (auto& track : tracks)
 		{
-			AnimationState* valueState = tracks[i].first;
-			AnimationTrack<int>::Player* value = tracks[i].second;
-
-			weightsSum += valueState->mWeight*valueState->blend*valueState->mask.GetNodeWeight(path);
-			valueSum += (float)value->GetValue();
+			float weight = track.state->mWeight*track.state->blend*track.maskWeight;
+			weightsSum += weight;
+			valueSum += (float)track.player->GetValue()*weight;
 		}
 
+		if (weightsSum < FLT_EPSILON)
+			return;
+
 		int resValue = Math::RoundToInt(valueSum / weightsSum);
-		target->SetValue(resValue);
+
+		if (targetPtr)
+			*targetPtr = resValue;
+		else if (target)
+			target->SetValue(resValue);
 	}
 	
 	template<>
 	void AnimationComponent::TrackMixer<bool>::Update()
 	{
-		AnimationState* firstValueState = tracks[0].first;
-		AnimationTrack<bool>::Player* firstValue = tracks[0].second;
-	
-		float weightsSum = firstValueState->mWeight*firstValueState->blend*firstValueState->mask.GetNodeWeight(path);
-		float valueSum = firstValue->GetValue() ? 1.0f : 0.0f;
-	
-		for (int i = 1; i < tracks.Count(); i++)
+		float weightsSum = 0.0f;
+		float valueSum = 0.0f;
+
+		for (auto& track : tracks)
 		{
-			AnimationState* valueState = tracks[i].first;
-			AnimationTrack<bool>::Player* value = tracks[i].second;
-	
-			weightsSum += valueState->mWeight*valueState->blend*valueState->mask.GetNodeWeight(path);
-			valueSum += value->GetValue() ? 1.0f : 0.0f;
+			float weight = track.state->mWeight*track.state->blend*track.maskWeight;
+			weightsSum += weight;
+			valueSum += track.player->GetValue() ? weight : 0.0f;
 		}
-	
+
+		if (weightsSum < FLT_EPSILON)
+			return;
+
 		bool resValue = (valueSum / weightsSum) > 0.5f;
-		target->SetValue(resValue);
+
+		if (targetPtr)
+			*targetPtr = resValue;
+		else if (target)
+			target->SetValue(resValue);
 	}
 }
 
@@ -17,6 +17,13 @@ namespace o2
 	// -------------------
 	class AnimationComponent: public Component, public IEditableAnimation
 	{
+	public:
+		bool  lodEnabled = false;           // Is update rate reduced for invisible or small on screen actor @SERIALIZABLE
+		float lodBoundsMargin = 0.0f;       // Actor bounds extension for visibility and screen size check @SERIALIZABLE
+		float lodSmallScreenPart = 0.1f;    // Part of camera size, below which actor is small and updates with reduced rate @SERIALIZABLE
+		int   lodSmallUpdatePeriod = 3;     // Count of frames between small actor updates @SERIALIZABLE
+		int   lodInvisibleUpdatePeriod = 0; // Count of frames between invisible actor updates, 0 freezes animation until it is visible @SERIALIZABLE
+
 	public:
 		// Default constructor
 		AnimationComponent();
@@ -91,6 +98,9 @@ namespace o2
 		// It is called when animation finished editing. ANimation must be reactivated
 		void EndAnimationEdit() override;
 
+		// Marks values bindings as changed, mask weights will be cached again on next update
+		void InvalidateBindings();
+
 		// Returns name of component
 		static String GetName();
 
@@ -117,6 +127,9 @@ namespace o2
 			// Updates value and blend
 			virtual void Update() = 0;
 
+			// Caches tracks mask weights by path
+			virtual void Bind() = 0;
+
 			// Removes Animation track from agent
 			virtual void RemoveTrack(IAnimationTrack::IPlayer* track) = 0;
 
@@ -131,9 +144,21 @@ namespace o2
 		struct TrackMixer: public ITrackMixer
 		{
 		public:
-			Vector<Pair<AnimationState*, typename AnimationTrack<_type>::Player*>> tracks; // Animation tracks associated with animation states
+			// ---------------------------------------------------
+			// Animation track player with state and cached weight
+			// ---------------------------------------------------
+			struct Track
+			{
+				AnimationState*                        state = nullptr;   // Animation state
+				typename AnimationTrack<_type>::Player* player = nullptr;  // Track player
+				float                                  maskWeight = 1.0f; // Cached state mask weight by path
+			};
+
+		public:
+			Vector<Track> tracks; // Animation tracks associated with animation states
 			
-			IValueProxy<_type>* target = nullptr; // Target value proxy
+			IValueProxy<_type>* target = nullptr;    // Target value proxy
+			_type*              targetPtr = nullptr; // Target value pointer, when it can be assigned directly without proxy
 
 		public:
 			// Destructor
@@ -142,6 +167,9 @@ namespace o2
 			// Updates value and blend
 			void Update() override;
 
+			// Caches tracks mask weights by path
+			void Bind() override;
+
 			// Removes Animation track from agent
 			void RemoveTrack(IAnimationTrack::IPlayer* track) override;
 
@@ -169,7 +197,13 @@ namespace o2
 
 		BlendState mBlend;  // Current blend parameters
 
-		bool mInEditMode = false; // True when some state animation is editing now, disables update
+		bool mInEditMode = false;      // True when some state animation is editing now, disables update
+		bool mBindingsChanged = false; // True when tracks or masks were changed and mixers must be bound again
+
+		float mLODSkippedTime = 0.0f; // Time of skipped by LOD updates, applied in next update for keeping animations in sync
+		int   mLODSkippedFrames = 0;  // Count of frames skipped by LOD since last update
+
+		bool mLODUpdateScheduled = false; // Is reduced rate update scheduled in animation LOD system
 
 	protected:
 		// Registers value by path and state
@@ -179,6 +213,19 @@ namespace o2
 		// Removes Animation track from agent by path
 		void UnregTrack(IAnimationTrack::IPlayer* player, const String& path);
 
+		// Binds mixers if they were changed
+		void UpdateBindings();
+
+		// Evaluates states and blending by time, skipped by LOD, and applies values to mixers
+		void UpdateAnimation();
+
+		// Returns true when animation must be evaluated in this frame immediately. Schedules reduced rate update
+		// in LOD system, when it's time to update by LOD settings
+		bool CheckLODUpdate();
+
+		// Returns count of tracks evaluated by update
+		int GetEvaluatingTracksCount() const;
+
 		// It is called when new track added in animation state, registers track player in mixer
 		void OnStateAnimationTrackAdded(AnimationState* state, IAnimationTrack::IPlayer* player);
 
@@ -189,6 +236,7 @@ namespace o2
 		void OnStatesListChanged();
 
 		friend class AnimationClip;
+		friend class AnimationLODSystem;
 		friend class AnimationState;
 		friend class IAnimationTrack;
 
@@ -212,6 +260,7 @@ namespace o2
 				}
 
 				agent->tracks.Add({ state, player });
+				mBindingsChanged = true;
 				return;
 			}
 		}
@@ -220,6 +269,7 @@ namespace o2
 		mValues.Add(newAgent);
 		newAgent->path = path;
 		newAgent->tracks.Add({ state, player });
+		mBindingsChanged = true;
 
 		const FieldInfo* fieldInfo = nullptr;
 		auto fieldPtr = (_type*)GetType().GetFieldPtr(mOwner, path, fieldInfo);
@@ -231,6 +281,9 @@ namespace o2
 		}
 
 		newAgent->target = dynamic_cast<IValueProxy<_type>*>(fieldInfo->GetType()->GetValueProxy(fieldPtr));
+
+		if (fieldInfo->GetType()->GetUsage() != Type::Usage::Property)
+			newAgent->targetPtr = fieldPtr;
 	}
 
 	template<typename _type>
@@ -249,7 +302,14 @@ namespace o2
 	template<typename _type>
 	void AnimationComponent::TrackMixer<_type>::RemoveTrack(IAnimationTrack::IPlayer* value)
 	{
-		tracks.RemoveAll([&](const auto& x) { return x.second == value; });
+		tracks.RemoveAll([&](const auto& x) { return x.player == value; });
+	}
+
+	template<typename _type>
+	void AnimationComponent::TrackMixer<_type>::Bind()
+	{
+		for (auto& track : tracks)
+			track.maskWeight = track.state->mask.GetNodeWeight(path);
 	}
 
 	template<>
@@ -261,23 +321,30 @@ namespace o2
 	template<typename _type>
 	void AnimationComponent::TrackMixer<_type>::Update()
 	{
-		AnimationState* firstValueState = tracks[0].first;
-		AnimationTrack<_type>::Player* firstValue = tracks[0].second;
+		const Track* track = tracks.Data();
 
-		float weightsSum = firstValueState->mWeight*firstValueState->blend*firstValueState->mask.GetNodeWeight(path);
-		_type valueSum = firstValue->GetValue();
+		float weight = track->state->mWeight*track->state->blend*track->maskWeight;
+		float weightsSum = weight;
+		_type valueSum = track->player->GetValue()*weight;
 
 		for (int i = 1; i < tracks.Count(); i++)
 		{
-			AnimationState* valueState = tracks[i].first;
-			AnimationTrack<_type>::Player* value = tracks[i].second;
+			track = tracks.Data() + i;
 
-			weightsSum += valueState->mWeight*valueState->blend*valueState->mask.GetNodeWeight(path);
-			valueSum += value->GetValue();
+			weight = track->state->mWeight*track->state->blend*track->maskWeight;
+			weightsSum += weight;
+			valueSum += track->player->GetValue()*weight;
 		}
 
+		if (weightsSum < FLT_EPSILON)
+			return;
+
 		_type resValue = valueSum / weightsSum;
-		target->SetValue(resValue);
+
+		if (targetPtr)
+			*targetPtr = resValue;
+		else if (target)
+			target->SetValue(resValue);
 	}
 }
 
@@ -289,10 +356,19 @@ CLASS_BASES_META(o2::AnimationComponent)
 END_META;
 CLASS_FIELDS_META(o2::AnimationComponent)
 {
+	PUBLIC_FIELD(lodEnabled).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(lodBoundsMargin).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(lodSmallScreenPart).DEFAULT_VALUE(0.1f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(lodSmallUpdatePeriod).DEFAULT_VALUE(3).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(lodInvisibleUpdatePeriod).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mStates).DEFAULT_TYPE_ATTRIBUTE(o2::AnimationState).DONT_DELETE_ATTRIBUTE().EDITOR_PROPERTY_ATTRIBUTE().INVOKE_ON_CHANGE_ATTRIBUTE(OnStatesListChanged).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mValues);
 	PROTECTED_FIELD(mBlend);
 	PROTECTED_FIELD(mInEditMode).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mBindingsChanged).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mLODSkippedTime).DEFAULT_VALUE(0.0f);
+	PROTECTED_FIELD(mLODSkippedFrames).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mLODUpdateScheduled).DEFAULT_VALUE(false);
 }
 END_META;
 CLASS_METHODS_META(o2::AnimationComponent)
@@ -318,10 +394,15 @@ CLASS_METHODS_META(o2::AnimationComponent)
 	PUBLIC_FUNCTION(void, StopAll);
 	PUBLIC_FUNCTION(void, BeginAnimationEdit);
 	PUBLIC_FUNCTION(void, EndAnimationEdit);
+	PUBLIC_FUNCTION(void, InvalidateBindings);
 	PUBLIC_STATIC_FUNCTION(String, GetName);
 	PUBLIC_STATIC_FUNCTION(String, GetCategory);
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PROTECTED_FUNCTION(void, UnregTrack, IAnimationTrack::IPlayer*, const String&);
+	PROTECTED_FUNCTION(void, UpdateBindings);
+	PROTECTED_FUNCTION(void, UpdateAnimation);
+	PROTECTED_FUNCTION(bool, CheckLODUpdate);
+	PROTECTED_FUNCTION(int, GetEvaluatingTracksCount);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackAdded, AnimationState*, IAnimationTrack::IPlayer*);
 	PROTECTED_FUNCTION(void, OnStateAnimationTrackRemoved, AnimationState*, IAnimationTrack::IPlayer*);
 	PROTECTED_FUNCTION(void, OnStatesListChanged);
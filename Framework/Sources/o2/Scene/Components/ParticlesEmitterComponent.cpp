@@ -1,6 +1,8 @@
 #include "o2/stdafx.h"
 #include "ParticlesEmitterComponent.h"
 
+#include "o2/Render/Mesh.h"
+#include "o2/Render/ParticlesSystem.h"
 #include "o2/Scene/Actor.h"
 
 namespace o2
@@ -30,7 +32,7 @@ namespace o2
 
 	void ParticlesEmitterComponent::Update(float dt)
 	{
-		ParticlesEmitter::Update(dt);
+		o2Particles.ScheduleUpdate(this, dt);
 	}
 
 	String ParticlesEmitterComponent::GetName()
@@ -59,6 +61,11 @@ namespace o2
 		ParticlesEmitter::OnDeserialized(node);
 	}
 
+	Texture* ParticlesEmitterComponent::GetSceneDrawableBatchTexture() const
+	{
+		return mParticlesMesh->GetTexture().Get();
+	}
+
 }
 
 DECLARE_CLASS(o2::ParticlesEmitterComponent);
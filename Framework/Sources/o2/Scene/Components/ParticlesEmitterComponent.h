@@ -20,7 +20,7 @@ namespace o2
 		// Draw particle system
 		void Draw() override;
 
-		// Updates component
+		// Schedules particles update in particles system, they are updated in parallel with other emitters
 		void Update(float dt) override;
 
 		// Returns name of component
@@ -38,6 +38,9 @@ namespace o2
 
 		// It is called when object was deserialized
 		void OnDeserialized(const DataValue& node) override;
+
+		// Returns particles texture, emitters with same depth are grouped by it when drawing
+		Texture* GetSceneDrawableBatchTexture() const override;
 	};
 }
 
@@ -61,5 +64,6 @@ CLASS_METHODS_META(o2::ParticlesEmitterComponent)
 	PUBLIC_STATIC_FUNCTION(String, GetIcon);
 	PROTECTED_FUNCTION(void, OnTransformUpdated);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
+	PROTECTED_FUNCTION(Texture*, GetSceneDrawableBatchTexture);
 }
 END_META;
@@ -0,0 +1,400 @@
+#include "o2/stdafx.h"
+#include "SkinnedMeshComponent.h"
+
+#include "o2/Scene/Actor.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define SKINNING_SSE
+#include <emmintrin.h>
+#endif
+
+namespace o2
+{
+	SkinnedMeshComponent::SkinnedMeshComponent():
+		DrawableComponent(), color(Color4::White()), mMesh(NoTexture(), 0, 0)
+	{}
+
+	SkinnedMeshComponent::SkinnedMeshComponent(const SkinnedMeshComponent& other):
+		DrawableComponent(other), bones(other.bones), vertices(other.vertices), indexes(other.indexes),
+		color(other.color), mImageAsset(other.mImageAsset), mMesh(NoTexture(), 0, 0)
+	{}
+
+	SkinnedMeshComponent::~SkinnedMeshComponent()
+	{}
+
+	SkinnedMeshComponent& SkinnedMeshComponent::operator=(const SkinnedMeshComponent& other)
+	{
+		DrawableComponent::operator=(other);
+
+		bones = other.bones;
+		vertices = other.vertices;
+		indexes = other.indexes;
+		color = other.color;
+		mImageAsset = other.mImageAsset;
+
+		SetSkinChanged();
+
+		return *this;
+	}
+
+	void SkinnedMeshComponent::Draw()
+	{
+		UpdateSkin();
+
+		if (mMesh.vertexCount == 0 || mMesh.polyCount == 0)
+			return;
+
+		mMesh.Draw();
+		DrawableComponent::OnDrawn();
+	}
+
+	void SkinnedMeshComponent::UpdateSkin()
+	{
+		bool skinChanged = mSkinChanged || mBonesWorld.Count() != bones.Count();
+		if (skinChanged)
+		{
+			UpdateSkinData();
+			mSkinChanged = false;
+		}
+
+		if (mMesh.vertexCount == 0 || mMesh.polyCount == 0)
+			return;
+
+		// Vertices are skinned only when bones or actor are moved, static meshes keep last skinned vertices
+		Basis actorBasis = mOwner ? mOwner->transform->GetWorldNonSizedBasis() : Basis::Identity();
+		if (CheckPoseChanged(actorBasis) || skinChanged)
+		{
+			UpdateBonesMatrices(actorBasis);
+			SkinVertices();
+		}
+	}
+
+	void SkinnedMeshComponent::SetImage(const ImageAssetRef& image)
+	{
+		mImageAsset = image;
+		UpdateTextureCoords();
+	}
+
+	const ImageAssetRef& SkinnedMeshComponent::GetImage() const
+	{
+		return mImageAsset;
+	}
+
+	void SkinnedMeshComponent::SetSkinChanged()
+	{
+		mSkinChanged = true;
+	}
+
+	void SkinnedMeshComponent::SetCurrentPoseAsBindPose()
+	{
+		for (auto& bone : bones)
+		{
+			bone.bindPosition = bone.position;
+			bone.bindAngle = bone.angle;
+			bone.bindScale = bone.scale;
+		}
+
+		SetSkinChanged();
+	}
+
+	int SkinnedMeshComponent::GetBoneIndex(const String& name) const
+	{
+		for (int i = 0; i < bones.Count(); i++)
+		{
+			if (bones[i].name == name)
+				return i;
+		}
+
+		return -1;
+	}
+
+	const Basis& SkinnedMeshComponent::GetBoneWorldBasis(int idx) const
+	{
+		return mBonesWorld[idx];
+	}
+
+	const Mesh& SkinnedMeshComponent::GetMesh() const
+	{
+		return mMesh;
+	}
+
+	String SkinnedMeshComponent::GetName()
+	{
+		return "Skinned mesh";
+	}
+
+	String SkinnedMeshComponent::GetCategory()
+	{
+		return "Render";
+	}
+
+	String SkinnedMeshComponent::GetIcon()
+	{
+		return "ui/UI4_image_component.png";
+	}
+
+	void SkinnedMeshComponent::UpdateSkinData()
+	{
+		int bonesCount = bones.Count();
+
+		// Check hierarchy order, flat pass requires parents before children. Serialized bones aren't changed,
+		// wrong parents are replaced only in runtime cache
+		mBonesParents.Resize(bonesCount);
+		for (int i = 0; i < bonesCount; i++)
+		{
+			mBonesParents[i] = bones[i].parent;
+
+			if (bones[i].parent >= i)
+			{
+				o2Debug.LogWarning("Skinned mesh bone " + bones[i].name + " is placed before its parent, it will be used as root");
+				mBonesParents[i] = -1;
+			}
+		}
+
+		mBindPoseInverted.Resize(bonesCount);
+		mBonesWorld.Resize(bonesCount);
+		mSkinMatrices.Resize(bonesCount);
+		mSkinnedPose.Resize(bonesCount*5);
+
+		for (int i = 0; i < bonesCount; i++)
+		{
+			int parent = mBonesParents[i];
+			mBonesWorld[i] = parent < 0 ? bones[i].GetBindLocalBasis() : bones[i].GetBindLocalBasis()*mBonesWorld[parent];
+		}
+
+		for (int i = 0; i < bonesCount; i++)
+			mBindPoseInverted[i] = mBonesWorld[i].Inverted();
+
+		// Pack vertices influences, invalid bones and zero weights are dropped
+		int verticesCount = bonesCount > 0 ? vertices.Count() : 0;
+		int trianglesCount = bonesCount > 0 ? indexes.Count()/3 : 0;
+
+		if (verticesCount > USHRT_MAX)
+		{
+			o2Debug.LogWarning("Skinned mesh has too many vertices: " + (String)verticesCount);
+			verticesCount = 0;
+			trianglesCount = 0;
+		}
+
+		mBindPositions.Resize(verticesCount*2);
+		mVertexBones.Resize(verticesCount*maxBoneInfluences);
+		mVertexWeights.Resize(verticesCount*maxBoneInfluences);
+
+		for (int i = 0; i < verticesCount; i++)
+		{
+			const Vertex& vertex = vertices[i];
+			mBindPositions[i*2] = vertex.position.x;
+			mBindPositions[i*2 + 1] = vertex.position.y;
+
+			int vertexBones[maxBoneInfluences] = { vertex.bone0, vertex.bone1, vertex.bone2, vertex.bone3 };
+			float vertexWeights[maxBoneInfluences] = { vertex.weight0, vertex.weight1, vertex.weight2, vertex.weight3 };
+
+			float weightsSum = 0.0f;
+			for (int j = 0; j < maxBoneInfluences; j++)
+			{
+				if (vertexBones[j] < 0 || vertexBones[j] >= bonesCount || vertexWeights[j] < 0.0f)
+				{
+					vertexBones[j] = 0;
+					vertexWeights[j] = 0.0f;
+				}
+
+				weightsSum += vertexWeights[j];
+			}
+
+			float invWeightsSum = weightsSum > FLT_EPSILON ? 1.0f/weightsSum : 0.0f;
+			for (int j = 0; j < maxBoneInfluences; j++)
+			{
+				mVertexBones[i*maxBoneInfluences + j] = vertexBones[j];
+				mVertexWeights[i*maxBoneInfluences + j] = weightsSum > FLT_EPSILON ? vertexWeights[j]*invWeightsSum : (j == 0 ? 1.0f : 0.0f);
+			}
+		}
+
+		// Rebuild mesh buffers
+		if (mMesh.GetMaxVertexCount() < (UInt)verticesCount || mMesh.GetMaxPolyCount() < (UInt)trianglesCount)
+			mMesh.Resize(verticesCount, trianglesCount);
+
+		ULong meshColor = color.ABGR();
+		for (int i = 0; i < verticesCount; i++)
+			mMesh.vertices[i] = Vertex2(vertices[i].position, meshColor, 0.0f, 0.0f);
+
+		int validTrianglesCount = 0;
+		for (int i = 0; i < trianglesCount; i++)
+		{
+			int a = indexes[i*3], b = indexes[i*3 + 1], c = indexes[i*3 + 2];
+			if (a < 0 || b < 0 || c < 0 || a >= verticesCount || b >= verticesCount || c >= verticesCount)
+				continue;
+
+			mMesh.indexes[validTrianglesCount*3] = (UInt16)a;
+			mMesh.indexes[validTrianglesCount*3 + 1] = (UInt16)b;
+			mMesh.indexes[validTrianglesCount*3 + 2] = (UInt16)c;
+			validTrianglesCount++;
+		}
+
+		mMesh.vertexCount = verticesCount;
+		mMesh.polyCount = validTrianglesCount;
+
+		UpdateTextureCoords();
+	}
+
+	void SkinnedMeshComponent::UpdateTextureCoords()
+	{
+		RectF uvRect(0.0f, 1.0f, 1.0f, 0.0f);
+
+		if (mImageAsset)
+		{
+			mMesh.SetTexture(TextureRef(mImageAsset->GetAtlas(), mImageAsset->GetAtlasPage()));
+
+			RectI srcRect = mImageAsset->GetAtlasRect();
+			Vec2F invTexSize(1.0f, 1.0f);
+			if (mMesh.GetTexture())
+				invTexSize.Set(1.0f/mMesh.GetTexture()->GetSize().x, 1.0f/mMesh.GetTexture()->GetSize().y);
+
+			uvRect.Set(srcRect.left*invTexSize.x, 1.0f - srcRect.bottom*invTexSize.y,
+					   srcRect.right*invTexSize.x, 1.0f - srcRect.top*invTexSize.y);
+		}
+		else
+			mMesh.SetTexture(NoTexture());
+
+		int verticesCount = Math::Min((int)mMesh.vertexCount, vertices.Count());
+		for (int i = 0; i < verticesCount; i++)
+		{
+			const Vec2F& uv = vertices[i].uv;
+			mMesh.vertices[i].SetUV(Math::Lerp(uvRect.left, uvRect.right, uv.x), Math::Lerp(uvRect.bottom, uvRect.top, uv.y));
+		}
+	}
+
+	bool SkinnedMeshComponent::CheckPoseChanged(const Basis& actorBasis)
+	{
+		bool changed = actorBasis.xv.x != mSkinnedActorBasis.xv.x || actorBasis.xv.y != mSkinnedActorBasis.xv.y ||
+			actorBasis.yv.x != mSkinnedActorBasis.yv.x || actorBasis.yv.y != mSkinnedActorBasis.yv.y ||
+			actorBasis.origin.x != mSkinnedActorBasis.origin.x || actorBasis.origin.y != mSkinnedActorBasis.origin.y;
+
+		mSkinnedActorBasis = actorBasis;
+
+		// Bones are animated directly through fields, so their transformations are compared with last skinned ones
+		float* pose = mSkinnedPose.Data();
+		int bonesCount = bones.Count();
+		for (int i = 0; i < bonesCount; i++, pose += 5)
+		{
+			const Bone& bone = bones[i];
+			if (pose[0] != bone.position.x || pose[1] != bone.position.y || pose[2] != bone.angle ||
+				pose[3] != bone.scale.x || pose[4] != bone.scale.y)
+			{
+				pose[0] = bone.position.x; pose[1] = bone.position.y; pose[2] = bone.angle;
+				pose[3] = bone.scale.x; pose[4] = bone.scale.y;
+				changed = true;
+			}
+		}
+
+		return changed;
+	}
+
+	void SkinnedMeshComponent::UpdateBonesMatrices(const Basis& actorBasis)
+	{
+		int bonesCount = bones.Count();
+		for (int i = 0; i < bonesCount; i++)
+		{
+			int parent = mBonesParents[i];
+			const Basis& parentWorld = parent < 0 ? actorBasis : mBonesWorld[parent];
+			mBonesWorld[i] = bones[i].GetLocalBasis()*parentWorld;
+
+			Basis skin = mBindPoseInverted[i]*mBonesWorld[i];
+			float* m = mSkinMatrices[i].m;
+			m[0] = skin.xv.x; m[1] = skin.xv.y; m[2] = skin.yv.x; m[3] = skin.yv.y;
+			m[4] = skin.origin.x; m[5] = skin.origin.y; m[6] = 0.0f; m[7] = 0.0f;
+		}
+	}
+
+	void SkinnedMeshComponent::SkinVertices()
+	{
+		int verticesCount = (int)mMesh.vertexCount;
+		const float* positions = mBindPositions.Data();
+		const int* vertexBones = mVertexBones.Data();
+		const float* vertexWeights = mVertexWeights.Data();
+		const SkinMatrix* matrices = mSkinMatrices.Data();
+		Vertex2* meshVertices = mMesh.vertices;
+
+		for (int i = 0; i < verticesCount; i++)
+		{
+			const int* vb = vertexBones + i*maxBoneInfluences;
+			const float* vw = vertexWeights + i*maxBoneInfluences;
+			float x = positions[i*2], y = positions[i*2 + 1];
+
+#ifdef SKINNING_SSE
+			// Blend bones matrices by weights, then transform position: x*xv + y*yv + origin
+			__m128 axes = _mm_mul_ps(_mm_loadu_ps(matrices[vb[0]].m), _mm_set1_ps(vw[0]));
+			__m128 origin = _mm_mul_ps(_mm_loadu_ps(matrices[vb[0]].m + 4), _mm_set1_ps(vw[0]));
+
+			for (int j = 1; j < maxBoneInfluences; j++)
+			{
+				if (vw[j] == 0.0f)
+					continue;
+
+				__m128 weight = _mm_set1_ps(vw[j]);
+				axes = _mm_add_ps(axes, _mm_mul_ps(_mm_loadu_ps(matrices[vb[j]].m), weight));
+				origin = _mm_add_ps(origin, _mm_mul_ps(_mm_loadu_ps(matrices[vb[j]].m + 4), weight));
+			}
+
+			__m128 projected = _mm_mul_ps(axes, _mm_setr_ps(x, x, y, y));
+			__m128 result = _mm_add_ps(_mm_add_ps(projected, _mm_movehl_ps(projected, projected)), origin);
+
+			_mm_storel_pi((__m64*)&meshVertices[i].x, result);
+#else
+			float rx = 0.0f, ry = 0.0f;
+			for (int j = 0; j < maxBoneInfluences; j++)
+			{
+				if (vw[j] == 0.0f)
+					continue;
+
+				const float* m = matrices[vb[j]].m;
+				rx += (m[0]*x + m[2]*y + m[4])*vw[j];
+				ry += (m[1]*x + m[3]*y + m[5])*vw[j];
+			}
+
+			meshVertices[i].x = rx;
+			meshVertices[i].y = ry;
+#endif
+		}
+	}
+
+	void SkinnedMeshComponent::OnDeserialized(const DataValue& node)
+	{
+		DrawableComponent::OnDeserialized(node);
+		SetSkinChanged();
+	}
+
+	Texture* SkinnedMeshComponent::GetSceneDrawableBatchTexture() const
+	{
+		return mMesh.GetTexture().Get();
+	}
+
+	bool SkinnedMeshComponent::Bone::operator==(const Bone& other) const
+	{
+		return name == other.name && parent == other.parent && position == other.position && angle == other.angle &&
+			scale == other.scale && bindPosition == other.bindPosition && bindAngle == other.bindAngle &&
+			bindScale == other.bindScale;
+	}
+
+	Basis SkinnedMeshComponent::Bone::GetLocalBasis() const
+	{
+		return Basis::Build(position, scale, angle, 0.0f);
+	}
+
+	Basis SkinnedMeshComponent::Bone::GetBindLocalBasis() const
+	{
+		return Basis::Build(bindPosition, bindScale, bindAngle, 0.0f);
+	}
+
+	bool SkinnedMeshComponent::Vertex::operator==(const Vertex& other) const
+	{
+		return position == other.position && uv == other.uv &&
+			bone0 == other.bone0 && bone1 == other.bone1 && bone2 == other.bone2 && bone3 == other.bone3 &&
+			weight0 == other.weight0 && weight1 == other.weight1 && weight2 == other.weight2 && weight3 == other.weight3;
+	}
+}
+
+DECLARE_CLASS(o2::SkinnedMeshComponent);
+
+DECLARE_CLASS(o2::SkinnedMeshComponent::Bone);
+
+DECLARE_CLASS(o2::SkinnedMeshComponent::Vertex);
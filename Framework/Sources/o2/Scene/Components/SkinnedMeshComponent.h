@@ -0,0 +1,283 @@
+#pragma once
+
+#include "o2/Assets/Types/ImageAsset.h"
+#include "o2/Render/Mesh.h"
+#include "o2/Scene/DrawableComponent.h"
+#include "o2/Utils/Editor/Attributes/InvokeOnChangeAttribute.h"
+#include "o2/Utils/Math/Basis.h"
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Skinned mesh component. Draws mesh, which vertices are deformed by bones hierarchy. Bones local
+	// transformations are animatable by animation clips through paths like "bones/0/angle". Bones
+	// world matrices are computed in one flat pass, so parent bone must be placed before children
+	// -----------------------------------------------------------------------------------------------
+	class SkinnedMeshComponent: public DrawableComponent
+	{
+	public:
+		static constexpr int maxBoneInfluences = 4; // Maximal count of bones, influencing one vertex
+
+		// -------------------------------------------------------------------
+		// Mesh bone. Local transformation is relative to parent bone or actor
+		// -------------------------------------------------------------------
+		class Bone: public ISerializable
+		{
+		public:
+			String name;                       // Bone name @SERIALIZABLE
+			int    parent = -1;                // Parent bone index, must be less than this bone index. -1 for root bones @SERIALIZABLE
+
+			Vec2F  position;                   // Local position @SERIALIZABLE
+			float  angle = 0.0f;               // Local rotation angle in radians @SERIALIZABLE
+			Vec2F  scale = Vec2F(1.0f, 1.0f);  // Local scale @SERIALIZABLE
+
+			Vec2F  bindPosition;                  // Local position in bind pose @SERIALIZABLE
+			float  bindAngle = 0.0f;              // Local rotation angle in bind pose @SERIALIZABLE
+			Vec2F  bindScale = Vec2F(1.0f, 1.0f); // Local scale in bind pose @SERIALIZABLE
+
+		public:
+			// Check equals operator
+			bool operator==(const Bone& other) const;
+
+			// Returns local transformation basis
+			Basis GetLocalBasis() const;
+
+			// Returns local transformation basis in bind pose
+			Basis GetBindLocalBasis() const;
+
+			SERIALIZABLE(Bone);
+		};
+
+		// -----------------------------------------------------------------------------------
+		// Skinned vertex. Position is in actor's local space in bind pose. Bones weights with
+		// zero weight are ignored, other weights are normalized
+		// -----------------------------------------------------------------------------------
+		class Vertex: public ISerializable
+		{
+		public:
+			Vec2F position; // Position in bind pose @SERIALIZABLE
+			Vec2F uv;       // Texture coordinates in image space, in 0...1 @SERIALIZABLE
+
+			int   bone0 = 0;      // First bone index @SERIALIZABLE
+			int   bone1 = 0;      // Second bone index @SERIALIZABLE
+			int   bone2 = 0;      // Third bone index @SERIALIZABLE
+			int   bone3 = 0;      // Fourth bone index @SERIALIZABLE
+			float weight0 = 1.0f; // First bone weight @SERIALIZABLE
+			float weight1 = 0.0f; // Second bone weight @SERIALIZABLE
+			float weight2 = 0.0f; // Third bone weight @SERIALIZABLE
+			float weight3 = 0.0f; // Fourth bone weight @SERIALIZABLE
+
+		public:
+			// Check equals operator
+			bool operator==(const Vertex& other) const;
+
+			SERIALIZABLE(Vertex);
+		};
+
+	public:
+		Vector<Bone>   bones;    // Bones hierarchy, parents are placed before children @SERIALIZABLE @INVOKE_ON_CHANGE(SetSkinChanged)
+		Vector<Vertex> vertices; // Mesh vertices @SERIALIZABLE @INVOKE_ON_CHANGE(SetSkinChanged)
+		Vector<int>    indexes;  // Triangles vertices indexes, three per triangle @SERIALIZABLE @INVOKE_ON_CHANGE(SetSkinChanged)
+		Color4         color;    // Mesh color @SERIALIZABLE @INVOKE_ON_CHANGE(SetSkinChanged)
+
+	public:
+		// Default constructor
+		SkinnedMeshComponent();
+
+		// Copy-constructor
+		SkinnedMeshComponent(const SkinnedMeshComponent& other);
+
+		// Destructor
+		~SkinnedMeshComponent();
+
+		// Assign operator
+		SkinnedMeshComponent& operator=(const SkinnedMeshComponent& other);
+
+		// Skins mesh when bones or actor are moved and draws it
+		void Draw() override;
+
+		// Rebuilds skin data when it is changed and skins mesh when bones or actor are moved. It is called on drawing
+		void UpdateSkin();
+
+		// Sets image asset, used as mesh texture
+		void SetImage(const ImageAssetRef& image);
+
+		// Returns image asset
+		const ImageAssetRef& GetImage() const;
+
+		// Marks bones hierarchy, bind pose, vertices or indexes as changed, skin data will be rebuilt before drawing
+		void SetSkinChanged();
+
+		// Sets current bones local transformations as bind pose
+		void SetCurrentPoseAsBindPose();
+
+		// Returns bone index by name, -1 when not found
+		int GetBoneIndex(const String& name) const;
+
+		// Returns bone world basis, calculated at last skinning
+		const Basis& GetBoneWorldBasis(int idx) const;
+
+		// Returns skinned mesh
+		const Mesh& GetMesh() const;
+
+		// Returns name of component
+		static String GetName();
+
+		// Returns category of component
+		static String GetCategory();
+
+		// Returns name of component icon
+		static String GetIcon();
+
+		SERIALIZABLE(SkinnedMeshComponent);
+
+	protected:
+		// -----------------------------------------------------------------------------------
+		// Bone skin matrix, packed for SIMD: xv.x, xv.y, yv.x, yv.y, origin.x, origin.y, 0, 0
+		// -----------------------------------------------------------------------------------
+		struct SkinMatrix
+		{
+			float m[8];
+		};
+
+	protected:
+		ImageAssetRef mImageAsset; // Image asset @SERIALIZABLE
+
+		Mesh mMesh; // Skinned mesh, drawing with actor's world transformation baked into vertices
+
+		bool mSkinChanged = true; // True when skin data must be rebuilt
+
+		Vector<int>        mBonesParents;     // Bones parents indexes, checked that parent is placed before child
+		Vector<Basis>      mBindPoseInverted; // Inverted bones world bases in bind pose
+		Vector<Basis>      mBonesWorld;       // Bones world bases, including actor's transformation
+		Vector<SkinMatrix> mSkinMatrices;     // Bones skin matrices, transforms from bind pose to world space
+
+		Vector<float> mSkinnedPose;       // Bones local transformations at last skinning: position, angle and scale, five floats per bone
+		Basis         mSkinnedActorBasis; // Actor's world basis at last skinning
+
+		Vector<float> mBindPositions;  // Vertices bind positions, two floats per vertex
+		Vector<int>   mVertexBones;    // Vertices bones indexes, maxBoneInfluences per vertex
+		Vector<float> mVertexWeights;  // Vertices normalized bones weights, maxBoneInfluences per vertex
+
+	protected:
+		// Rebuilds mesh buffers, bind pose and packed vertices influences
+		void UpdateSkinData();
+
+		// Updates mesh texture and texture coordinates by image
+		void UpdateTextureCoords();
+
+		// Checks are bones local transformations or actor's basis changed since last skinning and stores them
+		bool CheckPoseChanged(const Basis& actorBasis);
+
+		// Calculates bones world bases and skin matrices in one pass from roots to leaves
+		void UpdateBonesMatrices(const Basis& actorBasis);
+
+		// Transforms bind positions by blended bones skin matrices into mesh vertices
+		void SkinVertices();
+
+		// It is called when object was deserialized
+		void OnDeserialized(const DataValue& node) override;
+
+		// Returns mesh texture, skinned meshes with same depth are grouped by it when drawing
+		Texture* GetSceneDrawableBatchTexture() const override;
+	};
+}
+
+CLASS_BASES_META(o2::SkinnedMeshComponent)
+{
+	BASE_CLASS(o2::DrawableComponent);
+}
+END_META;
+CLASS_FIELDS_META(o2::SkinnedMeshComponent)
+{
+	PUBLIC_FIELD(bones).INVOKE_ON_CHANGE_ATTRIBUTE(SetSkinChanged).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(vertices).INVOKE_ON_CHANGE_ATTRIBUTE(SetSkinChanged).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(indexes).INVOKE_ON_CHANGE_ATTRIBUTE(SetSkinChanged).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(color).INVOKE_ON_CHANGE_ATTRIBUTE(SetSkinChanged).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mImageAsset).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mMesh);
+	PROTECTED_FIELD(mSkinChanged).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mBonesParents);
+	PROTECTED_FIELD(mBindPoseInverted);
+	PROTECTED_FIELD(mBonesWorld);
+	PROTECTED_FIELD(mSkinMatrices);
+	PROTECTED_FIELD(mSkinnedPose);
+	PROTECTED_FIELD(mSkinnedActorBasis);
+	PROTECTED_FIELD(mBindPositions);
+	PROTECTED_FIELD(mVertexBones);
+	PROTECTED_FIELD(mVertexWeights);
+}
+END_META;
+CLASS_METHODS_META(o2::SkinnedMeshComponent)
+{
+
+	PUBLIC_FUNCTION(void, Draw);
+	PUBLIC_FUNCTION(void, UpdateSkin);
+	PUBLIC_FUNCTION(void, SetImage, const ImageAssetRef&);
+	PUBLIC_FUNCTION(const ImageAssetRef&, GetImage);
+	PUBLIC_FUNCTION(void, SetSkinChanged);
+	PUBLIC_FUNCTION(void, SetCurrentPoseAsBindPose);
+	PUBLIC_FUNCTION(int, GetBoneIndex, const String&);
+	PUBLIC_FUNCTION(const Basis&, GetBoneWorldBasis, int);
+	PUBLIC_FUNCTION(const Mesh&, GetMesh);
+	PUBLIC_STATIC_FUNCTION(String, GetName);
+	PUBLIC_STATIC_FUNCTION(String, GetCategory);
+	PUBLIC_STATIC_FUNCTION(String, GetIcon);
+	PROTECTED_FUNCTION(void, UpdateSkinData);
+	PROTECTED_FUNCTION(void, UpdateTextureCoords);
+	PROTECTED_FUNCTION(bool, CheckPoseChanged, const Basis&);
+	PROTECTED_FUNCTION(void, UpdateBonesMatrices, const Basis&);
+	PROTECTED_FUNCTION(void, SkinVertices);
+	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
+	PROTECTED_FUNCTION(Texture*, GetSceneDrawableBatchTexture);
+}
+END_META;
+
+CLASS_BASES_META(o2::SkinnedMeshComponent::Bone)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::SkinnedMeshComponent::Bone)
+{
+	PUBLIC_FIELD(name).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(parent).DEFAULT_VALUE(-1).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(position).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(angle).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(scale).DEFAULT_VALUE(Vec2F(1.0f, 1.0f)).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bindPosition).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bindAngle).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bindScale).DEFAULT_VALUE(Vec2F(1.0f, 1.0f)).SERIALIZABLE_ATTRIBUTE();
+}
+END_META;
+CLASS_METHODS_META(o2::SkinnedMeshComponent::Bone)
+{
+
+	PUBLIC_FUNCTION(Basis, GetLocalBasis);
+	PUBLIC_FUNCTION(Basis, GetBindLocalBasis);
+}
+END_META;
+
+CLASS_BASES_META(o2::SkinnedMeshComponent::Vertex)
+{
+	BASE_CLASS(o2::ISerializable);
+}
+END_META;
+CLASS_FIELDS_META(o2::SkinnedMeshComponent::Vertex)
+{
+	PUBLIC_FIELD(position).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(uv).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bone0).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bone1).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bone2).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(bone3).DEFAULT_VALUE(0).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(weight0).DEFAULT_VALUE(1.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(weight1).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(weight2).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+	PUBLIC_FIELD(weight3).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
+}
+END_META;
+CLASS_METHODS_META(o2::SkinnedMeshComponent::Vertex)
+{
+}
+END_META;
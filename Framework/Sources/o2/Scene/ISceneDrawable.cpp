@@ -41,6 +41,11 @@ namespace o2
 		return mDrawingDepth;
 	}
 
+	Texture* ISceneDrawable::GetSceneDrawableBatchTexture() const
+	{
+		return nullptr;
+	}
+
 	void ISceneDrawable::OnEnabled()
 	{
 		if (auto layer = GetSceneDrawableSceneLayer())
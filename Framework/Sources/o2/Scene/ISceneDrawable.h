@@ -11,6 +11,7 @@
 namespace o2
 {
 	class SceneLayer;
+	class Texture;
 
 	// ------------------------------------------------------------------
 	// Scene drawable object. Has virtual draw function and sorting depth
@@ -59,6 +60,9 @@ namespace o2
 		// Returns is drawable enabled
 		virtual bool IsSceneDrawableEnabled() const = 0;
 
+		// Returns texture for grouping drawables with same depth to reduce draw calls. Null when drawable can't be regrouped
+		virtual Texture* GetSceneDrawableBatchTexture() const;
+
 		// Is is called when drawable has enabled
 		void OnEnabled();
 
@@ -106,6 +110,7 @@ CLASS_METHODS_META(o2::ISceneDrawable)
 	PUBLIC_FUNCTION(void, SetLastOnCurrentDepth);
 	PROTECTED_FUNCTION(SceneLayer*, GetSceneDrawableSceneLayer);
 	PROTECTED_FUNCTION(bool, IsSceneDrawableEnabled);
+	PROTECTED_FUNCTION(Texture*, GetSceneDrawableBatchTexture);
 	PROTECTED_FUNCTION(void, OnEnabled);
 	PROTECTED_FUNCTION(void, OnDisabled);
 	PROTECTED_FUNCTION(void, OnAddToScene);
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "o2/Utils/Math/Vector2.h"
+
+namespace o2
+{
+	class ICollider;
+
+	// -------------------------------------------------------------------------------------------------
+	// Collision info, passed to collision and trigger callbacks of actors and components. Point, normal
+	// and velocity are in world coordinates, they are zero on exit and for triggers. Other collider is
+	// null when it was destroyed before callback
+	// -------------------------------------------------------------------------------------------------
+	struct Collision
+	{
+		ICollider* collider = nullptr;      // Collider of actor, which receives callback
+		ICollider* otherCollider = nullptr; // Collided collider
+		Vec2F      point;                   // Contact point
+		Vec2F      normal;                  // Contact normal, directed from collider to other collider
+		Vec2F      relativeVelocity;        // Velocity of other collider relative to collider at contact point
+	};
+}
@@ -13,12 +13,15 @@ namespace o2
 
 	ICollider::ICollider(const ICollider& other):
 		Component(other), mFriction(other.mFriction), mDensity(other.mDensity), mRestitution(other.mRestitution), 
-		mLayer(other.mLayer), mIsSensor(other.mIsSensor)
+		mLayer(other.mLayer), mLayerMask(other.mLayerMask), mIsSensor(other.mIsSensor)
 	{}
 
 	ICollider::~ICollider()
 	{
 		RemoveFromRigidBody();
+
+		if (mLastContactEvent >= 0 && PhysicsWorld::IsSingletonInitialzed())
+			o2Physics.OnColliderDestroyed(this);
 	}
 
 	ICollider& ICollider::operator=(const ICollider& other)
@@ -29,6 +32,7 @@ namespace o2
 		mDensity = other.mDensity;
 		mRestitution = other.mRestitution;
 		mLayer = other.mLayer;
+		mLayerMask = other.mLayerMask;
 		mIsSensor = other.mIsSensor;
 
 		OnShapeChanged();
@@ -78,6 +82,7 @@ namespace o2
 	void ICollider::SetLayer(const String& layer)
 	{
 		mLayer = layer;
+		mLayerMask = o2Physics.GetLayerMask(mLayer);
 	}
 
 	const String& ICollider::GetLayer() const
@@ -85,12 +90,26 @@ namespace o2
 		return mLayer;
 	}
 
+	UInt ICollider::GetLayerMask() const
+	{
+		return mLayerMask;
+	}
+
+	RigidBody* ICollider::GetRigidBody() const
+	{
+		return mRigidBodyComp;
+	}
+
 	void ICollider::SetIsSensor(bool value)
 	{
+		if (mIsSensor == value)
+			return;
+
 		mIsSensor = value;
 
+		// Fixture is recreated, so touching contacts end as they were and begin again with new type
 		if (mFixture)
-			mFixture->SetSensor(mIsSensor);
+			OnShapeChanged();
 	}
 
 	bool ICollider::IsSensor() const
@@ -130,6 +149,9 @@ namespace o2
 			return;
 		}
 
+		// Layer name can be deserialized directly, refresh mask here
+		mLayerMask = o2Physics.GetLayerMask(mLayer);
+
 		mFixture = body->mBody->CreateFixture(&fixture);
 		mRigidBodyComp = body;
 	}
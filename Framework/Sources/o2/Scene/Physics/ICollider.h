@@ -57,7 +57,13 @@ namespace o2
 		// Returns layer name
 		const String& GetLayer() const;
 
-		// Sets is sensor
+		// Returns layer bit mask, used in physics queries filtering
+		UInt GetLayerMask() const;
+
+		// Returns rigid body, which collider is attached to
+		RigidBody* GetRigidBody() const;
+
+		// Sets is sensor. Sensor doesn't collide, it calls OnTriggerEnter/Exit instead of OnCollisionEnter/Exit
 		void SetIsSensor(bool value);
 
 		// Returns is collider sensor
@@ -74,12 +80,15 @@ namespace o2
 		float mRestitution = 0.0f; // Restitution @SERIALIZABLE
 
 		String mLayer = "Default"; // Layer name @SERIALIZABLE
+		UInt   mLayerMask = 1;     // Layer bit mask, cached from layer name
 
 		bool mIsSensor = false; // Is collider sensor @SERIALIZABLE
 
 		b2Fixture* mFixture = nullptr;
 		RigidBody* mRigidBodyComp = nullptr;
 
+		int mLastContactEvent = -1; // Index of last not dispatched contact event with this collider in physics world
+
 	protected:
 		// Adds fixture with shape to body
 		void AddToRigidBody(RigidBody* body);
@@ -126,9 +135,11 @@ CLASS_FIELDS_META(o2::ICollider)
 	PROTECTED_FIELD(mDensity).DEFAULT_VALUE(1.0f).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mRestitution).DEFAULT_VALUE(0.0f).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mLayer).DEFAULT_VALUE("Default").SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mLayerMask).DEFAULT_VALUE(1);
 	PROTECTED_FIELD(mIsSensor).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mFixture).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mRigidBodyComp).DEFAULT_VALUE(nullptr);
+	PROTECTED_FIELD(mLastContactEvent).DEFAULT_VALUE(-1);
 }
 END_META;
 CLASS_METHODS_META(o2::ICollider)
@@ -142,6 +153,8 @@ CLASS_METHODS_META(o2::ICollider)
 	PUBLIC_FUNCTION(float, GetRestitution);
 	PUBLIC_FUNCTION(void, SetLayer, const String&);
 	PUBLIC_FUNCTION(const String&, GetLayer);
+	PUBLIC_FUNCTION(UInt, GetLayerMask);
+	PUBLIC_FUNCTION(RigidBody*, GetRigidBody);
 	PUBLIC_FUNCTION(void, SetIsSensor, bool);
 	PUBLIC_FUNCTION(bool, IsSensor);
 	PUBLIC_STATIC_FUNCTION(bool, IsAvailableFromCreateMenu);
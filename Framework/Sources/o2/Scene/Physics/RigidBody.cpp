@@ -2,6 +2,7 @@
 #include "RigidBody.h"
 
 #include "Box2D/Dynamics/b2Body.h"
+#include "o2/Config/ProjectConfig.h"
 #include "o2/Physics/PhysicsWorld.h"
 #include "o2/Scene/Physics/ICollider.h"
 
@@ -13,7 +14,7 @@ namespace o2
 	RigidBody::RigidBody(const RigidBody& other):
 		Actor(other), mBodyType(other.mBodyType), mMass(other.mMass), mInertia(other.mInertia),
 		mLinearDamping(other.mLinearDamping), mAngularDamping(other.mAngularDamping), mGravityScale(other.mGravityScale),
-		mIsBullet(other.mIsBullet), mIsFixedRotation(other.mIsFixedRotation)
+		mIsBullet(other.mIsBullet), mIsFixedRotation(other.mIsFixedRotation), mIsInterpolated(other.mIsInterpolated)
 	{}
 
 	RigidBody::~RigidBody()
@@ -35,6 +36,7 @@ namespace o2
 		mGravityScale = other.mGravityScale;
 		mIsBullet = other.mIsBullet;
 		mIsFixedRotation = other.mIsFixedRotation;
+		mIsInterpolated = other.mIsInterpolated;
 
 		if (IsOnScene())
 			CreateBody();
@@ -197,6 +199,17 @@ namespace o2
 		return mIsFixedRotation;
 	}
 
+	void RigidBody::SetIsInterpolated(bool interpolated)
+	{
+		mIsInterpolated = interpolated;
+		ResetSyncedTransform(mSyncedPosition, mSyncedAngle);
+	}
+
+	bool RigidBody::IsInterpolated() const
+	{
+		return mIsInterpolated;
+	}
+
 	void RigidBody::OnEnableInHierarchyChanged()
 	{
 		Actor::OnEnableInHierarchyChanged();
@@ -217,10 +230,62 @@ namespace o2
 		Actor::OnRemoveFromScene();
 	}
 
+	void RigidBody::OnTransformChanged()
+	{
+		Actor::OnTransformChanged();
+		MarkTransformDirty();
+	}
+
+	void RigidBody::OnTransformUpdated()
+	{
+		Actor::OnTransformUpdated();
+		MarkTransformDirty();
+	}
+
+	void RigidBody::MarkTransformDirty()
+	{
+		if (!mBody || mTransformDirty || o2Physics.IsUpdatingPhysicsNow())
+			return;
+
+		// Transform updating after physics synchronization or interpolation isn't a change from outside
+		Vec2F position = transform->GetWorldPosition();
+		if (Math::Equals(position.x, mSyncedPosition.x, 0.001f) && Math::Equals(position.y, mSyncedPosition.y, 0.001f) &&
+			Math::AnglesEquals(transform->GetWorldAngle(), mSyncedAngle))
+		{
+			return;
+		}
+
+		mTransformDirty = true;
+		o2Physics.mDirtyBodies.Add(this);
+	}
+
+	void RigidBody::SetSyncedTransform(const Vec2F& position, float angle)
+	{
+		mSyncedPosition = position;
+		mSyncedAngle = angle;
+
+		transform->SetWorldPosition(position);
+		transform->SetWorldAngle(angle);
+	}
+
+	void RigidBody::ResetSyncedTransform(const Vec2F& position, float angle)
+	{
+		mSyncedPosition = position;
+		mSyncedAngle = angle;
+		mPrevStepPosition = position;
+		mPrevStepAngle = angle;
+		mStepPosition = position;
+		mStepAngle = angle;
+	}
+
 	void RigidBody::CreateBody()
 	{
+		Vec2F position = transform->GetWorldPosition();
+		float angle = transform->GetWorldAngle();
+
 		b2BodyDef def;
-		def.position = transform->GetWorldPosition();
+		def.position = position/o2Config.physics.scale;
+		def.angle = angle;
 		def.userData = this;
 		def.active = mResEnabledInHierarchy;
 
@@ -235,10 +300,18 @@ namespace o2
 		mBody->SetGravityScale(mGravityScale);
 		mBody->SetBullet(mIsBullet);
 		mBody->SetFixedRotation(mIsFixedRotation);
+
+		ResetSyncedTransform(position, angle);
 	}
 
 	void RigidBody::RemoveBody()
 	{
+		if (mTransformDirty)
+		{
+			PhysicsWorld::Instance().mDirtyBodies.Remove(this);
+			mTransformDirty = false;
+		}
+
 		PhysicsWorld::Instance().mWorld.DestroyBody(mBody);
 		mBody = nullptr;
 	}
@@ -28,6 +28,7 @@ namespace o2
 		PROPERTY(bool, isBullet, SetIsBullet, IsBullet);                          // Is body using continuous collision detection property
 		PROPERTY(bool, isSleeping, SetIsSleeping, IsSleeping);                    // Is body sleeping property
 		PROPERTY(bool, isFixedRotation, SetIsFixedRotation, IsFixedRotation);     // Is fixed rotation property
+		PROPERTY(bool, isInterpolated, SetIsInterpolated, IsInterpolated);        // Is transform interpolated between fixed steps property
 
 	public:
 		// Default constructor
@@ -108,6 +109,13 @@ namespace o2
 		// Returns is body fixed rotation
 		bool IsFixedRotation() const;
 
+		// Sets is actor transform interpolated between last two fixed physics steps, it makes moving smooth when
+		// frame rate differs from fixed rate. Actor is drawn behind body for up to one fixed step
+		void SetIsInterpolated(bool interpolated);
+
+		// Returns is actor transform interpolated between fixed physics steps
+		bool IsInterpolated() const;
+
 		SERIALIZABLE(RigidBody);
 
 	protected:
@@ -123,9 +131,19 @@ namespace o2
 		float mGravityScale = 1.0f;     // Gravity scale @SERIALIZABLE
 		bool  mIsBullet = false;        // Is using continuous collision detection @SERIALIZABLE
 		bool  mIsFixedRotation = false; // Is fixed rotation @SERIALIZABLE
+		bool  mIsInterpolated = false;  // Is transform interpolated between fixed steps @SERIALIZABLE
 
 		Vector<ICollider*> mColliders; // Attached colliders list
 
+		bool  mTransformDirty = false; // Is actor transform changed since last synchronization, it is registered in world's dirty bodies
+		Vec2F mSyncedPosition;         // World position, last synchronized between actor and body
+		float mSyncedAngle = 0.0f;     // World angle, last synchronized between actor and body
+
+		Vec2F mPrevStepPosition;     // Body world position before last fixed step, used in interpolation
+		float mPrevStepAngle = 0.0f; // Body world angle before last fixed step, used in interpolation
+		Vec2F mStepPosition;         // Body world position after last fixed step, used in interpolation
+		float mStepAngle = 0.0f;     // Body world angle after last fixed step, used in interpolation
+
 	protected:
 		// It is called when result enable was changed
 		void OnEnableInHierarchyChanged() override;
@@ -136,6 +154,22 @@ namespace o2
 		// It is called when actor has removed from scene; destroys rigid body
 		void OnRemoveFromScene() override;
 
+		// It is called when transformation was changed, marks transform dirty for synchronization with body
+		void OnTransformChanged() override;
+
+		// It is called when transformation was updated, marks transform dirty for synchronization with body.
+		// Catches parents transformations changes
+		void OnTransformUpdated() override;
+
+		// Registers body in world's dirty bodies, when actor's world transform differs from last synchronized
+		void MarkTransformDirty();
+
+		// Sets actor world transform from physics and remembers it as synchronized
+		void SetSyncedTransform(const Vec2F& position, float angle);
+
+		// Resets synchronized and interpolation transforms to position and angle
+		void ResetSyncedTransform(const Vec2F& position, float angle);
+
 		// Creates box2d body, registers in physics world
 		void CreateBody();
 
@@ -176,6 +210,7 @@ CLASS_FIELDS_META(o2::RigidBody)
 	PUBLIC_FIELD(isBullet);
 	PUBLIC_FIELD(isSleeping);
 	PUBLIC_FIELD(isFixedRotation);
+	PUBLIC_FIELD(isInterpolated);
 	PROTECTED_FIELD(mBody).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(mMassData);
 	PROTECTED_FIELD(mBodyType).DEFAULT_VALUE(Type::Dynamic).SERIALIZABLE_ATTRIBUTE();
@@ -186,7 +221,15 @@ CLASS_FIELDS_META(o2::RigidBody)
 	PROTECTED_FIELD(mGravityScale).DEFAULT_VALUE(1.0f).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mIsBullet).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mIsFixedRotation).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mIsInterpolated).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
 	PROTECTED_FIELD(mColliders);
+	PROTECTED_FIELD(mTransformDirty).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mSyncedPosition);
+	PROTECTED_FIELD(mSyncedAngle).DEFAULT_VALUE(0.0f);
+	PROTECTED_FIELD(mPrevStepPosition);
+	PROTECTED_FIELD(mPrevStepAngle).DEFAULT_VALUE(0.0f);
+	PROTECTED_FIELD(mStepPosition);
+	PROTECTED_FIELD(mStepAngle).DEFAULT_VALUE(0.0f);
 }
 END_META;
 CLASS_METHODS_META(o2::RigidBody)
@@ -214,9 +257,16 @@ CLASS_METHODS_META(o2::RigidBody)
 	PUBLIC_FUNCTION(bool, IsSleeping);
 	PUBLIC_FUNCTION(void, SetIsFixedRotation, bool);
 	PUBLIC_FUNCTION(bool, IsFixedRotation);
+	PUBLIC_FUNCTION(void, SetIsInterpolated, bool);
+	PUBLIC_FUNCTION(bool, IsInterpolated);
 	PROTECTED_FUNCTION(void, OnEnableInHierarchyChanged);
 	PROTECTED_FUNCTION(void, OnAddToScene);
 	PROTECTED_FUNCTION(void, OnRemoveFromScene);
+	PROTECTED_FUNCTION(void, OnTransformChanged);
+	PROTECTED_FUNCTION(void, OnTransformUpdated);
+	PROTECTED_FUNCTION(void, MarkTransformDirty);
+	PROTECTED_FUNCTION(void, SetSyncedTransform, const Vec2F&, float);
+	PROTECTED_FUNCTION(void, ResetSyncedTransform, const Vec2F&, float);
 	PROTECTED_FUNCTION(void, CreateBody);
 	PROTECTED_FUNCTION(void, RemoveBody);
 	PROTECTED_FUNCTION(void, AddCollider, ICollider*);
@@ -1,8 +1,10 @@
 #include "o2/stdafx.h"
 #include "Scene.h"
 
+#include "o2/Animation/AnimationLODSystem.h"
 #include "o2/Application/Input.h"
 #include "o2/Assets/Types/ActorAsset.h"
+#include "o2/Render/ParticlesSystem.h"
 #include "o2/Render/Render.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ActorDataValueConverter.h"
@@ -13,6 +15,7 @@
 #include "o2/Scene/Tags.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/Debug/Profiler.h"
 #include "o2/Render/VectorFontEffects.h"
 
 namespace o2
@@ -36,14 +39,23 @@ namespace o2
 
 	void Scene::Update(float dt)
 	{
+		PROFILE_SCOPE("Scene::Update");
+
 		UpdateAddedEntities();
 		UpdateStartingEntities();
 		UpdateDestroyingEntities();
+
+		o2AnimationLOD.BeginFrame(mCameras);
 		UpdateActors(dt);
+		o2AnimationLOD.UpdateScheduled();
+
+		o2Particles.UpdateScheduled();
 	}
 
 	void Scene::FixedUpdate(float dt)
 	{
+		PROFILE_SCOPE("Scene::FixedUpdate");
+
 		for (auto actor : mRootActors)
 			actor->FixedUpdate(dt);
 
@@ -115,6 +127,8 @@ namespace o2
 #undef DrawText
 	void Scene::Draw()
 	{
+		PROFILE_SCOPE("Scene::Draw");
+
 		if constexpr (IS_EDITOR)
 			BeginDrawingScene();
 
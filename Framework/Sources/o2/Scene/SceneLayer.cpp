@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "SceneLayer.h"
 
+#include "o2/Render/Render.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Scene/Scene.h"
@@ -43,6 +44,47 @@ namespace o2
 		return mEnabledDrawables;
 	}
 
+	void SceneLayer::Draw()
+	{
+		String prevStatsLayer = o2Render.GetStatsLayer();
+		o2Render.SetStatsLayer(mName);
+
+		int count = mEnabledDrawables.Count();
+		for (int i = 0; i < count; )
+		{
+			ISceneDrawable* drawable = mEnabledDrawables[i];
+			Texture* texture = drawable->GetSceneDrawableBatchTexture();
+
+			if (!texture)
+			{
+				drawable->Draw();
+				i++;
+				continue;
+			}
+
+			// Collect following drawables with same depth, their order can be changed
+			float depth = drawable->mDrawingDepth;
+			mBatchingDrawables.Add(Pair<Texture*, ISceneDrawable*>(texture, drawable));
+
+			for (i++; i < count; i++)
+			{
+				ISceneDrawable* nextDrawable = mEnabledDrawables[i];
+				if (nextDrawable->mDrawingDepth != depth)
+					break;
+
+				Texture* nextTexture = nextDrawable->GetSceneDrawableBatchTexture();
+				if (!nextTexture)
+					break;
+
+				mBatchingDrawables.Add(Pair<Texture*, ISceneDrawable*>(nextTexture, nextDrawable));
+			}
+
+			DrawBatchingDrawables();
+		}
+
+		o2Render.SetStatsLayer(prevStatsLayer);
+	}
+
 	void SceneLayer::RegisterActor(Actor* actor)
 	{
 		mActors.Add(actor);
@@ -136,6 +178,29 @@ namespace o2
 		mEnabledDrawables.Add(drawable);
 	}
 
+	void SceneLayer::DrawBatchingDrawables()
+	{
+		// Keep order of textures by their first drawable, and order of drawables with same texture
+		int count = mBatchingDrawables.Count();
+		for (int i = 0; i < count; i++)
+		{
+			Texture* texture = mBatchingDrawables[i].first;
+			if (!texture)
+				continue;
+
+			for (int j = i; j < count; j++)
+			{
+				if (mBatchingDrawables[j].first == texture)
+				{
+					mBatchingDrawables[j].second->Draw();
+					mBatchingDrawables[j].first = nullptr;
+				}
+			}
+		}
+
+		mBatchingDrawables.Clear();
+	}
+
 
 // 	void LayerDataValueConverter::ToData(void* object, DataValue& data)
 // 	{
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "o2/Utils/Types/Containers/Pair.h"
 #include "o2/Utils/Types/String.h"
 #include "o2/Utils/Serialization/Serializable.h"
 
@@ -7,6 +8,7 @@ namespace o2
 {
 	class Actor;
 	class ISceneDrawable;
+	class Texture;
 
 	// --------------------------------------------------------------------------------
 	// Scene layer. It contains Actors and their Drawable parts, managing sorting order
@@ -36,6 +38,9 @@ namespace o2
 		// Returns enabled drawable objects of actors in layer
 		const Vector<ISceneDrawable*>& GetEnabledDrawables() const;
 
+		// Draws enabled drawable objects. Drawables with same depth and batch texture are drawn together
+		void Draw();
+
 		SERIALIZABLE(SceneLayer);
 
 	protected:
@@ -47,6 +52,8 @@ namespace o2
 		Vector<ISceneDrawable*> mDrawables;        // Drawable objects in layer
 		Vector<ISceneDrawable*> mEnabledDrawables; // Enabled drawable objects in layer
 
+		Vector<Pair<Texture*, ISceneDrawable*>> mBatchingDrawables; // Drawables with same depth, grouping by texture when drawing
+
 	protected:
 		// Registers actor in list
 		void RegisterActor(Actor* actor);
@@ -78,6 +85,9 @@ namespace o2
 		// Sets drawable order as last of all objects with same depth
 		void SetLastByDepth(ISceneDrawable* drawable);
 
+		// Draws drawables from mBatchingDrawables grouped by texture
+		void DrawBatchingDrawables();
+
 		friend class Actor;
 		friend class CameraActor;
 		friend class DrawableComponent;
@@ -116,6 +126,7 @@ CLASS_FIELDS_META(o2::SceneLayer)
 	PROTECTED_FIELD(mEnabledActors);
 	PROTECTED_FIELD(mDrawables);
 	PROTECTED_FIELD(mEnabledDrawables);
+	PROTECTED_FIELD(mBatchingDrawables);
 }
 END_META;
 CLASS_METHODS_META(o2::SceneLayer)
@@ -127,6 +138,7 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PUBLIC_FUNCTION(const Vector<Actor*>&, GetEnabledActors);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetDrawables);
 	PUBLIC_FUNCTION(const Vector<ISceneDrawable*>&, GetEnabledDrawables);
+	PUBLIC_FUNCTION(void, Draw);
 	PROTECTED_FUNCTION(void, RegisterActor, Actor*);
 	PROTECTED_FUNCTION(void, UnregisterActor, Actor*);
 	PROTECTED_FUNCTION(void, OnActorEnabled, Actor*);
@@ -137,5 +149,6 @@ CLASS_METHODS_META(o2::SceneLayer)
 	PROTECTED_FUNCTION(void, OnDrawableEnabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, OnDrawableDisabled, ISceneDrawable*);
 	PROTECTED_FUNCTION(void, SetLastByDepth, ISceneDrawable*);
+	PROTECTED_FUNCTION(void, DrawBatchingDrawables);
 }
 END_META;
@@ -27,6 +27,7 @@
 #include "o2/Scene/UI/Widgets/Window.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Debug/Log/LogStream.h"
+#include "o2/Utils/System/Time/Time.h"
 #include "o2/Utils/System/Time/Timer.h"
 
 #undef CreateWindow
@@ -351,6 +352,33 @@ namespace o2
 		return mStyleSamples;
 	}
 
+	UIManager::FrameStatistics& UIManager::GetCurrentFrameStatistics()
+	{
+		int currentFrame = o2Time.GetCurrentFrame();
+		if (mStatisticsFrame != currentFrame)
+		{
+			mLastFrameStatistics = mStatisticsFrame == currentFrame - 1 ? mStatistics : FrameStatistics();
+			mStatistics = FrameStatistics();
+			mStatisticsFrame = currentFrame;
+		}
+
+		return mStatistics;
+	}
+
+	const UIManager::FrameStatistics& UIManager::GetLastFrameStatistics() const
+	{
+		static const FrameStatistics emptyStatistics;
+
+		int currentFrame = o2Time.GetCurrentFrame();
+		if (mStatisticsFrame == currentFrame)
+			return mLastFrameStatistics;
+
+		if (mStatisticsFrame == currentFrame - 1)
+			return mStatistics;
+
+		return emptyStatistics;
+	}
+
 	void UIManager::TryLoadStyle()
 	{
 		if (o2Assets.IsAssetExist("ui_style.json"))
@@ -37,6 +37,22 @@ namespace o2
 	// ------------------------------------------------
 	class UIManager : public Singleton<UIManager>
 	{
+	public:
+		// -------------------------------------------------------------------------
+		// Widgets statistics for one frame. Shows layout and drawing overhead of UI
+		// -------------------------------------------------------------------------
+		struct FrameStatistics
+		{
+			int updatedLayouts = 0;  // Count of calculated widgets layouts
+			int skippedLayouts = 0;  // Count of dirty widgets layouts, skipped because their inputs wasn't changed
+			int arrangedLayouts = 0; // Count of children arranging passes in layout widgets
+
+			int renderCacheHits = 0;           // Count of widgets drawn from render cache texture
+			int renderCacheRedraws = 0;        // Count of widgets render cache textures redraws
+			int renderCacheDirectDraws = 0;    // Count of widgets with render cache drawn directly, because their content is changing
+			int renderCacheSavedDrawCalls = 0; // Estimated count of draw calls saved by drawing from render cache
+		};
+
 	public:
 		// Loads widgets style
 		void LoadStyle(const String& path);
@@ -144,6 +160,12 @@ namespace o2
 		// Returns all styles widgets
 		const Vector<Widget*>& GetWidgetStyles() const;
 
+		// Returns widgets statistics of current frame, used by widgets for counting
+		FrameStatistics& GetCurrentFrameStatistics();
+
+		// Returns widgets statistics of previous frame
+		const FrameStatistics& GetLastFrameStatistics() const;
+
 	protected:
 		LogStream * mLog = nullptr;          // UI Log stream
 
@@ -153,6 +175,10 @@ namespace o2
 
 		Vector<Widget*> mStyleSamples; // Style widgets
 
+		FrameStatistics mStatistics;          // Current frame widgets statistics
+		FrameStatistics mLastFrameStatistics; // Previous frame widgets statistics
+		int             mStatisticsFrame = 0; // Frame index of current widgets statistics
+
 	protected:
 		// Default constructor
 		UIManager();
@@ -2,13 +2,17 @@
 #include "Widget.h"
 
 #include "o2/Application/Input.h"
+#include "o2/Events/EventSystem.h"
 #include "o2/Render/Render.h"
+#include "o2/Render/Sprite.h"
 #include "o2/Scene/Scene.h"
 #include "o2/Scene/SceneLayer.h"
 #include "o2/Scene/UI/UIManager.h"
 #include "o2/Scene/UI/WidgetLayer.h"
 #include "o2/Scene/UI/WidgetLayout.h"
 #include "o2/Scene/UI/WidgetState.h"
+#include "o2/Utils/Debug/Debug.h"
+#include "o2/Utils/Editor/DragAndDrop.h"
 
 namespace o2
 {
@@ -41,8 +45,9 @@ namespace o2
 
 	Widget::Widget(const Widget& other):
 		Actor(mnew WidgetLayout(*other.layout), other), layout(dynamic_cast<WidgetLayout*>(transform)),
-		mTransparency(other.mTransparency), transparency(this), resTransparency(this),
-		childrenWidgets(this), layers(this), states(this), childWidget(this), layer(this), state(this)
+		mTransparency(other.mTransparency), mRenderCacheEnabled(other.mRenderCacheEnabled), transparency(this),
+		resTransparency(this), renderCacheEnabled(this), childrenWidgets(this), layers(this), states(this),
+		childWidget(this), layer(this), state(this)
 	{
 		layout->SetOwner(this);
 
@@ -117,6 +122,9 @@ namespace o2
 		if (UIManager::IsSingletonInitialzed())
 			o2UI.mFocusableWidgets.Remove(this);
 
+		if (mRenderCacheSprite)
+			delete mRenderCacheSprite;
+
 		if (IsOnScene())
 			ISceneDrawable::OnRemoveFromScene();
 	}
@@ -133,13 +141,18 @@ namespace o2
 		{
 			if (GetLayoutData().updateFrame == 0)
 			{
-				for (auto child : mChildren)
-					child->transform->SetDirty(true);
+				UpdateSelfTransform();
 
-				for (auto child : mInternalWidgets)
-					child->transform->SetDirty(true);
+				// Children are updated only when this layout was really recalculated. Each child checks its own
+				// inputs, so not changed subtrees are skipped
+				if (!GetLayoutData().updateSkipped)
+				{
+					for (auto child : mChildren)
+						child->transform->SetDirty(true);
 
-				UpdateSelfTransform();
+					for (auto child : mInternalWidgets)
+						child->transform->SetDirty(true);
+				}
 			}
 
 			if (!mIsClipped)
@@ -150,7 +163,12 @@ namespace o2
 				for (auto state : mStates)
 				{
 					if (state)
+					{
 						state->Update(dt);
+
+						if (state->player.IsPlaying())
+							InvalidateRenderCache();
+					}
 				}
 			}
 
@@ -227,6 +245,9 @@ namespace o2
 			return;
 		}
 
+		if (DrawFromRenderCache())
+			return;
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
@@ -244,6 +265,144 @@ namespace o2
 		DrawDebugFrame();
 	}
 
+	bool Widget::DrawFromRenderCache()
+	{
+		if (!mRenderCacheEnabled || mRenderCacheDrawing)
+			return false;
+
+		auto& statistics = o2UI.GetCurrentFrameStatistics();
+
+		// Content that was changed recently is probably animating, redrawing texture each frame costs more than
+		// direct drawing
+		int currentFrame = o2Time.GetCurrentFrame();
+		if (mRenderCacheInvalidatedFrame >= currentFrame - 1 || !o2Render.IsRenderTextureAvailable() ||
+			o2Render.GetRenderTexture())
+		{
+			statistics.renderCacheDirectDraws++;
+			return false;
+		}
+
+		RectF visibleRect = mBoundsWithChilds.GetIntersection((RectF)o2Render.GetResScissorRect());
+		RectF rect(Math::Floor(visibleRect.left), Math::Ceil(visibleRect.top),
+				   Math::Ceil(visibleRect.right), Math::Floor(visibleRect.bottom));
+
+		Vec2I size((int)rect.Width(), (int)rect.Height());
+		Vec2I maxSize = o2Render.GetMaxTextureSize();
+		if (size.x <= 0 || size.y <= 0 || size.x > maxSize.x || size.y > maxSize.y)
+		{
+			statistics.renderCacheDirectDraws++;
+			return false;
+		}
+
+		if (mRenderCacheDirty || rect != mRenderCacheRect)
+		{
+			RedrawRenderCache(rect);
+
+			if (!mRenderCacheEnabled)
+				return true;
+
+			statistics.renderCacheRedraws++;
+		}
+		else
+		{
+			for (auto& listenerAndScissor : mRenderCacheListeners)
+			{
+				CursorAreaEventsListener* listener = listenerAndScissor.first;
+				if (!listener->mInteractable)
+					continue;
+
+				listener->mScissorRect = listenerAndScissor.second;
+				EventSystem::DrawnCursorAreaListener(listener);
+
+				if (auto dragable = dynamic_cast<DragableObject*>(listener))
+					EventSystem::RegDragListener(dragable);
+			}
+
+			statistics.renderCacheHits++;
+			statistics.renderCacheSavedDrawCalls += Math::Max(0, mRenderCacheDrawCalls - 1);
+		}
+
+		// Cache contains premultiplied colors: it was cleared with transparent color and drawn over with alpha blending
+		BlendMode prevBlendMode = o2Render.GetBlendMode();
+		o2Render.SetBlendMode(BlendMode::Premultiplied);
+
+		mRenderCacheSprite->SetRect(mRenderCacheRect);
+		mRenderCacheSprite->Draw();
+
+		o2Render.SetBlendMode(prevBlendMode);
+
+		return true;
+	}
+
+	void Widget::RedrawRenderCache(const RectF& rect)
+	{
+		Vec2I size((int)rect.Width(), (int)rect.Height());
+		if (!mRenderCacheTexture || mRenderCacheTexture->GetSize() != size)
+		{
+			mRenderCacheTexture = TextureRef(size, PixelFormat::R8G8B8A8, Texture::Usage::RenderTarget);
+
+			if (mRenderCacheSprite)
+				delete mRenderCacheSprite;
+
+			mRenderCacheSprite = mnew Sprite(mRenderCacheTexture, RectI(Vec2I(), size));
+		}
+
+		mRenderCacheRect = rect;
+		mRenderCacheDirty = false;
+
+		RectF outerScissorRect = (RectF)o2Render.GetResScissorRect();
+		Camera prevCamera = o2Render.GetCamera();
+		int prevDrawCalls = o2Render.GetDrawCallsCount();
+
+		Vector<CursorAreaEventsListener*>& drawnListeners = o2Events.mCurrentCursorAreaEventsLayer->cursorEventAreaListeners;
+		int prevListenersCount = drawnListeners.Count();
+
+		o2Render.BindRenderTexture(mRenderCacheTexture);
+		o2Render.Clear(Color4(0, 0, 0, 0));
+
+		Camera camera;
+		camera.SetRect(rect);
+		o2Render.SetCamera(camera);
+
+		RectF renderTargetRect = (RectF)o2Render.GetResScissorRect();
+
+		// Normal blending accumulates alpha in cache, so it gets premultiplied colors
+		BlendMode prevBlendMode = o2Render.GetBlendMode();
+		o2Render.SetBlendMode(BlendMode::Normal);
+
+		mRenderCacheDrawing = true;
+		Draw();
+		mRenderCacheDrawing = false;
+
+		o2Render.SetBlendMode(prevBlendMode);
+
+		// Some of children draws into own render target and unbinds ours, it can't be cached
+		bool renderTargetLost = o2Render.GetRenderTexture() != mRenderCacheTexture;
+
+		o2Render.UnbindRenderTexture();
+		o2Render.SetCamera(prevCamera);
+
+		mRenderCacheDrawCalls = o2Render.GetDrawCallsCount() - prevDrawCalls;
+
+		// Listeners scissors were calculated inside render target, clip them by outer scissor
+		mRenderCacheListeners.Clear();
+		for (int i = prevListenersCount; i < drawnListeners.Count(); i++)
+		{
+			CursorAreaEventsListener* listener = drawnListeners[i];
+			RectF scissorRect = listener->mScissorRect == renderTargetRect ? outerScissorRect :
+				listener->mScissorRect.GetIntersection(outerScissorRect);
+
+			listener->mScissorRect = scissorRect;
+			mRenderCacheListeners.Add({ listener, scissorRect });
+		}
+
+		if (renderTargetLost)
+		{
+			o2Debug.LogWarning("Widget " + mName + " draws into own render target, render cache disabled");
+			SetRenderCacheEnabled(false);
+		}
+	}
+
 	void Widget::DrawDebugFrame()
 	{
 		if (!IsUIDebugEnabled() && !o2Input.IsKeyDown(VK_F2))
@@ -265,6 +424,7 @@ namespace o2
 		mIsClipped = false;
 		Actor::OnTransformUpdated();
 		UpdateLayersLayouts();
+		InvalidateRenderCache();
 		onLayoutUpdated();
 	}
 
@@ -609,6 +769,41 @@ namespace o2
 		return mResTransparency;
 	}
 
+	void Widget::SetRenderCacheEnabled(bool enabled)
+	{
+		mRenderCacheEnabled = enabled;
+		mRenderCacheDirty = true;
+
+		if (!mRenderCacheEnabled)
+		{
+			mRenderCacheTexture = TextureRef();
+			mRenderCacheListeners.Clear();
+
+			if (mRenderCacheSprite)
+				delete mRenderCacheSprite;
+
+			mRenderCacheSprite = nullptr;
+		}
+	}
+
+	bool Widget::IsRenderCacheEnabled() const
+	{
+		return mRenderCacheEnabled;
+	}
+
+	void Widget::InvalidateRenderCache()
+	{
+		int currentFrame = o2Time.GetCurrentFrame();
+		for (Widget* widget = this; widget; widget = widget->mParentWidget)
+		{
+			if (widget->mRenderCacheEnabled)
+			{
+				widget->mRenderCacheDirty = true;
+				widget->mRenderCacheInvalidatedFrame = currentFrame;
+			}
+		}
+	}
+
 	void Widget::SetEnableForcible(bool visible)
 	{
 		if (mVisibleState)
@@ -665,6 +860,19 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && layout->IsPointInside(point);
 	}
 
+	RectF Widget::GetCursorEventsBounds() const
+	{
+		RectF bounds = layout->GetWorldAxisAlignedRect().Expand(mBoundsWithChilds);
+
+		for (auto layer : mDrawingLayers)
+			bounds = bounds.Expand(layer->mInteractableArea);
+
+		for (auto layer : mTopDrawingLayers)
+			bounds = bounds.Expand(layer->mInteractableArea);
+
+		return bounds;
+	}
+
 	void Widget::SetIndexInSiblings(int index)
 	{
 		Actor::SetIndexInSiblings(index);
@@ -728,6 +936,8 @@ namespace o2
 		for (auto layer : mLayers)
 			layer->UpdateResTransparency();
 
+		InvalidateRenderCache();
+
 		for (auto child : mChildWidgets)
 			child->UpdateTransparency();
 
@@ -759,10 +969,12 @@ namespace o2
 			layer->UpdateLayout();
 
 		UpdateBounds();
+		InvalidateRenderCache();
 	}
 
 	void Widget::UpdateDrawingChildren()
 	{
+		InvalidateRenderCache();
 		mDrawingChildren.Clear();
 
 		for (auto child : mChildWidgets)
@@ -800,6 +1012,8 @@ namespace o2
 	{
 		const float topLayersDepth = 1000.0f;
 
+		InvalidateRenderCache();
+
 		mDrawingLayers.Clear();
 		mTopDrawingLayers.Clear();
 
@@ -1155,6 +1369,7 @@ namespace o2
 			}
 
 			layout->SetDirty(false);
+			InvalidateRenderCache();
 
 			if constexpr (IS_EDITOR)
 			{
@@ -1203,6 +1418,7 @@ namespace o2
 		layout->CopyFrom(*other.layout);
 		mTransparency = other.mTransparency;
 		mIsFocusable = other.mIsFocusable;
+		SetRenderCacheEnabled(other.mRenderCacheEnabled);
 
 		for (auto layer : other.mLayers)
 		{
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Assets/Types/AnimationAsset.h"
+#include "o2/Render/TextureRef.h"
 #include "o2/Scene/Actor.h"
 #include "o2/Scene/ISceneDrawable.h"
 #include "o2/Utils/Editor/Attributes/AnimatableAttribute.h"
@@ -12,7 +13,9 @@
 
 namespace o2
 {
+	class CursorAreaEventsListener;
 	class IRectDrawable;
+	class Sprite;
 	class WidgetLayer;
 	class WidgetLayout;
 	class WidgetLayoutData;
@@ -32,6 +35,8 @@ namespace o2
 		PROPERTY(float, transparency, SetTransparency, GetTransparency); // Transparency property
 		GETTER(float, resTransparency, GetResTransparency);              // Result transparency getter, depends on parent transparency @EDITOR_IGNORE @ANIMATABLE
 
+		PROPERTY(bool, renderCacheEnabled, SetRenderCacheEnabled, IsRenderCacheEnabled); // Render cache enabling property
+
 		GETTER(Vector<Widget*>, childrenWidgets, GetChildrenNonConst); // Widget children getter
 
 		GETTER(Vector<WidgetLayer*>, layers, GetLayers); // Layers getter
@@ -198,6 +203,17 @@ namespace o2
 		// Returns widget's result transparency (depends on parent's result transparency)
 		float GetResTransparency() const;
 
+		// Sets render cache enabled. When enabled, widget with children are rendered into texture and drawn from it,
+		// until something inside is changed. Use it for complex static panels
+		void SetRenderCacheEnabled(bool enabled);
+
+		// Returns is render cache enabled
+		bool IsRenderCacheEnabled() const;
+
+		// Marks render cache of this and parent widgets as not actual. Call it when drawing content was changed
+		// without changing layout, layers or states
+		void InvalidateRenderCache();
+
 		// Sets visibility
 		void SetEnableForcible(bool visible);
 
@@ -225,6 +241,9 @@ namespace o2
 		// Returns true if point is under drawable
 		bool IsUnderPoint(const Vec2F& point);
 
+		// Returns bounds of layout, layers interactable areas and children. Cursor area listener widgets use it for hit testing
+		RectF GetCursorEventsBounds() const;
+
 		// Sets parent,  doesn't adds to parent's children but adds to internal children
 		void SetInternalParent(Widget* parent, bool worldPositionStays = false);
 
@@ -285,6 +304,17 @@ namespace o2
 		RectF mBounds;           // Widget bounds by drawing layers
 		RectF mBoundsWithChilds; // Widget with childs bounds
 
+		bool       mRenderCacheEnabled = false;      // Is widget with children rendered into texture and drawn from it @SERIALIZABLE
+		bool       mRenderCacheDirty = true;         // Is render cache texture not actual and must be redrawn
+		bool       mRenderCacheDrawing = false;      // Is widget drawing into render cache texture now
+		int        mRenderCacheInvalidatedFrame = 0; // Frame index, when render cache was invalidated last time
+		int        mRenderCacheDrawCalls = 0;        // Count of draw calls spent on last render cache redraw
+		RectF      mRenderCacheRect;                 // World rectangle, cached in render cache texture
+		TextureRef mRenderCacheTexture;              // Render cache texture
+		Sprite*    mRenderCacheSprite = nullptr;     // Render cache texture sprite
+
+		Vector<Pair<CursorAreaEventsListener*, RectF>> mRenderCacheListeners; // Cursor area listeners with scissor rects, drawn on last render cache redraw. They are registered again when drawing from cache @IGNORE
+
 	protected:
 		// Updates result read enable flag
 		void UpdateResEnabled() override;
@@ -391,6 +421,13 @@ namespace o2
 		// Draws debug frame by mAbsoluteRect
 		void DrawDebugFrame();
 
+		// Draws widget from render cache texture, redraws texture when it isn't actual. Returns false when widget must be
+		// drawn directly: cache is disabled, content is changing or render cache texture can't be used
+		bool DrawFromRenderCache();
+
+		// Redraws widget into render cache texture and remembers cursor listeners drawn inside
+		void RedrawRenderCache(const RectF& rect);
+
 		// Updates drawing children widgets list
 		void UpdateDrawingChildren();
 
@@ -709,6 +746,7 @@ CLASS_FIELDS_META(o2::Widget)
 	PUBLIC_FIELD(enabledForcibly).ANIMATABLE_ATTRIBUTE().EDITOR_IGNORE_ATTRIBUTE();
 	PUBLIC_FIELD(transparency);
 	PUBLIC_FIELD(resTransparency).ANIMATABLE_ATTRIBUTE().EDITOR_IGNORE_ATTRIBUTE();
+	PUBLIC_FIELD(renderCacheEnabled);
 	PUBLIC_FIELD(childrenWidgets);
 	PUBLIC_FIELD(layers);
 	PUBLIC_FIELD(states);
@@ -739,6 +777,14 @@ CLASS_FIELDS_META(o2::Widget)
 	PROTECTED_FIELD(mIsClipped).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mBounds);
 	PROTECTED_FIELD(mBoundsWithChilds);
+	PROTECTED_FIELD(mRenderCacheEnabled).DEFAULT_VALUE(false).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mRenderCacheDirty).DEFAULT_VALUE(true);
+	PROTECTED_FIELD(mRenderCacheDrawing).DEFAULT_VALUE(false);
+	PROTECTED_FIELD(mRenderCacheInvalidatedFrame).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mRenderCacheDrawCalls).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mRenderCacheRect);
+	PROTECTED_FIELD(mRenderCacheTexture);
+	PROTECTED_FIELD(mRenderCacheSprite).DEFAULT_VALUE(nullptr);
 	PROTECTED_FIELD(layersEditable);
 	PROTECTED_FIELD(internalChildrenEditable);
 }
@@ -790,6 +836,9 @@ CLASS_METHODS_META(o2::Widget)
 	PUBLIC_FUNCTION(void, SetTransparency, float);
 	PUBLIC_FUNCTION(float, GetTransparency);
 	PUBLIC_FUNCTION(float, GetResTransparency);
+	PUBLIC_FUNCTION(void, SetRenderCacheEnabled, bool);
+	PUBLIC_FUNCTION(bool, IsRenderCacheEnabled);
+	PUBLIC_FUNCTION(void, InvalidateRenderCache);
 	PUBLIC_FUNCTION(void, SetEnableForcible, bool);
 	PUBLIC_FUNCTION(void, Show, bool);
 	PUBLIC_FUNCTION(void, Hide, bool);
@@ -799,6 +848,7 @@ CLASS_METHODS_META(o2::Widget)
 	PUBLIC_FUNCTION(bool, IsFocusable);
 	PUBLIC_FUNCTION(void, SetFocusable, bool);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(RectF, GetCursorEventsBounds);
 	PUBLIC_FUNCTION(void, SetInternalParent, Widget*, bool);
 	PUBLIC_FUNCTION(void, AddInternalWidget, Widget*, bool);
 	PUBLIC_FUNCTION(Widget*, GetInternalWidget, const String&);
@@ -839,6 +889,8 @@ CLASS_METHODS_META(o2::Widget)
 	PROTECTED_FUNCTION(void, OnStateAdded, WidgetState*);
 	PROTECTED_FUNCTION(void, OnStatesListChanged);
 	PROTECTED_FUNCTION(void, DrawDebugFrame);
+	PROTECTED_FUNCTION(bool, DrawFromRenderCache);
+	PROTECTED_FUNCTION(void, RedrawRenderCache, const RectF&);
 	PROTECTED_FUNCTION(void, UpdateDrawingChildren);
 	PROTECTED_FUNCTION(void, UpdateLayersDrawingSequence);
 	PROTECTED_FUNCTION(void, RetargetStatesAnimations);
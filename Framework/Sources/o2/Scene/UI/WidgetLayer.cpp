@@ -133,6 +133,9 @@ namespace o2
 	void WidgetLayer::SetEnabled(bool enabled)
 	{
 		mEnabled = enabled;
+
+		if (mOwnerWidget)
+			mOwnerWidget->InvalidateRenderCache();
 	}
 
 	WidgetLayer* WidgetLayer::AddChild(WidgetLayer* node)
@@ -411,6 +414,9 @@ namespace o2
 		if (mDrawable)
 			mDrawable->SetTransparency(mResTransparency);
 
+		if (mOwnerWidget)
+			mOwnerWidget->InvalidateRenderCache();
+
 		for (auto child : mChildren)
 			child->UpdateResTransparency();
 	}
@@ -1,6 +1,7 @@
 #include "o2/stdafx.h"
 #include "WidgetLayout.h"
 
+#include "o2/Scene/UI/UIManager.h"
 #include "o2/Scene/UI/Widget.h"
 #include "o2/Utils/Delegates.h"
 
@@ -612,6 +613,13 @@ namespace o2
 				parent->transform->SetDirty(fromParent);
 		}
 
+		if (!fromParent)
+		{
+			mData->dirtyBySelf = true;
+			mData->minWidthWithChildrenFrame = 0;
+			mData->minHeightWithChildrenFrame = 0;
+		}
+
 		ActorTransform::SetDirty(fromParent);
 	}
 
@@ -646,6 +654,23 @@ namespace o2
 				parent->transform->mData->pivot*parentWorldRect.Size();
 		}
 
+		if (IsUpdateSkippable(parentWorldRect))
+		{
+			mData->updateFrame = mData->dirtyFrame;
+			mData->updateSkipped = true;
+
+			if (UIManager::IsSingletonInitialzed())
+				o2UI.GetCurrentFrameStatistics().skippedLayouts++;
+
+			return;
+		}
+
+		mData->lastParentWorldRect = parentWorldRect;
+		mData->lastAnchorMin = mData->anchorMin;
+		mData->lastAnchorMax = mData->anchorMax;
+		mData->lastOffsetMin = mData->offsetMin;
+		mData->lastOffsetMax = mData->offsetMax;
+
 		RectF worldRectangle(parentWorldRect.LeftBottom() + mData->offsetMin + mData->anchorMin*parentWorldRect.Size(),
 							 parentWorldRect.LeftBottom() + mData->offsetMax + mData->anchorMax*parentWorldRect.Size());
 
@@ -660,6 +685,11 @@ namespace o2
 		UpdateWorldRectangleAndTransform();
 
 		mData->updateFrame = mData->dirtyFrame;
+		mData->updateSkipped = false;
+		mData->dirtyBySelf = false;
+
+		if (UIManager::IsSingletonInitialzed())
+			o2UI.GetCurrentFrameStatistics().updatedLayouts++;
 
 		if (mData->owner)
 		{
@@ -668,6 +698,22 @@ namespace o2
 		}
 	}
 
+	bool WidgetLayout::IsUpdateSkippable(const RectF& parentWorldRect) const
+	{
+		if (mData->updateFrame != 0 || mData->dirtyBySelf || !mData->owner || !mData->owner->mParent)
+			return false;
+
+		auto parentData = mData->owner->mParent->transform->mData;
+		Vec2F parentRectangePosition = parentData->worldRectangle.LeftBottom() + parentData->size*parentData->pivot;
+
+		return mData->lastParentWorldRect == parentWorldRect &&
+			mData->parentRectangle == parentData->worldRectangle &&
+			mData->parentRectangePosition == parentRectangePosition &&
+			mData->parentTransform == parentData->worldNonSizedTransform &&
+			mData->lastAnchorMin == mData->anchorMin && mData->lastAnchorMax == mData->anchorMax &&
+			mData->lastOffsetMin == mData->offsetMin && mData->lastOffsetMax == mData->offsetMax;
+	}
+
 	void WidgetLayout::FloorRectangle()
 	{
 		mData->size.x = Math::Round(mData->size.x);
@@ -280,6 +280,9 @@ namespace o2
 		// Updates offsets to match existing rectangle to offsets and anchors rectangle
 		void UpdateOffsetsByCurrentTransform();
 
+		// Returns true when layout is dirty only by parent and parent rectangle, anchors and offsets are same as in last update
+		bool IsUpdateSkippable(const RectF& parentWorldRect) const;
+
 		// Checks minimum and maximum size
 		void CheckMinMax();
 
@@ -308,6 +311,19 @@ namespace o2
 
 		bool drivenByParent = false; // Is layout controlling by parent
 
+		bool dirtyBySelf = true;    // Is layout changed by itself, not only by parent. Such layout can't skip update
+		bool updateSkipped = false; // Is last update skipped because layout inputs wasn't changed
+
+		RectF lastParentWorldRect; // Parent rectangle for children, used in last update
+		Vec2F lastAnchorMin;       // Left bottom anchor, used in last update
+		Vec2F lastAnchorMax;       // Right top anchor, used in last update
+		Vec2F lastOffsetMin;       // Left bottom offset, used in last update
+		Vec2F lastOffsetMax;       // Right top offset, used in last update
+
+		mutable Vec2F minSizeWithChildren;            // Cached minimal size with children, measured by layout widgets
+		mutable int   minWidthWithChildrenFrame = 0;  // Frame when minimal width with children was measured, 0 when not actual
+		mutable int   minHeightWithChildrenFrame = 0; // Frame when minimal height with children was measured, 0 when not actual
+
 		Widget* owner = nullptr; // owner widget pointer 
 
 		SERIALIZABLE(WidgetLayoutData);
@@ -421,6 +437,7 @@ CLASS_METHODS_META(o2::WidgetLayout)
 	PROTECTED_FUNCTION(RectF, GetParentRectangle);
 	PROTECTED_FUNCTION(void, FloorRectangle);
 	PROTECTED_FUNCTION(void, UpdateOffsetsByCurrentTransform);
+	PROTECTED_FUNCTION(bool, IsUpdateSkippable, const RectF&);
 	PROTECTED_FUNCTION(void, CheckMinMax);
 	PROTECTED_FUNCTION(void, DontCheckMinMax);
 }
@@ -442,6 +459,16 @@ CLASS_FIELDS_META(o2::WidgetLayoutData)
 	PUBLIC_FIELD(weight).DEFAULT_VALUE(Vec2F(1, 1)).SERIALIZABLE_ATTRIBUTE();
 	PUBLIC_FIELD(childrenWorldRect);
 	PUBLIC_FIELD(drivenByParent).DEFAULT_VALUE(false);
+	PUBLIC_FIELD(dirtyBySelf).DEFAULT_VALUE(true);
+	PUBLIC_FIELD(updateSkipped).DEFAULT_VALUE(false);
+	PUBLIC_FIELD(lastParentWorldRect);
+	PUBLIC_FIELD(lastAnchorMin);
+	PUBLIC_FIELD(lastAnchorMax);
+	PUBLIC_FIELD(lastOffsetMin);
+	PUBLIC_FIELD(lastOffsetMax);
+	PUBLIC_FIELD(minSizeWithChildren);
+	PUBLIC_FIELD(minWidthWithChildrenFrame).DEFAULT_VALUE(0);
+	PUBLIC_FIELD(minHeightWithChildrenFrame).DEFAULT_VALUE(0);
 	PUBLIC_FIELD(owner).DEFAULT_VALUE(nullptr);
 }
 END_META;
@@ -118,6 +118,9 @@ namespace o2
 			onStateBecomesFalse();
 			onStateFullyFalse();
 		}
+
+		if (mOwner)
+			mOwner->InvalidateRenderCache();
 	}
 
 	bool WidgetState::GetState() const
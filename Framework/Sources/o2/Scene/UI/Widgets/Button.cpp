@@ -79,6 +79,15 @@ namespace o2
 		return mDrawingScissorRect.IsInside(point) && isPointInside(point);
 	}
 
+	bool Button::GetCursorAreaBounds(RectF& bounds) const
+	{
+		if (!isPointInside.IsEmpty())
+			return false;
+
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	String Button::GetCreateMenuGroup()
 	{
 		return "Basic";
@@ -298,6 +298,12 @@ namespace o2
 		mAbsoluteClip = mClipLayout.Calculate(GetLayoutData().worldRectangle);
 	}
 
+	bool CustomDropDown::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	String CustomDropDown::GetCreateMenuGroup()
 	{
 		return "Dropping";
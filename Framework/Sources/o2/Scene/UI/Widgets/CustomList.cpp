@@ -81,6 +81,7 @@ namespace o2
 		{
 			mCurrentHoverRect = Math::Lerp(mCurrentHoverRect, mTargetHoverRect, dt*rectLerpCoef);
 			mHoverDrawable->SetRect(mCurrentHoverRect);
+			InvalidateRenderCache();
 		}
 	}
 
@@ -89,6 +90,9 @@ namespace o2
 		if (!mResEnabledInHierarchy || mIsClipped)
 			return;
 
+		if (DrawFromRenderCache())
+			return;
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
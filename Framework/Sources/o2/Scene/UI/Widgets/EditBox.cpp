@@ -770,6 +770,8 @@ namespace o2
 		Vec2F caretPosition = GetTextCaretPosition(mSelectionEnd);
 		mCaretDrawable->SetPosition(caretPosition);
 
+		InvalidateRenderCache();
+
 		mSelectionMesh->vertexCount = 0;
 		mSelectionMesh->polyCount = 0;
 
@@ -785,10 +787,12 @@ namespace o2
 		auto font = mTextDrawable->GetFont();
 		float spaceAdvance = font->GetCharacter(' ', mTextDrawable->GetHeight()).mAdvance;
 
-		for (auto line : symbolsSet.mLines)
+		// Lines are searched from first selected, only visible part of text changes on typing
+		for (int i = symbolsSet.GetLineIndexByPosition(beg); i < symbolsSet.mLines.Count(); i++)
 		{
-			if (beg > line.mLineBegSymbol + line.mSymbols.Count() || end < line.mLineBegSymbol)
-				continue;
+			const auto& line = symbolsSet.mLines[i];
+			if (end < line.mLineBegSymbol)
+				break;
 
 			if (line.mSymbols.Count() == 0)
 			{
@@ -839,9 +843,11 @@ namespace o2
 		}
 
 		auto& symbolsSet = mTextDrawable->GetSymbolsSet();
-		for (auto line : symbolsSet.mLines)
+		int lineIdx = symbolsSet.GetLineIndexByPosition(position);
+		if (lineIdx < symbolsSet.mLines.Count())
 		{
-			if (position >= line.mLineBegSymbol && position <= line.mLineBegSymbol + line.mSymbols.Count())
+			const auto& line = symbolsSet.mLines[lineIdx];
+			if (position >= line.mLineBegSymbol)
 			{
 				int off = position - line.mLineBegSymbol;
 
@@ -887,7 +893,7 @@ namespace o2
 
 		bool checkUp, checkDown, checkLeft, checkRight;
 		int lineIdx = 0;
-		for (auto line : symbolsSet.mLines)
+		for (const auto& line : symbolsSet.mLines)
 		{
 			checkUp = lineIdx > 0;
 			checkDown = lineIdx < (int)symbolsSet.mLines.Count() - 1;
@@ -938,6 +944,9 @@ namespace o2
 
 		if (mCaretBlinkTime > mCaretBlinkDelay)
 			mCaretBlinkTime -= mCaretBlinkDelay;
+
+		if (mIsFocused)
+			InvalidateRenderCache();
 	}
 
 	void EditBox::AddSelectionRect(const RectF& rect)
@@ -1,7 +1,9 @@
 #include "o2/stdafx.h"
 #include "GridLayout.h"
 
+#include "o2/Scene/UI/UIManager.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/System/Time/Time.h"
 
 namespace o2
 {
@@ -161,7 +163,8 @@ namespace o2
 
 		Widget::UpdateSelfTransform();
 
-		RearrangeChilds();
+		if (!GetLayoutData().updateSkipped)
+			RearrangeChilds();
 	}
 
 	String GridLayout::GetCreateMenuGroup()
@@ -198,6 +201,9 @@ namespace o2
 
 	void GridLayout::RearrangeChilds()
 	{
+		if (UIManager::IsSingletonInitialzed())
+			o2UI.GetCurrentFrameStatistics().arrangedLayouts++;
+
 		switch (mBaseCorner)
 		{
 			case BaseCorner::LeftTop: ArrangeFromLeftTop(); break;
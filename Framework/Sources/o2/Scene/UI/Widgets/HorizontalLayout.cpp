@@ -1,7 +1,9 @@
 #include "o2/stdafx.h"
 #include "HorizontalLayout.h"
 
+#include "o2/Scene/UI/UIManager.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/System/Time/Time.h"
 
 namespace o2
 {
@@ -155,7 +157,8 @@ namespace o2
 
 		Widget::UpdateSelfTransform();
 
-		RearrangeChilds();
+		if (!GetLayoutData().updateSkipped)
+			RearrangeChilds();
 	}
 
 	String HorizontalLayout::GetCreateMenuGroup()
@@ -187,6 +190,10 @@ namespace o2
 		if (!mFitByChildren)
 			return Widget::GetMinWidthWithChildren();
 
+		const WidgetLayoutData& layoutData = GetLayoutData();
+		if (layoutData.minWidthWithChildrenFrame == o2Time.GetCurrentFrame())
+			return layoutData.minSizeWithChildren.x;
+
 		float res = mBorder.left + mBorder.right + Math::Max(mChildWidgets.Count() - 1, 0)*mSpacing;
 		for (auto child : mChildWidgets)
 		{
@@ -194,7 +201,10 @@ namespace o2
 				res += child->GetMinWidthWithChildren();
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.x);
+		res = Math::Max(res, layoutData.minSize.x);
+
+		layoutData.minSizeWithChildren.x = res;
+		layoutData.minWidthWithChildrenFrame = o2Time.GetCurrentFrame();
 
 		return res;
 	}
@@ -204,6 +214,10 @@ namespace o2
 		if (!mFitByChildren)
 			return Widget::GetMinHeightWithChildren();
 
+		const WidgetLayoutData& layoutData = GetLayoutData();
+		if (layoutData.minHeightWithChildrenFrame == o2Time.GetCurrentFrame())
+			return layoutData.minSizeWithChildren.y;
+
 		float res = 0;
 		for (auto child : mChildWidgets)
 		{
@@ -211,7 +225,10 @@ namespace o2
 				res = Math::Max(res, child->GetMinHeightWithChildren() + mBorder.top + mBorder.bottom);
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.y);
+		res = Math::Max(res, layoutData.minSize.y);
+
+		layoutData.minSizeWithChildren.y = res;
+		layoutData.minHeightWithChildrenFrame = o2Time.GetCurrentFrame();
 
 		return res;
 	}
@@ -240,6 +257,9 @@ namespace o2
 
 	void HorizontalLayout::RearrangeChilds()
 	{
+		if (UIManager::IsSingletonInitialzed())
+			o2UI.GetCurrentFrameStatistics().arrangedLayouts++;
+
 		UpdateLayoutParametres();
 
 		switch (mBaseCorner)
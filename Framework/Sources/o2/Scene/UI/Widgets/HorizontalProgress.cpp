@@ -143,6 +143,12 @@ namespace o2
 		return false;
 	}
 
+	bool HorizontalProgress::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool HorizontalProgress::IsScrollable() const
 	{
 		return true;
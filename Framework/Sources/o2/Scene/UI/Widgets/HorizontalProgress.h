@@ -81,6 +81,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns is listener scrollable
 		bool IsScrollable() const override;
 
@@ -187,6 +190,7 @@ CLASS_METHODS_META(o2::HorizontalProgress)
 	PUBLIC_FUNCTION(void, SetOrientation, Orientation);
 	PUBLIC_FUNCTION(Orientation, GetOrientation);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_FUNCTION(bool, IsScrollable);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
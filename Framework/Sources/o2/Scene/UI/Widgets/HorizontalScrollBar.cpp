@@ -155,6 +155,12 @@ namespace o2
 		return false;
 	}
 
+	bool HorizontalScrollBar::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool HorizontalScrollBar::IsScrollable() const
 	{
 		return !Math::Equals(mMinValue, mMaxValue);
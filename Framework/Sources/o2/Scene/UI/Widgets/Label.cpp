@@ -115,6 +115,8 @@ namespace o2
 
 		if (mHorOverflow == HorOverflow::Expand || mVerOverflow == VerOverflow::Expand)
 			SetLayoutDirty();
+
+		InvalidateRenderCache();
 	}
 
 	const WString& Label::GetText() const
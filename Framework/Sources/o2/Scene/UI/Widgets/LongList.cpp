@@ -57,12 +57,14 @@ namespace o2
 		{
 			mCurrentHoverRect = Math::Lerp(mCurrentHoverRect, mTargetHoverRect, dt*rectLerpCoef);
 			mHoverDrawable->SetRect(mCurrentHoverRect);
+			InvalidateRenderCache();
 		}
 
 		if (mCurrentSelectionRect != mTargetSelectionRect)
 		{
 			mCurrentSelectionRect = Math::Lerp(mCurrentSelectionRect, mTargetSelectionRect, dt*rectLerpCoef);
 			mSelectionDrawable->SetRect(mCurrentSelectionRect);
+			InvalidateRenderCache();
 		}
 	}
 
@@ -71,6 +73,9 @@ namespace o2
 		if (!mResEnabledInHierarchy || mIsClipped)
 			return;
 
+		if (DrawFromRenderCache())
+			return;
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
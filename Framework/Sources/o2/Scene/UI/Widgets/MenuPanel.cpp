@@ -67,6 +67,7 @@ namespace o2
 		{
 			mCurrentSelectionRect = Math::Lerp(mCurrentSelectionRect, mTargetSelectionRect, dt*rectLerpCoef);
 			mSelectionDrawable->SetRect(mCurrentSelectionRect);
+			InvalidateRenderCache();
 		}
 
 		if (mSelectSubContextTime >= 0.0f)
@@ -97,6 +98,9 @@ namespace o2
 		if (!mResEnabledInHierarchy)
 			return;
 
+		if (DrawFromRenderCache())
+			return;
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
@@ -501,6 +505,12 @@ namespace o2
 		return text == other.text;
 	}
 
+	bool MenuPanel::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	String MenuPanel::GetCreateMenuGroup()
 	{
 		return "Dropping";
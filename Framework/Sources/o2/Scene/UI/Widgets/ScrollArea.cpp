@@ -81,6 +81,9 @@ namespace o2
 			return;
 		}
 
+		if (DrawFromRenderCache())
+			return;
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
@@ -444,6 +447,12 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool ScrollArea::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool ScrollArea::IsScrollable() const
 	{
 		return true;
@@ -82,6 +82,9 @@ namespace o2
 		if (!mResEnabledInHierarchy || mIsClipped)
 			return;
 
+		if (DrawFromRenderCache())
+			return;
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
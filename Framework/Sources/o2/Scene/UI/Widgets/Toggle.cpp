@@ -318,6 +318,12 @@ namespace o2
 			mBackLayer = layer;
 	}
 
+	bool Toggle::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	String Toggle::GetCreateMenuGroup()
 	{
 		return "Basic";
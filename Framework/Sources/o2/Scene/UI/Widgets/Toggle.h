@@ -119,6 +119,9 @@ namespace o2
 		// Returns is this widget can be selected
 		bool IsFocusable() const override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns create menu group in editor
 		static String GetCreateMenuGroup();
 
@@ -210,6 +213,7 @@ CLASS_METHODS_META(o2::Toggle)
 	PUBLIC_FUNCTION(void, SetToggleGroup, ToggleGroup*);
 	PUBLIC_FUNCTION(ToggleGroup*, GetToggleGroup);
 	PUBLIC_FUNCTION(bool, IsFocusable);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
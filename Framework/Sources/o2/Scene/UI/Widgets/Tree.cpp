@@ -82,6 +82,12 @@ namespace o2
 		return Widget::IsUnderPoint(point);
 	}
 
+	bool TreeNode::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	String TreeNode::GetCreateMenuGroup()
 	{
 		return "Tree";
@@ -219,9 +225,12 @@ namespace o2
 		if (!mResEnabledInHierarchy || mIsClipped)
 			return;
 
-		if (mIsDraggingNodes)
+		if (mIsDraggingNodes && !mRenderCacheDrawing)
 			o2UI.DrawWidgetAtTop(mFakeDragNode);
 
+		if (DrawFromRenderCache())
+			return;
+
 		for (auto layer : mDrawingLayers)
 			layer->Draw();
 
@@ -312,6 +321,7 @@ namespace o2
 		{
 			mCurrentHoverRect = Math::Lerp(mCurrentHoverRect, mTargetHoverRect, dt*rectLerpCoef);
 			mHoverDrawable->SetRect(mCurrentHoverRect);
+			InvalidateRenderCache();
 
 			float alpha = mHoverDrawable->GetTransparency();
 			mHoverDrawable->SetTransparency(alpha);
@@ -531,6 +531,9 @@ namespace o2
 		// Returns true if point is in this object
 		bool IsUnderPoint(const Vec2F& point) override;
 
+		// Returns widget bounds for cursor events hit testing
+		bool GetCursorAreaBounds(RectF& bounds) const override;
+
 		// Returns create menu group in editor
 		static String GetCreateMenuGroup();
 
@@ -783,6 +786,7 @@ CLASS_METHODS_META(o2::TreeNode)
 	PUBLIC_FUNCTION(void, Collapse, bool);
 	PUBLIC_FUNCTION(void*, GetObject);
 	PUBLIC_FUNCTION(bool, IsUnderPoint, const Vec2F&);
+	PUBLIC_FUNCTION(bool, GetCursorAreaBounds, RectF&);
 	PUBLIC_STATIC_FUNCTION(String, GetCreateMenuGroup);
 	PROTECTED_FUNCTION(void, CopyData, const Actor&);
 	PROTECTED_FUNCTION(void, UpdateTreeLayout, float);
@@ -2,7 +2,9 @@
 #include "VerticalLayout.h"
 
 #include "o2/Scene/UI/WidgetLayer.h"
+#include "o2/Scene/UI/UIManager.h"
 #include "o2/Scene/UI/WidgetLayout.h"
+#include "o2/Utils/System/Time/Time.h"
 
 namespace o2
 {
@@ -156,7 +158,8 @@ namespace o2
 
 		Widget::UpdateSelfTransform();
 
-		RearrangeChilds();
+		if (!GetLayoutData().updateSkipped)
+			RearrangeChilds();
 	}
 
 	String VerticalLayout::GetCreateMenuGroup()
@@ -189,6 +192,10 @@ namespace o2
 		if (!mFitByChildren)
 			return Widget::GetMinWidthWithChildren();
 
+		const WidgetLayoutData& layoutData = GetLayoutData();
+		if (layoutData.minWidthWithChildrenFrame == o2Time.GetCurrentFrame())
+			return layoutData.minSizeWithChildren.x;
+
 		float res = 0;
 		for (auto child : mChildWidgets)
 		{
@@ -196,7 +203,10 @@ namespace o2
 				res = Math::Max(res, child->GetMinWidthWithChildren() + mBorder.left + mBorder.right);
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.x);
+		res = Math::Max(res, layoutData.minSize.x);
+
+		layoutData.minSizeWithChildren.x = res;
+		layoutData.minWidthWithChildrenFrame = o2Time.GetCurrentFrame();
 
 		return res;
 	}
@@ -206,6 +216,10 @@ namespace o2
 		if (!mFitByChildren)
 			return Widget::GetMinHeightWithChildren();
 
+		const WidgetLayoutData& layoutData = GetLayoutData();
+		if (layoutData.minHeightWithChildrenFrame == o2Time.GetCurrentFrame())
+			return layoutData.minSizeWithChildren.y;
+
 		float res = mBorder.top + mBorder.bottom + Math::Max(mChildWidgets.Count() - 1, 0)*mSpacing;
 		for (auto child : mChildWidgets)
 		{
@@ -213,7 +227,10 @@ namespace o2
 				res += child->GetMinHeightWithChildren();
 		}
 
-		res = Math::Max(res, GetLayoutData().minSize.y);
+		res = Math::Max(res, layoutData.minSize.y);
+
+		layoutData.minSizeWithChildren.y = res;
+		layoutData.minHeightWithChildrenFrame = o2Time.GetCurrentFrame();
 
 		return res;
 	}
@@ -242,6 +259,9 @@ namespace o2
 
 	void VerticalLayout::RearrangeChilds()
 	{
+		if (UIManager::IsSingletonInitialzed())
+			o2UI.GetCurrentFrameStatistics().arrangedLayouts++;
+
 		switch (mBaseCorner)
 		{
 			case BaseCorner::LeftTop:
@@ -143,6 +143,12 @@ namespace o2
 		return false;
 	}
 
+	bool VerticalProgress::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool VerticalProgress::IsScrollable() const
 	{
 		return true;
@@ -150,6 +150,12 @@ namespace o2
 		return false;
 	}
 
+	bool VerticalScrollBar::GetCursorAreaBounds(RectF& bounds) const
+	{
+		bounds = GetCursorEventsBounds();
+		return true;
+	}
+
 	bool VerticalScrollBar::IsScrollable() const
 	{
 		return !Math::Equals(mMinValue, mMaxValue);
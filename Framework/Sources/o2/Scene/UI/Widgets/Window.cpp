@@ -53,6 +53,9 @@ namespace o2
 			return;
 		}
 
+		if (DrawFromRenderCache())
+			return;
+
 		mBackCursorArea.OnDrawn();
 
 		for (auto layer : mDrawingLayers)
@@ -4,9 +4,331 @@
 #include "o2/Utils/Bitmap/PngFormat.h"
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/Reflection/Reflection.h"
+#include "o2/Utils/Tasks/WorkersPool.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BITMAP_SSE
+#include <emmintrin.h>
+#endif
 
 namespace o2
 {
+	// Minimal count of processing pixels, from which image rows are processed on several threads
+	static const int minParallelPixels = 256*1024;
+
+	// Maximal count of threads processing image rows
+	static const int maxRowsThreads = 8;
+
+	// Calls func(rowBegin, rowEnd) for ranges of rows. Rows of large images are split between shared pool workers, so
+	// func must not allocate memory or change shared state
+	template<typename _func>
+	static void ProcessRows(int rows, int rowPixels, const _func& func)
+	{
+		int threadsCount = Math::Min(Math::Min(o2Workers.GetWorkersCount() + 1, maxRowsThreads), rows);
+		if (rows*rowPixels < minParallelPixels || threadsCount < 2)
+		{
+			func(0, rows);
+			return;
+		}
+
+		int rowsPerThread = (rows + threadsCount - 1)/threadsCount;
+
+		o2Workers.Run(threadsCount, [&](int index, int threadIndex)
+		{
+			func(Math::Min(index*rowsPerThread, rows), Math::Min((index + 1)*rowsPerThread, rows));
+		});
+	}
+
+	// Returns pixel color. R8 pixel is alpha of white color, R8G8B8 pixel is opaque
+	static Color4 LoadPixel(const UInt8* pixel, int bpp)
+	{
+		if (bpp == 4)
+			return Color4(pixel[0], pixel[1], pixel[2], pixel[3]);
+
+		if (bpp == 3)
+			return Color4(pixel[0], pixel[1], pixel[2], 255);
+
+		return Color4(255, 255, 255, pixel[0]);
+	}
+
+	// Stores color into pixel
+	static void StorePixel(UInt8* pixel, int bpp, const Color4& color)
+	{
+		if (bpp == 1)
+		{
+			pixel[0] = (UInt8)color.a;
+			return;
+		}
+
+		pixel[0] = (UInt8)color.r;
+		pixel[1] = (UInt8)color.g;
+		pixel[2] = (UInt8)color.b;
+
+		if (bpp == 4)
+			pixel[3] = (UInt8)color.a;
+	}
+
+	// Returns pixel alpha
+	static int GetPixelAlpha(const UInt8* pixel, int bpp)
+	{
+		if (bpp == 4)
+			return pixel[3];
+
+		if (bpp == 3)
+			return 255;
+
+		return pixel[0];
+	}
+
+	// Clips image source rect placed at position by both images bounds. Returns range of source rect offsets in
+	// begin and end, or false when nothing is left
+	static bool ClipImageRect(const Vec2I& size, const Vec2I& imgSize, const Vec2I& position, const RectI& imgSrcRect,
+							  Vec2I& begin, Vec2I& end)
+	{
+		begin.x = Math::Max(Math::Max(0, -position.x), -imgSrcRect.left);
+		begin.y = Math::Max(Math::Max(0, -position.y), -imgSrcRect.bottom);
+		end.x = Math::Min(Math::Min(imgSrcRect.right - imgSrcRect.left, size.x - position.x), imgSize.x - imgSrcRect.left);
+		end.y = Math::Min(Math::Min(imgSrcRect.top - imgSrcRect.bottom, size.y - position.y), imgSize.y - imgSrcRect.bottom);
+
+		return begin.x < end.x && begin.y < end.y;
+	}
+
+#ifdef BITMAP_SSE
+	// Divides 16 bit values by 255 with rounding down. Values must be not greater than 255*255
+	static inline __m128i DivideBy255(__m128i v)
+	{
+		return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(v, _mm_set1_epi16(1)), _mm_srli_epi16(v, 8)), 8);
+	}
+
+	// Multiplies four pixels channels by 16 bit factors as Color4 multiplication does
+	static inline __m128i MultiplyPixels(__m128i pixels, __m128i lowFactors, __m128i highFactors)
+	{
+		__m128i zero = _mm_setzero_si128();
+		__m128i low = DivideBy255(_mm_mullo_epi16(_mm_unpacklo_epi8(pixels, zero), lowFactors));
+		__m128i high = DivideBy255(_mm_mullo_epi16(_mm_unpackhi_epi8(pixels, zero), highFactors));
+		return _mm_packus_epi16(low, high);
+	}
+
+	// Loads four bytes as floats
+	static inline __m128 LoadBytes(const UInt8* bytes)
+	{
+		int value;
+		memcpy(&value, bytes, 4);
+
+		__m128i zero = _mm_setzero_si128();
+		__m128i words = _mm_unpacklo_epi8(_mm_cvtsi32_si128(value), zero);
+		return _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero));
+	}
+
+	// Rounds floats and stores them as four bytes
+	static inline void StoreBytes(UInt8* bytes, __m128 values)
+	{
+		__m128i integers = _mm_cvttps_epi32(_mm_add_ps(values, _mm_set1_ps(0.5f)));
+		__m128i words = _mm_packs_epi32(integers, integers);
+		int value = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+		memcpy(bytes, &value, 4);
+	}
+
+	// Blends destination pixel over source pixel as Color4::BlendByAlpha does. Pixels channels are 32 bit integers
+	static inline __m128i BlendPixel(__m128i dst, __m128i src)
+	{
+		__m128 dstColor = _mm_cvtepi32_ps(dst);
+		__m128 srcColor = _mm_cvtepi32_ps(src);
+		__m128 maxChannel = _mm_set1_ps(255.0f);
+
+		__m128 dstAlpha = _mm_div_ps(_mm_shuffle_ps(dstColor, dstColor, _MM_SHUFFLE(3, 3, 3, 3)), maxChannel);
+		__m128 srcAlpha = _mm_div_ps(_mm_shuffle_ps(srcColor, srcColor, _MM_SHUFFLE(3, 3, 3, 3)), maxChannel);
+		__m128 srcCoef = _mm_mul_ps(srcAlpha, _mm_sub_ps(_mm_set1_ps(1.0f), dstAlpha));
+
+		__m128 color = _mm_add_ps(_mm_mul_ps(dstAlpha, dstColor), _mm_mul_ps(srcCoef, srcColor));
+		__m128 alpha = _mm_mul_ps(maxChannel, _mm_add_ps(dstAlpha, srcCoef));
+
+		__m128 alphaMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		__m128 result = _mm_or_ps(_mm_andnot_ps(alphaMask, color), _mm_and_ps(alphaMask, alpha));
+
+		return _mm_cvttps_epi32(result);
+	}
+#endif
+
+	// Blends destination pixels over source pixels
+	static void BlendPixels(UInt8* dst, const UInt8* src, int count, int bpp)
+	{
+		int i = 0;
+
+#ifdef BITMAP_SSE
+		if (bpp == 4)
+		{
+			__m128i zero = _mm_setzero_si128();
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i dstPixels = _mm_loadu_si128((const __m128i*)(dst + i*4));
+				__m128i srcPixels = _mm_loadu_si128((const __m128i*)(src + i*4));
+
+				__m128i dstLow = _mm_unpacklo_epi8(dstPixels, zero), dstHigh = _mm_unpackhi_epi8(dstPixels, zero);
+				__m128i srcLow = _mm_unpacklo_epi8(srcPixels, zero), srcHigh = _mm_unpackhi_epi8(srcPixels, zero);
+
+				__m128i result0 = BlendPixel(_mm_unpacklo_epi16(dstLow, zero), _mm_unpacklo_epi16(srcLow, zero));
+				__m128i result1 = BlendPixel(_mm_unpackhi_epi16(dstLow, zero), _mm_unpackhi_epi16(srcLow, zero));
+				__m128i result2 = BlendPixel(_mm_unpacklo_epi16(dstHigh, zero), _mm_unpacklo_epi16(srcHigh, zero));
+				__m128i result3 = BlendPixel(_mm_unpackhi_epi16(dstHigh, zero), _mm_unpackhi_epi16(srcHigh, zero));
+
+				__m128i result = _mm_packus_epi16(_mm_packs_epi32(result0, result1), _mm_packs_epi32(result2, result3));
+				_mm_storeu_si128((__m128i*)(dst + i*4), result);
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+			StorePixel(dst + i*bpp, bpp, LoadPixel(dst + i*bpp, bpp).BlendByAlpha(LoadPixel(src + i*bpp, bpp)));
+	}
+
+	// Multiplies pixels colors by color
+	static void ColorisePixels(UInt8* pixels, int count, int bpp, const Color4& color)
+	{
+		int i = 0;
+
+#ifdef BITMAP_SSE
+		if (bpp == 4)
+		{
+			short r = (short)Math::Clamp(color.r, 0, 255), g = (short)Math::Clamp(color.g, 0, 255),
+				b = (short)Math::Clamp(color.b, 0, 255), a = (short)Math::Clamp(color.a, 0, 255);
+
+			__m128i factors = _mm_setr_epi16(r, g, b, a, r, g, b, a);
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i result = MultiplyPixels(_mm_loadu_si128((const __m128i*)(pixels + i*4)), factors, factors);
+				_mm_storeu_si128((__m128i*)(pixels + i*4), result);
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+			StorePixel(pixels + i*bpp, bpp, LoadPixel(pixels + i*bpp, bpp)*color);
+	}
+
+	// Multiplies R8G8B8A8 pixels colors by their alpha
+	static void PremultiplyPixels(UInt8* pixels, int count)
+	{
+		int i = 0;
+
+#ifdef BITMAP_SSE
+		__m128i colorMask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+		__m128i opaqueAlpha = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+		__m128i zero = _mm_setzero_si128();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i pixelsData = _mm_loadu_si128((const __m128i*)(pixels + i*4));
+
+			__m128i low = _mm_unpacklo_epi8(pixelsData, zero);
+			low = _mm_shufflehi_epi16(_mm_shufflelo_epi16(low, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			low = _mm_or_si128(_mm_and_si128(low, colorMask), opaqueAlpha);
+
+			__m128i high = _mm_unpackhi_epi8(pixelsData, zero);
+			high = _mm_shufflehi_epi16(_mm_shufflelo_epi16(high, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			high = _mm_or_si128(_mm_and_si128(high, colorMask), opaqueAlpha);
+
+			_mm_storeu_si128((__m128i*)(pixels + i*4), MultiplyPixels(pixelsData, low, high));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			Color4 color = LoadPixel(pixels + i*4, 4);
+			StorePixel(pixels + i*4, 4, color*Color4(color.a, color.a, color.a, 255));
+		}
+	}
+
+	// Fills inverted sums of blur weights, which are inside line for each line pixel
+	static void InitBlurWeightsSums(float* invWeightsSums, int count, const float* weights, int mapSize)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			int kBegin = Math::Max(0, mapSize - i), kEnd = Math::Min(2*mapSize, mapSize + count - 1 - i);
+
+			float sum = 0.0f;
+			for (int k = kBegin; k <= kEnd; k++)
+				sum += weights[k];
+
+			invWeightsSums[i] = sum > 0.0f ? 1.0f/sum : 0.0f;
+		}
+	}
+
+	// Blurs rows range horizontally with weights of kernel 2*mapSize + 1 pixels wide
+	static void BlurRowsHorizontal(const UInt8* src, UInt8* dst, int width, int bpp, int rowBegin, int rowEnd,
+								   const float* weights, int mapSize, const float* invWeightsSums)
+	{
+		for (int y = rowBegin; y < rowEnd; y++)
+		{
+			const UInt8* srcRow = src + y*width*bpp;
+			UInt8* dstRow = dst + y*width*bpp;
+
+			for (int x = 0; x < width; x++)
+			{
+				int kBegin = Math::Max(0, mapSize - x), kEnd = Math::Min(2*mapSize, mapSize + width - 1 - x);
+				int firstSample = x - mapSize;
+
+#ifdef BITMAP_SSE
+				if (bpp == 4)
+				{
+					__m128 sum = _mm_setzero_ps();
+					for (int k = kBegin; k <= kEnd; k++)
+						sum = _mm_add_ps(sum, _mm_mul_ps(LoadBytes(srcRow + (firstSample + k)*4), _mm_set1_ps(weights[k])));
+
+					StoreBytes(dstRow + x*4, _mm_mul_ps(sum, _mm_set1_ps(invWeightsSums[x])));
+					continue;
+				}
+#endif
+
+				for (int c = 0; c < bpp; c++)
+				{
+					float sum = 0.0f;
+					for (int k = kBegin; k <= kEnd; k++)
+						sum += weights[k]*(float)srcRow[(firstSample + k)*bpp + c];
+
+					dstRow[x*bpp + c] = (UInt8)(sum*invWeightsSums[x] + 0.5f);
+				}
+			}
+		}
+	}
+
+	// Blurs rows range vertically with weights of kernel 2*mapSize + 1 pixels high
+	static void BlurRowsVertical(const UInt8* src, UInt8* dst, int rowBytes, int height, int rowBegin, int rowEnd,
+								 const float* weights, int mapSize, const float* invWeightsSums)
+	{
+		for (int y = rowBegin; y < rowEnd; y++)
+		{
+			int kBegin = Math::Max(0, mapSize - y), kEnd = Math::Min(2*mapSize, mapSize + height - 1 - y);
+			int firstSample = y - mapSize;
+			UInt8* dstRow = dst + y*rowBytes;
+			int i = 0;
+
+#ifdef BITMAP_SSE
+			__m128 invWeightsSum = _mm_set1_ps(invWeightsSums[y]);
+
+			for (; i + 4 <= rowBytes; i += 4)
+			{
+				__m128 sum = _mm_setzero_ps();
+				for (int k = kBegin; k <= kEnd; k++)
+					sum = _mm_add_ps(sum, _mm_mul_ps(LoadBytes(src + (firstSample + k)*rowBytes + i), _mm_set1_ps(weights[k])));
+
+				StoreBytes(dstRow + i, _mm_mul_ps(sum, invWeightsSum));
+			}
+#endif
+
+			for (; i < rowBytes; i++)
+			{
+				float sum = 0.0f;
+				for (int k = kBegin; k <= kEnd; k++)
+					sum += weights[k]*(float)src[(firstSample + k)*rowBytes + i];
+
+				dstRow[i] = (UInt8)(sum*invWeightsSums[y] + 0.5f);
+			}
+		}
+	}
+
 	Bitmap::Bitmap():
 		mFormat(PixelFormat::R8G8B8A8), mData(nullptr)
 	{}
@@ -26,7 +348,7 @@ namespace o2
 	Bitmap::Bitmap(const Bitmap& other):
 		data(this), size(this), format(this)
 	{
-		short bpp[] ={ 4, 3 };
+		short bpp[] ={ 4, 3, 1 };
 
 		mFormat = other.mFormat;
 		mSize = other.mSize;
@@ -47,7 +369,7 @@ namespace o2
 		if (mData)
 			delete[] mData;
 
-		short bpp[] ={ 4, 3 };
+		short bpp[] ={ 4, 3, 1 };
 
 		mFormat = other.mFormat;
 		mSize = other.mSize;
@@ -69,7 +391,7 @@ namespace o2
 		if (mData)
 			delete[] mData;
 
-		short bpp[] ={ 4, 3 };
+		short bpp[] ={ 4, 3, 1 };
 
 		mFormat = format;
 		mSize = size;
@@ -96,11 +418,12 @@ namespace o2
 		return false;
 	}
 
-	bool Bitmap::Save(const String& fileName, ImageType type) const
+	bool Bitmap::Save(const String& fileName, ImageType type,
+					  PngCompression compression /*= PngCompression::Default*/) const
 	{
 		if (type == ImageType::Png || type == ImageType::Auto)
 		{
-			return SavePngImage(fileName, this);
+			return SavePngImage(fileName, this, compression);
 		}
 
 		o2Debug.LogError("Can't save image to '" + fileName + "': unknown format specified");
@@ -148,25 +471,20 @@ namespace o2
 		if (imgSrcRect.Width() == 0)
 			imgSrcRect.Set(Vec2I(), img->GetSize());
 
-		int bpp[] ={ 4, 3 };
-		int curbpp = bpp[(int)mFormat];
-		int pixelSize = curbpp;
-
-		for (int x = 0; x < imgSrcRect.right - imgSrcRect.left; x++)
-		{
-			if (x + position.x >= mSize.x)
-				break;
+		Vec2I begin, end;
+		if (!ClipImageRect(mSize, img->mSize, position, imgSrcRect, begin, end))
+			return;
 
-			for (int y = 0; y < imgSrcRect.top - imgSrcRect.bottom; y++)
-			{
-				if (y + position.y >= mSize.y)
-					break;
+		int bpp[] ={ 4, 3, 1 };
+		int pixelSize = bpp[(int)mFormat];
+		int rowSize = (end.x - begin.x)*pixelSize;
 
-				UInt srcIdx = (img->mSize.y - (y + imgSrcRect.bottom) - 1)*img->mSize.x + x + imgSrcRect.left;
-				UInt dstIdx = (mSize.y - 1 - (y + position.y))*mSize.x + x + position.x;
+		for (int y = begin.y; y < end.y; y++)
+		{
+			UInt srcIdx = (img->mSize.y - (y + imgSrcRect.bottom) - 1)*img->mSize.x + begin.x + imgSrcRect.left;
+			UInt dstIdx = (mSize.y - 1 - (y + position.y))*mSize.x + begin.x + position.x;
 
-                *(int*)&mData[dstIdx*pixelSize] = *(int*)&img->mData[srcIdx*pixelSize];
-			}
+			memcpy(mData + dstIdx*pixelSize, img->mData + srcIdx*pixelSize, rowSize);
 		}
 	}
 
@@ -180,53 +498,51 @@ namespace o2
 		if (imgSrcRect.Width() == 0)
 			imgSrcRect.Set(Vec2I(), img->GetSize());
 
-		int bpp[] ={ 4, 3 };
-		int curbpp = bpp[(int)mFormat];
-		int pixelSize = curbpp;
+		Vec2I begin, end;
+		if (!ClipImageRect(mSize, img->mSize, position, imgSrcRect, begin, end))
+			return;
 
-		for (int x = 0; x < imgSrcRect.right - imgSrcRect.left; x++)
-		{
-			if (x + position.x >= mSize.x)
-				break;
+		int bpp[] ={ 4, 3, 1 };
+		int pixelSize = bpp[(int)mFormat];
 
-			for (int y = 0; y < imgSrcRect.top - imgSrcRect.bottom; y++)
+		ProcessRows(end.y - begin.y, end.x - begin.x, [&](int rowBegin, int rowEnd)
+		{
+			for (int y = begin.y + rowBegin; y < begin.y + rowEnd; y++)
 			{
-				if (y + position.y >= mSize.y)
-					break;
-
-				UInt srcIdx = (img->mSize.y - (y + imgSrcRect.bottom) - 1)*img->mSize.x + x + imgSrcRect.left;
-				UInt dstIdx = (mSize.y - 1 - (y + position.y))*mSize.x + x + position.x;
-
-				Color4 srcColor, src1Color;
-				srcColor.SetABGR(*(ULong*)(mData + dstIdx*pixelSize));
-				src1Color.SetABGR(*(ULong*)(img->mData + srcIdx*pixelSize));
+				UInt srcIdx = (img->mSize.y - (y + imgSrcRect.bottom) - 1)*img->mSize.x + begin.x + imgSrcRect.left;
+				UInt dstIdx = (mSize.y - 1 - (y + position.y))*mSize.x + begin.x + position.x;
 
-				Color4 resColor = srcColor.BlendByAlpha(src1Color);
-				ULong uresColor = resColor.ABGR();
-
-				memcpy(mData + dstIdx*pixelSize, &uresColor, pixelSize);
+				BlendPixels(mData + dstIdx*pixelSize, img->mData + srcIdx*pixelSize, end.x - begin.x, pixelSize);
 			}
-		}
+		});
 	}
 
 	void Bitmap::Colorise(const Color4& color)
 	{
-		int bpp[] ={ 4, 3 };
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
-		for (int x = 0; x < mSize.x*mSize.y; x++)
+		ProcessRows(mSize.y, mSize.x, [&](int rowBegin, int rowEnd)
 		{
-			Color4 c;
-			c.SetABGR(*(ULong*)(mData + x*curbpp));
-			c *= color;
-			*(ULong*)(mData + x*curbpp) = c.ABGR();
-		}
+			ColorisePixels(mData + rowBegin*mSize.x*curbpp, (rowEnd - rowBegin)*mSize.x, curbpp, color);
+		});
+	}
+
+	void Bitmap::PremultiplyAlpha()
+	{
+		if (mFormat != PixelFormat::R8G8B8A8)
+			return;
+
+		ProcessRows(mSize.y, mSize.x, [&](int rowBegin, int rowEnd)
+		{
+			PremultiplyPixels(mData + rowBegin*mSize.x*4, (rowEnd - rowBegin)*mSize.x);
+		});
 	}
 
 	void Bitmap::GradientByAlpha(const Color4& color1, const Color4& color4, float angle /*= 0*/, float size /*= 0*/,
 								 Vec2F origin /*= Vec2F()*/)
 	{
-		int bpp[] ={ 4, 3 };
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		Vec2F dir = Vec2F::Rotated(Math::Deg2rad(angle + 90.0f));
@@ -236,28 +552,38 @@ namespace o2
 		float invSize = 1.0f / size;
 
 		Vec2F pxorigin = origin*(Vec2F)mSize;
+		Color4 delta = color4 - color1;
 
-		for (int x = 0; x < mSize.x; x++)
+		ProcessRows(mSize.y, mSize.x, [&](int rowBegin, int rowEnd)
 		{
-			for (int y = 0; y < mSize.y; y++)
+			for (int y = rowBegin; y < rowEnd; y++)
 			{
-				Vec2F p = Vec2F((float)x, (float)y) - pxorigin;
-				float proj = p.Dot(dir);
-				float coef = Math::Clamp01(proj*invSize);
-				ULong offs = (y*mSize.x + x)*curbpp;
-
-				Color4 c;
-				c.SetABGR(*(ULong*)(mData + offs));
-				c *= Math::Lerp(color1, color4, coef);
-				*(ULong*)(mData + offs) = c.ABGR();
+				for (int x = 0; x < mSize.x; x++)
+				{
+					Vec2F p = Vec2F((float)x, (float)y) - pxorigin;
+					float proj = p.Dot(dir);
+					float coef = Math::Clamp01(proj*invSize);
+					UInt8* pixel = mData + (y*mSize.x + x)*curbpp;
+
+					// Same integer math as Math::Lerp() of colors and colors multiplication
+					if (curbpp == 4)
+					{
+						pixel[0] = (UInt8)(pixel[0]*((int)((float)delta.r*coef) + color1.r)/255);
+						pixel[1] = (UInt8)(pixel[1]*((int)((float)delta.g*coef) + color1.g)/255);
+						pixel[2] = (UInt8)(pixel[2]*((int)((float)delta.b*coef) + color1.b)/255);
+						pixel[3] = (UInt8)(pixel[3]*((int)((float)delta.a*coef) + color1.a)/255);
+					}
+					else
+						StorePixel(pixel, curbpp, LoadPixel(pixel, curbpp)*(delta*coef + color1));
+				}
 			}
-		}
+		});
 	}
 
 	void Bitmap::Fill(const Color4& color)
 	{
 		unsigned long colrDw = color.ARGB();
-		int bpp[] ={ 4, 3 };
+		int bpp[] ={ 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		for (int x = 0; x < mSize.x*mSize.y; x++)
@@ -267,7 +593,7 @@ namespace o2
 	void Bitmap::FillRect(int rtLeft, int rtTop, int rtRight, int rtBottom, const Color4& color)
 	{
 		unsigned long colrDw = color.ARGB();
-		int bpp[] = { 4, 3 };
+		int bpp[] = { 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
 		for (int x = Math::Max(rtLeft, 0); x < Math::Min(mSize.x, rtRight); x++)
@@ -280,135 +606,122 @@ namespace o2
 	void Bitmap::Blur(float radius)
 	{
 		int mapSize = Math::CeilToInt(radius);
-		int fullmapSize = mapSize * 2 + 1;
+		if (mapSize <= 0 || !mData)
+			return;
 
-		float** weightMap = mnew float*[fullmapSize];
+		// Radial cone kernel is approximated by separable one with same marginal weights, so blur is performed by
+		// horizontal and vertical passes
+		int fullmapSize = mapSize*2 + 1;
+		float* weights = mnew float[fullmapSize];
 		for (int i = 0; i < fullmapSize; i++)
 		{
-			weightMap[i] = mnew float[fullmapSize];
+			weights[i] = 0.0f;
 
 			for (int j = 0; j < fullmapSize; j++)
 			{
 				float x = (float)(i - mapSize), y = (float)(j - mapSize);
-				float dst = Math::Sqrt(x*x + y*y);
-				weightMap[i][j] = Math::Clamp01(1.0f - dst / radius);
+				weights[i] += Math::Clamp01(1.0f - Math::Sqrt(x*x + y*y)/radius);
 			}
 		}
 
-		int bpp[] = { 4, 3 };
+		float* invWeightsSumsX = mnew float[mSize.x];
+		float* invWeightsSumsY = mnew float[mSize.y];
+		InitBlurWeightsSums(invWeightsSumsX, mSize.x, weights, mapSize);
+		InitBlurWeightsSums(invWeightsSumsY, mSize.y, weights, mapSize);
+
+		int bpp[] = { 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
-		UInt8* srcData = mnew UInt8[mSize.x*mSize.y*curbpp];
-		memcpy(srcData, mData, mSize.x*mSize.y*curbpp);
+		UInt8* tempData = mnew UInt8[mSize.x*mSize.y*curbpp];
 
-		for (int x = 0; x < mSize.x; x++)
+		ProcessRows(mSize.y, mSize.x*mapSize, [&](int rowBegin, int rowEnd)
 		{
-			for (int y = 0; y < mSize.y; y++)
-			{
-				Color4 c;
-				Color4 csum(0, 0, 0, 0);
-				float wSum = 0;
-
-				for (int ox = 0; ox < fullmapSize; ox++)
-				{
-					for (int oy = 0; oy < fullmapSize; oy++)
-					{
-						int cx = x + (ox - mapSize), cy = y + (oy - mapSize);
-
-						if (cx < 0 || cx >= mSize.x || cy < 0 || cy >= mSize.y)
-							continue;
+			BlurRowsHorizontal(mData, tempData, mSize.x, curbpp, rowBegin, rowEnd, weights, mapSize, invWeightsSumsX);
+		});
 
-						c.SetARGB(*(ULong*)&srcData[(cy*mSize.x + cx)*curbpp]);
-						float w = weightMap[ox][oy];
-						csum += c*w;
-						wSum += w;
-					}
-				}
-
-				csum /= wSum;
-				ULong ucsum = csum.ARGB();
-				memcpy(&mData[(y*mSize.x + x)*curbpp], &ucsum, curbpp);
-			}
-		}
-
-		for (int i = 0; i < fullmapSize; i++)
-			delete[] weightMap[i];
+		ProcessRows(mSize.y, mSize.x*mapSize, [&](int rowBegin, int rowEnd)
+		{
+			BlurRowsVertical(tempData, mData, mSize.x*curbpp, mSize.y, rowBegin, rowEnd, weights, mapSize, invWeightsSumsY);
+		});
 
-		delete[] weightMap;
-		delete[] srcData;
+		delete[] weights;
+		delete[] invWeightsSumsX;
+		delete[] invWeightsSumsY;
+		delete[] tempData;
 	}
 
 	void Bitmap::Outline(float radius, const Color4& color, int threshold /*= 100*/)
 	{
 		int mapSize = Math::CeilToInt(radius);
-		int fullmapSize = mapSize * 2 + 1;
 		int alphaThreshold = threshold;
-		int radiusSquare = Math::Sqr(Math::FloorToInt(radius));
 
-		int bpp[] = { 4, 3 };
+		int bpp[] = { 4, 3, 1 };
 		int curbpp = bpp[(int)mFormat];
 
-		UInt8* srcData = mnew UInt8[mSize.x*mSize.y*curbpp];
-		memcpy(srcData, mData, mSize.x*mSize.y*curbpp);
+		// Pixel is outlined by mean squared distance to opaque pixels in square around it. Window sums are
+		// separable: first pass counts opaque pixels and sums their squared offsets in rows, second sums rows
+		int* rowCounts = mnew int[mSize.x*mSize.y];
+		int* rowSqrOffsets = mnew int[mSize.x*mSize.y];
 
-		for (int x = 0; x < mSize.x; x++)
+		ProcessRows(mSize.y, mSize.x*mapSize, [&](int rowBegin, int rowEnd)
 		{
-			for (int y = 0; y < mSize.y; y++)
+			for (int y = rowBegin; y < rowEnd; y++)
 			{
-				float sqrDist = 0;
-				int count = 0;
-				Color4 pc;
-				UInt offs = (y*mSize.x + x)*curbpp;
-				pc.SetABGR(*(ULong*)&srcData[offs]);
+				const UInt8* row = mData + y*mSize.x*curbpp;
 
-				for (int ox = 0; ox < fullmapSize; ox++)
+				for (int x = 0; x < mSize.x; x++)
 				{
-					for (int oy = 0; oy < fullmapSize; oy++)
-					{
-						int fx = ox - mapSize, fy = oy - mapSize;
-						int cx = x + (ox - mapSize), cy = y + (oy - mapSize);
+					int count = 0, sqrOffsets = 0;
+					int fxBegin = Math::Max(-mapSize, -x), fxEnd = Math::Min(mapSize, mSize.x - 1 - x);
 
-						if (cx < 0 || cx >= mSize.x || cy < 0 || cy >= mSize.y)
-							continue;
-
-						Color4 c;
-						c.SetABGR(*(ULong*)&srcData[(cy*mSize.x + cx)*curbpp]);
-						if (c.a > alphaThreshold)
+					for (int fx = fxBegin; fx <= fxEnd; fx++)
+					{
+						if (GetPixelAlpha(row + (x + fx)*curbpp, curbpp) > alphaThreshold)
 						{
-							int dst = fx*fx + fy*fy;
-							sqrDist += dst;
 							count++;
+							sqrOffsets += fx*fx;
 						}
 					}
+
+					rowCounts[y*mSize.x + x] = count;
+					rowSqrOffsets[y*mSize.x + x] = sqrOffsets;
 				}
+			}
+		});
 
-				sqrDist /= (float)count;
+		ProcessRows(mSize.y, mSize.x*mapSize, [&](int rowBegin, int rowEnd)
+		{
+			for (int y = rowBegin; y < rowEnd; y++)
+			{
+				int fyBegin = Math::Max(-mapSize, -y), fyEnd = Math::Min(mapSize, mSize.y - 1 - y);
 
-				if (sqrDist < radiusSquare - 2 && false)
+				for (int x = 0; x < mSize.x; x++)
 				{
-					Color4 newColor = pc.BlendByAlpha(color);
-					ULong unewColor = newColor.ABGR();
-					memcpy(&mData[offs], &unewColor, curbpp);
+					int count = 0, sqrOffsets = 0;
 
-				}
-				else
-				{
-					float distance = Math::Sqrt((float)sqrDist);
+					for (int fy = fyBegin; fy <= fyEnd; fy++)
+					{
+						int idx = (y + fy)*mSize.x + x;
+						count += rowCounts[idx];
+						sqrOffsets += rowSqrOffsets[idx] + fy*fy*rowCounts[idx];
+					}
+
+					if (count == 0)
+						continue;
+
+					float sqrDist = (float)sqrOffsets/(float)count;
+					float distance = Math::Sqrt(sqrDist);
 
 					if (distance < radius + 1.0f)
 					{
-						float alpha = 1.0f - (distance - radius);
-
-						Color4 newColor = color;
-						newColor.a = (int)((float)newColor.a*alpha);
-						newColor = pc.BlendByAlpha(color);
-						ULong unewColor = newColor.ABGR();
-						memcpy(&mData[offs], &unewColor, curbpp);
+						UInt8* pixel = mData + (y*mSize.x + x)*curbpp;
+						StorePixel(pixel, curbpp, LoadPixel(pixel, curbpp).BlendByAlpha(color));
 					}
 				}
 			}
-		}
+		});
 
-		delete[] srcData;
+		delete[] rowCounts;
+		delete[] rowSqrOffsets;
 	}
 }
 
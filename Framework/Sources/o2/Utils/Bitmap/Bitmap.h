@@ -1,6 +1,7 @@
 #pragma once
 
 #include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Bitmap/PngFormat.h"
 #include "o2/Utils/Math/Vector2.h"
 
 #include "o2/Utils/Property.h"
@@ -51,7 +52,7 @@ namespace o2
 		bool Load(const String& fileName, ImageType type = ImageType::Auto);
 
 		// Saving image to file
-		bool Save(const String& fileName, ImageType type) const;
+		bool Save(const String& fileName, ImageType type, PngCompression compression = PngCompression::Default) const;
 
 		// Clearing image with color
 		void Clear(const Color4& color);
@@ -80,6 +81,9 @@ namespace o2
 		// Sets images pixels colors
 		void Colorise(const Color4& color);
 
+		// Multiplies pixels colors by their alpha. Works only with R8G8B8A8 format
+		void PremultiplyAlpha();
+
 		// Sets image pixels by gradient
 		void GradientByAlpha(const Color4& color1, const Color4& color4, float angle = 0, float size = 0,
 							 Vec2F origin = Vec2F());
@@ -90,7 +94,7 @@ namespace o2
 		// Fills rect with color
 		void FillRect(int rtLeft, int rtTop, int rtRight, int rtBottom, const Color4& color);
 
-		// Apply blur effect
+		// Apply blur effect. Radial blur kernel is approximated by separable one
 		void Blur(float radius);
 
 		// Apply outline effect
@@ -5,17 +5,30 @@
 #include "o2/Utils/Debug/Debug.h"
 #include "o2/Utils/FileSystem/File.h"
 #include "o2/Utils/Bitmap/Bitmap.h"
+#include "o2/Utils/Tasks/WorkersPool.h"
 
 namespace o2
 {
+	// Size of buffer for compressed data, which is written into file at once
+	static const int compressionBufferSize = 64*1024;
+
+	// PNG data reading state
+	struct PngReadBuffer
+	{
+		const UInt8* data;     // PNG data
+		UInt         size;     // Size of data
+		UInt         position; // Reading position
+	};
+
 	void CustomPngReadFn(png_structp png_ptr, png_bytep outBytes, png_size_t byteCountToRead)
 	{
-		void* io_ptr = png_get_io_ptr(png_ptr);
-		if (io_ptr == NULL) return;
+		PngReadBuffer* buffer = (PngReadBuffer*)png_get_io_ptr(png_ptr);
 
-		InFile* file = (InFile*)io_ptr;
+		if (buffer->size - buffer->position < byteCountToRead)
+			png_error(png_ptr, "Unexpected end of data");
 
-		file->ReadData(outBytes, byteCountToRead);
+		memcpy(outBytes, buffer->data + buffer->position, byteCountToRead);
+		buffer->position += (UInt)byteCountToRead;
 	}
 
 	void CustomPngWriteFn(png_structp png_ptr, png_bytep bytes, png_size_t byteCountToWrite)
@@ -30,140 +43,200 @@ namespace o2
 
 	void CustomPngFlushFn(png_structp png_ptr) {}
 
+	// Reads whole file into buffer allocated with mnew. Returns null when file can't be read
+	static UInt8* ReadPngFile(const String& fileName, UInt& dataSize)
+	{
+		InFile file(fileName);
+		if (!file.IsOpened())
+			return nullptr;
+
+		dataSize = file.GetDataSize();
+		UInt8* data = mnew UInt8[dataSize];
+		file.ReadData(data, dataSize);
+
+		return data;
+	}
+
 	bool LoadPngImage(const String& fileName, Bitmap* image, bool errors /*= true*/)
 	{
-		InFile pngImageFile(fileName);
-		if (!pngImageFile.IsOpened())
+		UInt dataSize = 0;
+		UInt8* data = ReadPngFile(fileName, dataSize);
+		if (!data)
 		{
-			if (errors) 
+			if (errors)
 				o2Debug.LogError("Can't load PNG file '" + fileName + "'");
 
 			return false;
 		}
 
-		//header for testing if it is a png
-		png_byte header[8];
-
-		//read the header
-		pngImageFile.ReadData(header, 8);
-
-		//test if png
-		int is_png = !png_sig_cmp(header, 0, 8);
-		if (!is_png)
+		Vec2I size;
+		if (!ReadPngImageSize(data, dataSize, size))
 		{
-			if (errors) 
+			delete[] data;
+
+			if (errors)
 				o2Debug.LogError("Can't load PNG file '" + fileName + "': not PNG");
+
 			return false;
 		}
 
-		//create png struct
+		image->Create(PixelFormat::R8G8B8A8, size);
+		bool decoded = DecodePngImage(data, dataSize, image->GetData(), size);
+		delete[] data;
+
+		if (!decoded && errors)
+			o2Debug.LogError("Can't load PNG file '" + fileName + "': decoding error");
+
+		return decoded;
+	}
+
+	Vector<Bitmap*> LoadPngImages(const Vector<String>& fileNames, bool errors /*= true*/)
+	{
+		// -----------------------------------------------------------------------------------------
+		// Image decoding job. Data is read and bitmap is created on current thread, so workers only
+		// decode data into bitmap pixels
+		// -----------------------------------------------------------------------------------------
+		struct DecodeJob
+		{
+			UInt8*  data = nullptr;   // PNG file data
+			UInt    dataSize = 0;     // Size of data
+			Bitmap* bitmap = nullptr; // Decoding bitmap
+			bool    decoded = false;  // Is bitmap decoded successfully
+		};
+
+		Vector<DecodeJob> jobs;
+		jobs.Reserve(fileNames.Count());
+
+		for (auto& fileName : fileNames)
+		{
+			DecodeJob job;
+			job.data = ReadPngFile(fileName, job.dataSize);
+
+			Vec2I size;
+			if (job.data && ReadPngImageSize(job.data, job.dataSize, size))
+				job.bitmap = mnew Bitmap(PixelFormat::R8G8B8A8, size);
+
+			jobs.Add(job);
+		}
+
+		o2Workers.Run(jobs.Count(), [&](int index, int threadIndex)
+		{
+			DecodeJob& job = jobs[index];
+			if (job.bitmap)
+				job.decoded = DecodePngImage(job.data, job.dataSize, job.bitmap->GetData(), job.bitmap->GetSize());
+		});
+
+		Vector<Bitmap*> result;
+		result.Reserve(jobs.Count());
+
+		for (int i = 0; i < jobs.Count(); i++)
+		{
+			DecodeJob& job = jobs[i];
+			delete[] job.data;
+
+			if (!job.decoded)
+			{
+				delete job.bitmap;
+				job.bitmap = nullptr;
+
+				if (errors)
+					o2Debug.LogError("Can't load PNG file '" + fileNames[i] + "'");
+			}
+
+			result.Add(job.bitmap);
+		}
+
+		return result;
+	}
+
+	bool ReadPngImageSize(const UInt8* data, UInt dataSize, Vec2I& size)
+	{
+		// Signature is followed by IHDR chunk: length, type, big-endian width and height
+		if (dataSize < 24 || png_sig_cmp((png_bytep)data, 0, 8) != 0 || memcmp(data + 12, "IHDR", 4) != 0)
+			return false;
+
+		png_uint_32 width = png_get_uint_32((png_bytep)data + 16);
+		png_uint_32 height = png_get_uint_32((png_bytep)data + 20);
+
+		if (width == 0 || height == 0 || width > PNG_UINT_31_MAX || height > PNG_UINT_31_MAX)
+			return false;
+
+		size = Vec2I((int)width, (int)height);
+		return true;
+	}
+
+	bool DecodePngImage(const UInt8* data, UInt dataSize, UInt8* pixels, const Vec2I& size)
+	{
 		png_structp png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 		if (!png_ptr)
-		{
-			if (errors) 
-				o2Debug.LogError("Can't load PNG file '" + fileName + "': TEXTURE_LOAD_ERROR");
 			return false;
-		}
 
-		//create png info struct
 		png_infop info_ptr = png_create_info_struct(png_ptr);
 		if (!info_ptr)
 		{
 			png_destroy_read_struct(&png_ptr, (png_infopp)NULL, (png_infopp)NULL);
-
-			if (errors) 
-				o2Debug.LogError("Can't load PNG file '" + fileName + "': TEXTURE_LOAD_ERROR");
 			return false;
 		}
 
-		//create png info struct
-		png_infop end_info = png_create_info_struct(png_ptr);
-		if (!end_info)
+		if (setjmp(png_jmpbuf(png_ptr)))
 		{
 			png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
-
-			if (errors) 
-				o2Debug.LogError("Can't load PNG file '" + fileName + "': TEXTURE_LOAD_ERROR");
 			return false;
 		}
 
-		//png error stuff, not sure libpng man suggests this.
-		if (setjmp(png_jmpbuf(png_ptr)))
-		{
-			png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
+		PngReadBuffer buffer = { data, dataSize, 0 };
+		png_set_read_fn(png_ptr, &buffer, CustomPngReadFn);
 
-			if (errors) 
-				o2Debug.LogError("Can't load PNG file '" + fileName + "': TEXTURE_LOAD_ERROR");
-			return false;
-		}
+		png_read_info(png_ptr, info_ptr);
 
-		//init png reading
-		png_set_read_fn(png_ptr, &pngImageFile, CustomPngReadFn);
+		png_uint_32 width, height;
+		int bit_depth, color_type;
+		png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, NULL, NULL, NULL);
 
-		//png_init_io(png_ptr, fp);
+		if ((int)width != size.x || (int)height != size.y)
+			png_error(png_ptr, "Image size doesn't match");
 
-		//let libpng know you already read the first 8 bytes
-		png_set_sig_bytes(png_ptr, 8);
+		// Convert any format into 8 bit RGBA
+		bool transparent = png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS) != 0;
 
-		// read all the info up to the image data
-		png_read_info(png_ptr, info_ptr);
+		if (color_type == PNG_COLOR_TYPE_PALETTE)
+			png_set_palette_to_rgb(png_ptr);
 
-		//variables to pass to get info
-		int bit_depth, color_type;
-		png_uint_32 twidth, theight;
+		if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
+			png_set_expand_gray_1_2_4_to_8(png_ptr);
 
-		// get info about png
-		png_get_IHDR(png_ptr, info_ptr, &twidth, &theight, &bit_depth, &color_type, NULL, NULL, NULL);
+		if (transparent)
+			png_set_tRNS_to_alpha(png_ptr);
 
-		// Update the png info struct.
-		png_read_update_info(png_ptr, info_ptr);
+		if (bit_depth == 16)
+			png_set_strip_16(png_ptr);
 
-		// Row size in bytes.
-		int rowbytes = png_get_rowbytes(png_ptr, info_ptr);
+		if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA)
+			png_set_gray_to_rgb(png_ptr);
 
-		// Allocate the image_data as a big block, to be given to opengl
-		image->Create(PixelFormat::R8G8B8A8, Vec2I(twidth, theight));
-		png_byte *image_data = image->GetData();
-		if (!image_data)
-		{
-			//clean up memory and close stuff
-			png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
+		if ((color_type & PNG_COLOR_MASK_ALPHA) == 0 && !transparent)
+			png_set_filler(png_ptr, 0xFF, PNG_FILLER_AFTER);
 
-			if (errors) 
-				o2Debug.LogError("Can't load PNG file '" + fileName + "': TEXTURE_LOAD_ERROR");
-			return false;
-		}
+		int passes = png_set_interlace_handling(png_ptr);
+		png_read_update_info(png_ptr, info_ptr);
 
-		//row_pointers is for pointing to image_data for reading the png with libpng
-		png_bytep *row_pointers = new png_bytep[theight];
-		if (!row_pointers)
-		{
-			//clean up memory and close stuff
-			png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
-			if (image_data)
-				delete[] image_data;
+		png_uint_32 rowbytes = (png_uint_32)png_get_rowbytes(png_ptr, info_ptr);
+		if (rowbytes != width*4)
+			png_error(png_ptr, "Unsupported pixel format");
 
-			if (errors) 
-				o2Debug.LogError("Can't load PNG file '" + fileName + "': TEXTURE_LOAD_ERROR");
-			return false;
+		// Rows are decoded right into pixels without row pointers, interlaced passes are combined by libpng
+		for (int pass = 0; pass < passes; pass++)
+		{
+			for (png_uint_32 y = 0; y < height; y++)
+				png_read_row(png_ptr, pixels + (height - 1 - y)*rowbytes, NULL);
 		}
 
-		// set the individual row_pointers to point at the correct offsets of image_data
-		for (int i = 0; i < (int)theight; ++i)
-			row_pointers[theight - 1 - i] = image_data + i * rowbytes;
-
-		//read the png into image_data through row_pointers
-		png_read_image(png_ptr, row_pointers);
-
-		//clean up memory and close stuff
-		png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
-		if (row_pointers)
-			delete[] row_pointers;
+		png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp)NULL);
 
 		return true;
 	}
 
-	bool SavePngImage(const String& fileName, const Bitmap* image)
+	bool SavePngImage(const String& fileName, const Bitmap* image, PngCompression compression /*= PngCompression::Default*/)
 	{
 		OutFile pngImageFile(fileName);
 		if (!pngImageFile.IsOpened())
@@ -172,82 +245,90 @@ namespace o2
 			return false;
 		}
 
-		png_structp png_ptr;
-		png_infop info_ptr;
-
-		/* initialize stuff */
-		png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-
+		png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
 		if (!png_ptr)
 		{
 			o2Debug.LogError("Can't save PNG file '" + fileName + "': png_create_write_struct failed");
 			return false;
 		}
 
-		info_ptr = png_create_info_struct(png_ptr);
+		png_infop info_ptr = png_create_info_struct(png_ptr);
 		if (!info_ptr)
 		{
+			png_destroy_write_struct(&png_ptr, (png_infopp)NULL);
+
 			o2Debug.LogError("Can't save PNG file '" + fileName + "': png_create_info_struct failed");
 			return false;
 		}
 
+		// R8 image is alpha of white color, as in fonts glyphs. It is saved as gray with alpha, so it is loaded back
+		// into same white R8G8B8A8 image. Row buffer is allocated before setjmp, so it is freed on encoding error
+		png_uint_32 width = (png_uint_32)image->GetSize().x, height = (png_uint_32)image->GetSize().y;
+		bool isAlphaImage = image->GetFormat() == PixelFormat::R8;
+		UInt8* alphaRow = isAlphaImage ? mnew UInt8[width*2] : nullptr;
+
 		if (setjmp(png_jmpbuf(png_ptr)))
 		{
-			o2Debug.LogError("Can't save PNG file '" + fileName + "': Error during init_io");
+			delete[] alphaRow;
+			png_destroy_write_struct(&png_ptr, &info_ptr);
+
+			o2Debug.LogError("Can't save PNG file '" + fileName + "': encoding error");
 			return false;
 		}
 
-		//png_init_io(png_ptr, fp);
-
 		png_set_write_fn(png_ptr, &pngImageFile, CustomPngWriteFn, CustomPngFlushFn);
+		png_set_compression_buffer_size(png_ptr, compressionBufferSize);
 
-		/* write header */
-		if (setjmp(png_jmpbuf(png_ptr)))
+		// Fast compression uses cheap sub filter, which suits most images, instead of trying all filters for each row
+		if (compression == PngCompression::None)
 		{
-			o2Debug.LogError("Can't save PNG file '" + fileName + "': Error during writing header");
-			return false;
+			png_set_compression_level(png_ptr, 0);
+			png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_NONE);
+		}
+		else if (compression == PngCompression::Fast)
+		{
+			png_set_compression_level(png_ptr, 1);
+			png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+		}
+		else if (compression == PngCompression::Best)
+		{
+			png_set_compression_level(png_ptr, 9);
+			png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_ALL_FILTERS);
 		}
 
-		png_byte bit_depth = 8, color_type = PNG_COLOR_TYPE_RGB_ALPHA;
+		int color_types[] = { PNG_COLOR_TYPE_RGB_ALPHA, PNG_COLOR_TYPE_RGB, PNG_COLOR_TYPE_GRAY_ALPHA };
 
-		png_set_IHDR(png_ptr, info_ptr, (unsigned int)image->GetSize().x, (unsigned int)image->GetSize().y,
-					 bit_depth, color_type, PNG_INTERLACE_NONE,
+		png_set_IHDR(png_ptr, info_ptr, width, height, 8, color_types[(int)image->GetFormat()], PNG_INTERLACE_NONE,
 					 PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
 
 		png_write_info(png_ptr, info_ptr);
 
-
-		/* write bytes */
-		if (setjmp(png_jmpbuf(png_ptr)))
+		// Rows are written right from image data from top to bottom, alpha image rows are expanded to white gray
+		if (isAlphaImage)
 		{
-			o2Debug.LogError("Can't save PNG file '" + fileName + "': Error during writing bytes");
-			return false;
-		}
-
-		// Row size in bytes.
-		int rowbytes = png_get_rowbytes(png_ptr, info_ptr);
-
-		png_bytep *row_pointers = new png_bytep[(unsigned int)image->GetSize().y];
+			for (png_uint_32 x = 0; x < width; x++)
+				alphaRow[x*2] = 255;
 
-		// set the individual row_pointers to point at the correct offsets of image_data
-		for (int i = 0; i < (int)image->GetSize().y; ++i)
-			row_pointers[(unsigned int)image->GetSize().y - 1 - i] = (png_bytep)image->getData() + i * rowbytes;
+			for (png_uint_32 y = 0; y < height; y++)
+			{
+				const UInt8* row = image->getData() + (height - 1 - y)*width;
+				for (png_uint_32 x = 0; x < width; x++)
+					alphaRow[x*2 + 1] = row[x];
 
-		png_write_image(png_ptr, row_pointers);
-
-		/* end write */
-		if (setjmp(png_jmpbuf(png_ptr)))
+				png_write_row(png_ptr, (png_bytep)alphaRow);
+			}
+		}
+		else
 		{
-			o2Debug.LogError("Can't save PNG file '" + fileName + "': Error during end of write");
-			return false;
+			png_uint_32 rowbytes = (png_uint_32)png_get_rowbytes(png_ptr, info_ptr);
+			for (png_uint_32 y = 0; y < height; y++)
+				png_write_row(png_ptr, (png_bytep)image->getData() + (height - 1 - y)*rowbytes);
 		}
 
 		png_write_end(png_ptr, NULL);
-
-		if (row_pointers)
-			delete[] row_pointers;
+		png_destroy_write_struct(&png_ptr, &info_ptr);
+		delete[] alphaRow;
 
 		return true;
 	}
-
 }
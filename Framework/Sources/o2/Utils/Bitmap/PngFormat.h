@@ -1,11 +1,31 @@
 #pragma once
 
+#include "o2/Utils/Math/Vector2.h"
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Vector.h"
 #include "o2/Utils/Types/String.h"
 
 namespace o2
 {
 	class Bitmap;
 
+	// PNG compression cost. Fast is for intermediate products, which are rebuilt often, Best is for shipping images
+	enum class PngCompression { None, Fast, Default, Best };
+
+	// Loads PNG file into R8G8B8A8 image. Palette, gray and 16 bit images are converted
 	bool LoadPngImage(const String& fileName, Bitmap* image, bool errors = true);
-	bool SavePngImage(const String& fileName, const Bitmap* image);
+
+	// Loads PNG files into R8G8B8A8 images. Files are read on current thread and decoded concurrently on shared pool
+	// workers. Returns images in files order, not loaded ones are null
+	Vector<Bitmap*> LoadPngImages(const Vector<String>& fileNames, bool errors = true);
+
+	// Reads image size from PNG data header. Returns false when data isn't PNG
+	bool ReadPngImageSize(const UInt8* data, UInt dataSize, Vec2I& size);
+
+	// Decodes PNG data directly into R8G8B8A8 pixels buffer with size from header. Rows are stored from bottom to top,
+	// as in Bitmap. Doesn't allocate engine memory and doesn't write log, so it can be called from any thread
+	bool DecodePngImage(const UInt8* data, UInt dataSize, UInt8* pixels, const Vec2I& size);
+
+	// Saves image into PNG file. R8 image is saved as white color with alpha
+	bool SavePngImage(const String& fileName, const Bitmap* image, PngCompression compression = PngCompression::Default);
 }
@@ -0,0 +1,332 @@
+#include "o2/stdafx.h"
+#include "Benchmark.h"
+
+#include "o2/Utils/Debug/Profiler.h"
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/Math/Math.h"
+#include "o2/Utils/Memory/MemoryManager.h"
+#include "o2/Utils/Serialization/DataValue.h"
+
+namespace o2
+{
+	BenchmarkContext::BenchmarkContext(int operations):
+		operations(operations)
+	{}
+
+	void BenchmarkContext::Begin()
+	{
+		MemoryManager::ResetPeakAllocatedBytes();
+		mBeginAllocations = MemoryManager::GetAllocationsCount();
+		mBeginTicks = Profiler::GetTicks();
+	}
+
+	void BenchmarkContext::End()
+	{
+		mDuration = Profiler::GetTicks() - mBeginTicks;
+		mAllocations = MemoryManager::GetAllocationsCount() - mBeginAllocations;
+		mPeakBytes = MemoryManager::GetPeakAllocatedBytes();
+		mMeasured = true;
+	}
+
+	void BenchmarkContext::Skip(const String& reason)
+	{
+		mSkipReason = reason;
+	}
+
+	bool BenchmarkContext::IsSkipped() const
+	{
+		return !mSkipReason.IsEmpty();
+	}
+
+	const String& BenchmarkContext::GetSkipReason() const
+	{
+		return mSkipReason;
+	}
+
+	void BenchmarkContext::Check(bool condition, const String& message)
+	{
+		if (!condition && mFailReason.IsEmpty())
+			mFailReason = message;
+	}
+
+	bool BenchmarkContext::IsFailed() const
+	{
+		return !mFailReason.IsEmpty();
+	}
+
+	const String& BenchmarkContext::GetFailReason() const
+	{
+		return mFailReason;
+	}
+
+	void BenchmarkContext::SetMetric(const String& name, double value)
+	{
+		mMetrics[name] = value;
+	}
+
+	const Map<String, double>& BenchmarkContext::GetMetrics() const
+	{
+		return mMetrics;
+	}
+
+	bool BenchmarkContext::IsMeasured() const
+	{
+		return mMeasured;
+	}
+
+	UInt64 BenchmarkContext::GetDuration() const
+	{
+		return mDuration;
+	}
+
+	UInt64 BenchmarkContext::GetAllocationsCount() const
+	{
+		return mAllocations;
+	}
+
+	UInt64 BenchmarkContext::GetPeakAllocatedBytes() const
+	{
+		return mPeakBytes;
+	}
+
+	void BenchmarksRunner::Register(const char* name, int operations, BenchmarkFunc func, bool headless /*= false*/)
+	{
+		GetBenchmarks().Add({ name, operations, func, headless });
+	}
+
+	Vector<String> BenchmarksRunner::GetBenchmarksNames(bool headlessOnly /*= false*/)
+	{
+		return GetBenchmarks().FindAll([&](const Benchmark& x) { return x.headless || !headlessOnly; })
+			.Convert<String>([](const Benchmark& x) { return String(x.name); });
+	}
+
+	Vector<BenchmarksRunner::Result> BenchmarksRunner::Run(const String& filter /*= ""*/, int runs /*= 5*/,
+														   bool headlessOnly /*= false*/)
+	{
+		Vector<Result> results;
+
+		auto benchmarks = GetBenchmarks();
+		benchmarks.Sort([](const Benchmark& a, const Benchmark& b) { return strcmp(a.name, b.name) < 0; });
+
+		for (auto& benchmark : benchmarks)
+		{
+			if (!String(benchmark.name).StartsWith(filter) || (headlessOnly && !benchmark.headless))
+				continue;
+
+			Result result;
+			result.name = benchmark.name;
+			result.operations = benchmark.operations;
+
+			BenchmarkContext warmUpContext(benchmark.operations);
+			RunOnce(benchmark, warmUpContext);
+
+			if (warmUpContext.IsSkipped() || !warmUpContext.IsMeasured())
+			{
+				result.skipped = true;
+				result.skipReason = warmUpContext.IsSkipped() ? warmUpContext.GetSkipReason() : String("not measured");
+				results.Add(result);
+				continue;
+			}
+
+			// Failed result isn't worth measuring
+			if (warmUpContext.IsFailed())
+			{
+				result.failed = true;
+				result.failReason = warmUpContext.GetFailReason();
+				results.Add(result);
+				continue;
+			}
+
+			Vector<double> durations;
+			UInt64 minAllocations = warmUpContext.GetAllocationsCount();
+			UInt64 maxPeakBytes = 0;
+
+			for (int i = 0; i < runs; i++)
+			{
+				BenchmarkContext context(benchmark.operations);
+				RunOnce(benchmark, context);
+
+				durations.Add((double)context.GetDuration()/(double)benchmark.operations);
+				minAllocations = Math::Min(minAllocations, context.GetAllocationsCount());
+				maxPeakBytes = Math::Max(maxPeakBytes, context.GetPeakAllocatedBytes());
+				result.metrics = context.GetMetrics();
+
+				if (context.IsFailed() && !result.failed)
+				{
+					result.failed = true;
+					result.failReason = context.GetFailReason();
+				}
+			}
+
+			durations.Sort();
+
+			result.runs = runs;
+			result.nsPerOperation = durations.IsEmpty() ? 0.0 : durations[durations.Count()/2];
+			result.minNsPerOperation = durations.IsEmpty() ? 0.0 : durations[0];
+			result.allocationsPerOperation = (double)minAllocations/(double)benchmark.operations;
+			result.peakAllocatedBytes = maxPeakBytes;
+
+			results.Add(result);
+		}
+
+		return results;
+	}
+
+	void BenchmarksRunner::PrintResults(const Vector<Result>& results)
+	{
+		if (!ENABLE_ALLOCATIONS_STATISTICS)
+			printf("Allocations statistics are disabled, allocs/op and peak KB aren't measured\n");
+
+		printf("%-48s %14s %14s %14s %14s\n", "Benchmark", "ns/op", "min ns/op", "allocs/op", "peak KB");
+
+		for (auto& result : results)
+		{
+			if (result.skipped)
+			{
+				printf("%-48s skipped: %s\n", result.name.Data(), result.skipReason.Data());
+				continue;
+			}
+
+			if (result.failed && result.runs == 0)
+			{
+				printf("%-48s FAILED: %s\n", result.name.Data(), result.failReason.Data());
+				continue;
+			}
+
+			printf("%-48s %14.1f %14.1f %14.2f %14.1f\n", result.name.Data(), result.nsPerOperation,
+				   result.minNsPerOperation, result.allocationsPerOperation, (double)result.peakAllocatedBytes/1024.0);
+
+			for (auto& metric : result.metrics)
+				printf("    %-44s %14.4f\n", metric.first.Data(), metric.second);
+
+			if (result.failed)
+				printf("    FAILED: %s\n", result.failReason.Data());
+		}
+	}
+
+	bool BenchmarksRunner::SaveResults(const Vector<Result>& results, const String& path)
+	{
+		DataDocument doc;
+		doc.AddMember("seed") = (UInt)randomSeed;
+		doc.AddMember("allocationsStatistics") = ENABLE_ALLOCATIONS_STATISTICS;
+
+		auto& benchmarksNode = doc.AddMember("benchmarks");
+		for (auto& result : results)
+		{
+			auto& node = benchmarksNode.AddElement();
+			node.AddMember("name") = result.name;
+			node.AddMember("operations") = result.operations;
+			node.AddMember("skipped") = result.skipped;
+			node.AddMember("failed") = result.failed;
+
+			if (result.failed)
+				node.AddMember("failReason") = result.failReason;
+
+			if (result.skipped)
+			{
+				node.AddMember("skipReason") = result.skipReason;
+				continue;
+			}
+
+			if (result.runs == 0)
+				continue;
+
+			node.AddMember("runs") = result.runs;
+			node.AddMember("nsPerOp") = result.nsPerOperation;
+			node.AddMember("minNsPerOp") = result.minNsPerOperation;
+			node.AddMember("allocationsPerOp") = result.allocationsPerOperation;
+			node.AddMember("peakAllocatedBytes") = result.peakAllocatedBytes;
+
+			if (!result.metrics.IsEmpty())
+			{
+				auto& metricsNode = node.AddMember("metrics");
+				for (auto& metric : result.metrics)
+					metricsNode.AddMember(metric.first.Data()) = metric.second;
+			}
+		}
+
+		String data = doc.SaveAsString();
+
+		OutFile file(path);
+		if (!file.IsOpened())
+			return false;
+
+		file.WriteData(data.Data(), data.Length());
+		return true;
+	}
+
+	int BenchmarksRunner::RunFromCommandLine(int argc, char** argv)
+	{
+		String filter, output;
+		int runs = 5;
+		bool headless = false;
+
+		for (int i = 1; i < argc; i++)
+		{
+			String arg = argv[i];
+			bool hasValue = i + 1 < argc;
+
+			if (arg == "-filter" && hasValue)
+				filter = argv[++i];
+			else if (arg == "-runs" && hasValue)
+				runs = Math::Max(1, (int)String(argv[++i]));
+			else if (arg == "-output" && hasValue)
+				output = argv[++i];
+			else if (arg == "-headless")
+				headless = true;
+			else if (arg == "-list")
+			{
+				for (auto& name : GetBenchmarksNames(IsHeadless(argc, argv)))
+					printf("%s\n", name.Data());
+
+				return 0;
+			}
+			else
+			{
+				printf("Unknown argument %s. Usage: -filter <name prefix> -runs <count> -output <json path> -list -headless\n", argv[i]);
+				return 1;
+			}
+		}
+
+		auto results = Run(filter, runs, headless);
+		PrintResults(results);
+
+		if (!output.IsEmpty() && !SaveResults(results, output))
+		{
+			printf("Can't save results into %s\n", output.Data());
+			return 1;
+		}
+
+		int failedCount = results.Count([](const Result& x) { return x.failed; });
+		if (failedCount > 0)
+		{
+			printf("%d benchmarks failed checks\n", failedCount);
+			return 1;
+		}
+
+		return 0;
+	}
+
+	bool BenchmarksRunner::IsHeadless(int argc, char** argv)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			if (strcmp(argv[i], "-headless") == 0)
+				return true;
+		}
+
+		return false;
+	}
+
+	Vector<BenchmarksRunner::Benchmark>& BenchmarksRunner::GetBenchmarks()
+	{
+		static Vector<Benchmark> benchmarks;
+		return benchmarks;
+	}
+
+	void BenchmarksRunner::RunOnce(const Benchmark& benchmark, BenchmarkContext& context)
+	{
+		srand(randomSeed);
+		benchmark.func(context);
+	}
+}
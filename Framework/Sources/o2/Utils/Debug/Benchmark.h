@@ -0,0 +1,182 @@
+#pragma once
+
+#include "o2/Utils/Types/CommonTypes.h"
+#include "o2/Utils/Types/Containers/Map.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+#define BENCHMARK_CONCAT_IMPL(A, B) A##B
+#define BENCHMARK_CONCAT(A, B) BENCHMARK_CONCAT_IMPL(A, B)
+
+#define BENCHMARK_IMPL(NAME, OPERATIONS, HEADLESS)                                               \
+	static void BENCHMARK_CONCAT(Benchmark, __LINE__)(o2::BenchmarkContext& context);            \
+	static o2::BenchmarkRegistrator BENCHMARK_CONCAT(benchmarkRegistrator, __LINE__)(            \
+		NAME, OPERATIONS, &BENCHMARK_CONCAT(Benchmark, __LINE__), HEADLESS);                     \
+	static void BENCHMARK_CONCAT(Benchmark, __LINE__)(o2::BenchmarkContext& context)
+
+// Declares and registers benchmark with name and count of operations. Body receives o2::BenchmarkContext& context,
+// prepares workload, performs context.operations operations between context.Begin() and context.End() and releases workload
+#define BENCHMARK(NAME, OPERATIONS) BENCHMARK_IMPL(NAME, OPERATIONS, false)
+
+// Declares and registers benchmark, which doesn't use application systems: scene, assets, render and UI. It can be run
+// without application and window by -headless argument
+#define HEADLESS_BENCHMARK(NAME, OPERATIONS) BENCHMARK_IMPL(NAME, OPERATIONS, true)
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------
+	// Benchmark run context. Measures time, heap allocations and peak heap memory between Begin() and
+	// End(). Everything outside is workload preparing and isn't measured
+	// -----------------------------------------------------------------------------------------------
+	class BenchmarkContext
+	{
+	public:
+		const int operations; // Count of operations, which must be performed between Begin() and End()
+
+	public:
+		// Constructor
+		BenchmarkContext(int operations);
+
+		// Begins measuring
+		void Begin();
+
+		// Ends measuring
+		void End();
+
+		// Marks benchmark as skipped, when workload can't be prepared
+		void Skip(const String& reason);
+
+		// Returns is benchmark skipped
+		bool IsSkipped() const;
+
+		// Returns skipping reason
+		const String& GetSkipReason() const;
+
+		// Checks result correctness. First failed check message is reported, and runner returns error exit code
+		void Check(bool condition, const String& message);
+
+		// Returns is some check failed
+		bool IsFailed() const;
+
+		// Returns first failed check message
+		const String& GetFailReason() const;
+
+		// Sets custom metric value, like quality of result. It is reported with measured time
+		void SetMetric(const String& name, double value);
+
+		// Returns custom metrics
+		const Map<String, double>& GetMetrics() const;
+
+		// Returns is measuring was performed
+		bool IsMeasured() const;
+
+		// Returns measured duration in nanoseconds
+		UInt64 GetDuration() const;
+
+		// Returns count of heap allocations while measuring
+		UInt64 GetAllocationsCount() const;
+
+		// Returns peak of allocated heap bytes while measuring
+		UInt64 GetPeakAllocatedBytes() const;
+
+	protected:
+		UInt64 mBeginTicks = 0;       // Measuring beginning time
+		UInt64 mDuration = 0;         // Measured duration in nanoseconds
+		UInt64 mBeginAllocations = 0; // Count of heap allocations at measuring beginning
+		UInt64 mAllocations = 0;      // Count of heap allocations while measuring
+		UInt64 mPeakBytes = 0;        // Peak of allocated heap bytes while measuring
+		bool   mMeasured = false;     // Is measuring performed
+		String mSkipReason;           // Skipping reason, empty when not skipped
+		String mFailReason;           // First failed check message, empty when all checks passed
+
+		Map<String, double> mMetrics; // Custom metrics values by names
+	};
+
+	typedef void(*BenchmarkFunc)(BenchmarkContext& context);
+
+	// ---------------------------------------------------------------------------------------------------
+	// Benchmarks runner. Runs registered benchmarks several times with same random seed, so workloads are
+	// reproducible, and reports median time per operation, allocations per operation and peak heap memory
+	// ---------------------------------------------------------------------------------------------------
+	class BenchmarksRunner
+	{
+	public:
+		// -----------------
+		// Benchmark results
+		// -----------------
+		struct Result
+		{
+			String name;                          // Benchmark name
+			int    operations = 0;                // Count of operations in one run
+			int    runs = 0;                      // Count of measured runs
+			double nsPerOperation = 0.0;          // Median time of operation in nanoseconds
+			double minNsPerOperation = 0.0;       // Minimal time of operation in nanoseconds
+			double allocationsPerOperation = 0.0; // Heap allocations per operation
+			UInt64 peakAllocatedBytes = 0;        // Peak of allocated heap bytes while measuring
+			bool   skipped = false;               // Is benchmark skipped
+			String skipReason;                    // Skipping reason
+			bool   failed = false;                // Is some result check failed
+			String failReason;                    // First failed check message
+
+			Map<String, double> metrics; // Custom metrics values by names, reported by last run
+		};
+
+	public:
+		// Registers benchmark. It is called by BENCHMARK and HEADLESS_BENCHMARK macros on static initialization
+		static void Register(const char* name, int operations, BenchmarkFunc func, bool headless = false);
+
+		// Returns registered benchmarks names. When headlessOnly is true, only benchmarks without application are returned
+		static Vector<String> GetBenchmarksNames(bool headlessOnly = false);
+
+		// Runs registered benchmarks, which names starts with filter. Each benchmark is run one time for warming up
+		// and runs times for measuring. When headlessOnly is true, only benchmarks without application are run
+		static Vector<Result> Run(const String& filter = "", int runs = 5, bool headlessOnly = false);
+
+		// Prints results table into console
+		static void PrintResults(const Vector<Result>& results);
+
+		// Saves results into JSON file for regression tracking
+		static bool SaveResults(const Vector<Result>& results, const String& path);
+
+		// Runs benchmarks with command line arguments: -filter <name prefix>, -runs <count>, -output <json path>,
+		// -list, -headless. Returns process exit code, it is error when some check failed
+		static int RunFromCommandLine(int argc, char** argv);
+
+		// Returns is -headless argument passed. Headless run is performed without application, only benchmarks
+		// declared by HEADLESS_BENCHMARK are run
+		static bool IsHeadless(int argc, char** argv);
+
+	protected:
+		static const unsigned int randomSeed = 0x02b3; // Random seed, set before each run
+
+		// --------------------
+		// Registered benchmark
+		// --------------------
+		struct Benchmark
+		{
+			const char*   name;       // Benchmark name
+			int           operations; // Count of operations in one run
+			BenchmarkFunc func;       // Benchmark function
+			bool          headless;   // Is benchmark independent of application systems
+		};
+
+	protected:
+		// Returns registered benchmarks. Function-local, because registering is performed on static initialization
+		static Vector<Benchmark>& GetBenchmarks();
+
+		// Runs benchmark one time
+		static void RunOnce(const Benchmark& benchmark, BenchmarkContext& context);
+	};
+
+	// ---------------------------------------------------------
+	// Benchmark static registrator, is used by BENCHMARK macros
+	// ---------------------------------------------------------
+	struct BenchmarkRegistrator
+	{
+		// Constructor, registers benchmark
+		BenchmarkRegistrator(const char* name, int operations, BenchmarkFunc func, bool headless)
+		{
+			BenchmarksRunner::Register(name, operations, func, headless);
+		}
+	};
+}
@@ -29,6 +29,7 @@ namespace o2
 		delete mLogStream->GetParentStream();
 		delete mFont;
 		delete mText;
+		delete mRenderStatsText;
 	}
 
 	void Debug::InitializeFont()
@@ -36,6 +37,10 @@ namespace o2
 		mFont = mnew VectorFont(o2Assets.GetBuiltAssetsPath() + "debugFont.ttf");
 		mFont->AddEffect<FontStrokeEffect>();
 		mText = mnew Text(FontRef(mFont));
+
+		mRenderStatsText = mnew Text(FontRef(mFont));
+		mRenderStatsText->horAlign = HorAlign::Left;
+		mRenderStatsText->verAlign = VerAlign::Top;
 	}
 
 	void Debug::Update(float dt)
@@ -55,6 +60,84 @@ namespace o2
 		}
 
 		freeDrawables.ForEach([&](auto drw) { mDbgDrawables.Remove(drw); delete drw; });
+
+		if (mRenderStatsOverlayEnabled)
+			DrawRenderStatsOverlay();
+	}
+
+	void Debug::SetRenderStatsOverlayEnabled(bool enabled)
+	{
+		mRenderStatsOverlayEnabled = enabled;
+	}
+
+	bool Debug::IsRenderStatsOverlayEnabled() const
+	{
+		return mRenderStatsOverlayEnabled;
+	}
+
+	void Debug::DrawRenderStatsOverlay()
+	{
+		const RenderStats& stats = o2Render.GetStats();
+
+		String text = "Draw calls: " + (String)stats.drawCalls + "  Triangles: " + (String)stats.triangles +
+			"  Vertices: " + (String)stats.vertices + "\nTexture binds: " + (String)stats.textureBinds +
+			"  Render target switches: " + (String)stats.renderTargetSwitches + "\nBatch breaks:";
+
+		for (int i = 0; i < (int)BatchBreakReason::Count; i++)
+		{
+			if (stats.batchBreaks[i] > 0)
+				text += "\n  " + String(RenderStats::GetBatchBreakReasonName((BatchBreakReason)i)) + ": " + (String)stats.batchBreaks[i];
+		}
+
+		auto appendGroups = [&](const char* caption, const Vector<RenderStats::Group>& groups) {
+			if (groups.IsEmpty())
+				return;
+
+			text += "\n" + String(caption);
+			for (auto& group : groups)
+			{
+				text += "\n  " + group.name + ": " + (String)group.drawCalls + " DC, " + (String)group.triangles + " tris, " +
+					(String)group.vertices + " verts";
+			}
+		};
+
+		appendGroups("Cameras:", stats.cameras);
+		appendGroups("Layers:", stats.layers);
+
+		Camera prevCamera = o2Render.GetCamera();
+		o2Render.SetCamera(Camera::Default());
+
+		Vec2F resolution = (Vec2F)o2Render.GetResolution();
+		Vec2F leftTop(-resolution.x*0.5f + 10.0f, resolution.y*0.5f - 10.0f);
+
+		// Draw calls history graph, scaled by maximum in history
+		const Vec2F graphSize(240.0f, 60.0f);
+		RectF graphRect(leftTop.x, leftTop.y, leftTop.x + graphSize.x, leftTop.y - graphSize.y);
+
+		int historyCount = o2Render.GetStatsHistoryCount();
+		UInt maxDrawCalls = 1;
+		for (int i = 0; i < historyCount; i++)
+			maxDrawCalls = Math::Max(maxDrawCalls, o2Render.GetStatsHistory(i).drawCalls);
+
+		Vector<Vec2F> graph;
+		for (int i = historyCount - 1; i >= 0; i--)
+		{
+			float x = graphRect.right - graphSize.x*(float)i/(float)(Render::statsHistoryLength - 1);
+			float y = graphRect.bottom + graphSize.y*(float)o2Render.GetStatsHistory(i).drawCalls/(float)maxDrawCalls;
+			graph.Add(Vec2F(x, y));
+		}
+
+		o2Render.DrawFilledPolygon({ graphRect.LeftBottom(), graphRect.LeftTop(), graphRect.RightTop(), graphRect.RightBottom() },
+								   Color4(0, 0, 0, 150));
+
+		if (graph.Count() > 1)
+			o2Render.DrawLine(graph, Color4(100, 220, 100, 255));
+
+		mRenderStatsText->SetText("Max draw calls: " + (String)maxDrawCalls + "\n" + text);
+		mRenderStatsText->SetPosition(Vec2F(leftTop.x, graphRect.bottom - 5.0f));
+		mRenderStatsText->Draw();
+
+		o2Render.SetCamera(prevCamera);
 	}
 
 	void Debug::Log(WString format, ...)
@@ -110,6 +110,12 @@ namespace o2
 		// Draws debug lines
 		void Draw();
 
+		// Sets render statistics overlay enabled. Overlay shows statistics of last frame and draw calls history
+		void SetRenderStatsOverlayEnabled(bool enabled);
+
+		// Returns is render statistics overlay enabled
+		bool IsRenderStatsOverlayEnabled() const;
+
 	protected:
 		// ------------------------------------------------------
 		// Debug drawable interface: color and disappearing delay
@@ -212,6 +218,9 @@ namespace o2
 		VectorFont*           mFont;		 // Font for debug captions
 		Text*                 mText;		 // Text for one frame debug captions
 
+		bool  mRenderStatsOverlayEnabled = false; // Is render statistics overlay enabled
+		Text* mRenderStatsText = nullptr;         // Render statistics overlay text
+
 	private:
 		// Default constructor
 		Debug();
@@ -225,6 +234,9 @@ namespace o2
 		// Initializes font and text
 		void InitializeFont();
 
+		// Draws render statistics overlay at left top corner of screen
+		void DrawRenderStatsOverlay();
+
 		friend class Singleton<Debug>;
 		friend class BaseApplication;
 		friend class Application;
@@ -0,0 +1,274 @@
+#include "o2/stdafx.h"
+#include "Profiler.h"
+
+#include <chrono>
+#include "o2/Utils/FileSystem/File.h"
+#include "o2/Utils/Math/Math.h"
+
+namespace o2
+{
+	// -------------------------------------------------------------------------------------------------
+	// Current thread's buffer. Unregisters buffer from profiler when thread finishes. Buffers are
+	// allocated by standard allocator, because memory manager isn't thread safe
+	// -------------------------------------------------------------------------------------------------
+	struct CurrentThreadBuffer
+	{
+		Profiler*               profiler = nullptr; // Profiler, which buffer is registered in
+		Profiler::ThreadBuffer* buffer = nullptr;   // Thread's buffer
+
+		// Destructor. Unregisters buffer, if profiler is still alive
+		~CurrentThreadBuffer()
+		{
+			if (buffer && profiler && Profiler::mInstance == profiler)
+				profiler->UnregisterThreadBuffer(buffer);
+		}
+	};
+
+	static thread_local CurrentThreadBuffer currentThreadBuffer;
+
+	Profiler::Profiler():
+		mEnabled(true), mFramesCount(0), mStartTicks(GetTicks())
+	{
+		memset(mFrameBegins, 0, sizeof(mFrameBegins));
+	}
+
+	Profiler::~Profiler()
+	{
+		for (auto buffer : mThreads)
+		{
+			delete[] buffer->events;
+			delete buffer;
+		}
+	}
+
+	void Profiler::SetEnabled(bool enabled)
+	{
+		mEnabled = enabled;
+	}
+
+	bool Profiler::IsEnabled() const
+	{
+		return mEnabled;
+	}
+
+	void Profiler::BeginFrame()
+	{
+		int frame = mFramesCount;
+		mFrameBegins[frame%framesCapacity] = GetTicks();
+		mFramesCount = frame + 1;
+	}
+
+	int Profiler::GetFramesCount() const
+	{
+		return mFramesCount;
+	}
+
+	UInt64 Profiler::GetFrameBegin(int frame) const
+	{
+		if (frame < 0 || frame >= mFramesCount || frame < mFramesCount - framesCapacity)
+			return 0;
+
+		return mFrameBegins[frame%framesCapacity];
+	}
+
+	int Profiler::GetThreadsCount() const
+	{
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		return mThreads.Count();
+	}
+
+	String Profiler::GetThreadName(int thread) const
+	{
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		if (thread < 0 || thread >= mThreads.Count())
+			return String();
+
+		return mThreads[thread]->name;
+	}
+
+	void Profiler::GetEvents(int thread, UInt64 begin, UInt64 end, Vector<Event>& events) const
+	{
+		// Lock keeps buffer alive while copying, thread doesn't take it when writing events
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		if (thread < 0 || thread >= mThreads.Count())
+			return;
+
+		ThreadBuffer* buffer = mThreads[thread];
+		int eventsStart = events.Count();
+
+		// Thread keeps writing while events are copied. Events count works as sequence counter: after copying
+		// it is read again, and when thread has reached copied oldest event, copy is retried with less events
+		UInt64 window = threadEventsCapacity - threadEventsCapacity/16;
+		while (true)
+		{
+			UInt64 count = buffer->eventsCount.load(std::memory_order_acquire);
+			UInt64 first = count - Math::Min(count, window);
+
+			for (UInt64 i = first; i < count; i++)
+			{
+				const Event& event = buffer->events[i%threadEventsCapacity];
+				if (event.end >= begin && event.begin <= end)
+					events.Add(event);
+			}
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			// Thread may be writing event with index writtenCount now, it overwrites event writtenCount - capacity
+			UInt64 writtenCount = buffer->eventsCount.load(std::memory_order_relaxed);
+			if (writtenCount < first + threadEventsCapacity)
+				break;
+
+			events.Resize(eventsStart);
+			window /= 2;
+		}
+	}
+
+	bool Profiler::SaveChromeTrace(const String& path) const
+	{
+		auto escape = [](const char* str) {
+			String res;
+			for (; *str; str++)
+			{
+				if (*str == '"' || *str == '\\')
+					res += '\\';
+
+				res += *str;
+			}
+
+			return res;
+		};
+
+		String data = "{\"traceEvents\":[\n";
+		bool first = true;
+		char buf[256];
+
+		for (int i = 0; i < GetThreadsCount(); i++)
+		{
+			String threadName = GetThreadName(i);
+			snprintf(buf, sizeof(buf), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"", i);
+			data += (first ? "" : ",\n") + String(buf) + escape(threadName.Data()) + "\"}}";
+			first = false;
+
+			Vector<Event> events;
+			GetEvents(i, 0, ULLONG_MAX, events);
+
+			for (auto& event : events)
+			{
+				double ts = TicksToMilliseconds(event.begin - mStartTicks)*1000.0;
+
+				if (event.depth < 0)
+				{
+					snprintf(buf, sizeof(buf), "\",\"ph\":\"C\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"args\":{\"value\":%g}}",
+							 i, ts, event.value);
+				}
+				else
+				{
+					double duration = TicksToMilliseconds(event.end - event.begin)*1000.0;
+					snprintf(buf, sizeof(buf), "\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+							 i, ts, duration);
+				}
+
+				data += ",\n{\"name\":\"" + escape(event.name) + String(buf);
+			}
+		}
+
+		data += "\n]}\n";
+
+		OutFile file(path);
+		if (!file.IsOpened())
+			return false;
+
+		file.WriteData(data.Data(), data.Length());
+		return true;
+	}
+
+	UInt64 Profiler::GetTicks()
+	{
+		return (UInt64)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	double Profiler::TicksToMilliseconds(UInt64 ticks)
+	{
+		return (double)ticks/1000000.0;
+	}
+
+	UInt64 Profiler::BeginZone()
+	{
+		if (!mInstance || !mInstance->mEnabled)
+			return 0;
+
+		mInstance->GetThreadBuffer()->depth++;
+		return GetTicks();
+	}
+
+	void Profiler::EndZone(const char* name, UInt64 begin)
+	{
+		UInt64 end = GetTicks();
+
+		ThreadBuffer* buffer = mInstance->GetThreadBuffer();
+		buffer->depth--;
+
+		WriteEvent(buffer, { name, begin, end, 0.0f, buffer->depth });
+	}
+
+	void Profiler::RecordCounter(const char* name, float value)
+	{
+		if (!mInstance || !mInstance->mEnabled)
+			return;
+
+		UInt64 time = GetTicks();
+		WriteEvent(mInstance->GetThreadBuffer(), { name, time, time, value, -1 });
+	}
+
+	void Profiler::SetThreadName(const char* name)
+	{
+		if (!mInstance)
+			return;
+
+		ThreadBuffer* buffer = mInstance->GetThreadBuffer();
+
+		std::lock_guard<std::mutex> lock(mInstance->mThreadsMutex);
+		buffer->name = name;
+	}
+
+	Profiler::ThreadBuffer* Profiler::GetThreadBuffer()
+	{
+		if (currentThreadBuffer.buffer && currentThreadBuffer.profiler == this)
+			return currentThreadBuffer.buffer;
+
+		ThreadBuffer* buffer = new ThreadBuffer();
+		buffer->events = new Event[threadEventsCapacity];
+		buffer->eventsCount = 0;
+
+		std::lock_guard<std::mutex> lock(mThreadsMutex);
+		buffer->index = mThreads.Count();
+		buffer->name = "Thread " + (String)buffer->index;
+		mThreads.Add(buffer);
+
+		currentThreadBuffer.profiler = this;
+		currentThreadBuffer.buffer = buffer;
+		return buffer;
+	}
+
+	void Profiler::UnregisterThreadBuffer(ThreadBuffer* buffer)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mThreadsMutex);
+			mThreads.Remove(buffer);
+
+			for (int i = 0; i < mThreads.Count(); i++)
+				mThreads[i]->index = i;
+		}
+
+		delete[] buffer->events;
+		delete buffer;
+	}
+
+	void Profiler::WriteEvent(ThreadBuffer* buffer, const Event& event)
+	{
+		UInt64 count = buffer->eventsCount.load(std::memory_order_relaxed);
+		buffer->events[count%threadEventsCapacity] = event;
+		buffer->eventsCount.store(count + 1, std::memory_order_release);
+	}
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "o2/EngineSettings.h"
+#include "o2/Utils/Singleton.h"
+#include "o2/Utils/Types/Containers/Vector.h"
+#include "o2/Utils/Types/String.h"
+
+// Profiler access macros
+#define o2Profiler o2::Profiler::Instance()
+
+#if ENABLE_PROFILING
+
+#define PROFILE_CONCAT_IMPL(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_IMPL(A, B)
+
+// Measures zone from this line to the end of scope. Name must be string with static lifetime, like literal
+#define PROFILE_SCOPE(NAME) o2::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(NAME)
+
+// Records counter value on timeline. Name must be string with static lifetime, like literal
+#define PROFILE_COUNTER(NAME, VALUE) o2::Profiler::RecordCounter(NAME, (float)(VALUE))
+
+// Sets name of current thread in profiler
+#define PROFILE_THREAD(NAME) o2::Profiler::SetThreadName(NAME)
+
+#else
+
+#define PROFILE_SCOPE(NAME)
+#define PROFILE_COUNTER(NAME, VALUE)
+#define PROFILE_THREAD(NAME)
+
+#endif
+
+namespace o2
+{
+	// -----------------------------------------------------------------------------------------------------
+	// Hierarchical CPU profiler. Zones and counters are written into per-thread ring buffers without locks,
+	// so instrumentation is cheap and can be used from any thread. Last recorded events are available for
+	// visualization and can be exported into Chrome trace JSON (chrome://tracing or Perfetto)
+	// -----------------------------------------------------------------------------------------------------
+	class Profiler: public Singleton<Profiler>
+	{
+	public:
+		// -------------------------------------------------------------
+		// Recorded event: finished zone or counter value. Time in ticks
+		// -------------------------------------------------------------
+		struct Event
+		{
+			const char* name;  // Zone or counter name
+			UInt64      begin; // Zone beginning or counter time
+			UInt64      end;   // Zone ending time, equals beginning for counter
+			float       value; // Counter value
+			int         depth; // Zone depth in thread's zones hierarchy, -1 for counter
+		};
+
+		// ------------------------------------------------------------------------------------------
+		// Thread's events ring buffer. Written only by its thread, read by others. Buffer is removed
+		// from profiler when its thread finishes
+		// ------------------------------------------------------------------------------------------
+		struct ThreadBuffer
+		{
+			String              name;        // Thread name
+			int                 index = 0;   // Thread index in profiler
+			Event*              events;      // Events ring
+			std::atomic<UInt64> eventsCount; // Count of written events. Position in ring is count modulo capacity
+			int                 depth = 0;   // Current zones depth
+		};
+
+	public:
+		static const int threadEventsCapacity = 65536; // Events ring capacity of each thread
+		static const int framesCapacity = 256;         // Count of last frames, which beginnings are stored
+
+	public:
+		// Default constructor
+		Profiler();
+
+		// Destructor
+		~Profiler();
+
+		// Sets profiling enabled. Disabled profiler doesn't record zones and counters
+		void SetEnabled(bool enabled);
+
+		// Returns is profiling enabled
+		bool IsEnabled() const;
+
+		// Marks beginning of new frame. It is called by application
+		void BeginFrame();
+
+		// Returns count of frames from profiler start
+		int GetFramesCount() const;
+
+		// Returns beginning time of frame by index from profiler start. Only last frames are available
+		UInt64 GetFrameBegin(int frame) const;
+
+		// Returns count of threads, which recorded events
+		int GetThreadsCount() const;
+
+		// Returns thread name. Returns empty string, when thread was finished and removed
+		String GetThreadName(int thread) const;
+
+		// Copies thread's events, which intersect time range from begin to end. Events, overwritten by thread
+		// while copying, are dropped
+		void GetEvents(int thread, UInt64 begin, UInt64 end, Vector<Event>& events) const;
+
+		// Saves all recorded events into Chrome trace JSON file
+		bool SaveChromeTrace(const String& path) const;
+
+		// Returns current time in ticks
+		static UInt64 GetTicks();
+
+		// Converts ticks to milliseconds
+		static double TicksToMilliseconds(UInt64 ticks);
+
+		// Begins zone in current thread. Returns zone beginning time, or 0 when profiler is disabled
+		static UInt64 BeginZone();
+
+		// Ends zone in current thread, begun at time
+		static void EndZone(const char* name, UInt64 begin);
+
+		// Records counter value in current thread
+		static void RecordCounter(const char* name, float value);
+
+		// Sets name of current thread
+		static void SetThreadName(const char* name);
+
+	protected:
+		std::atomic<bool> mEnabled; // Is profiling enabled
+
+		mutable std::mutex    mThreadsMutex; // Threads list mutex. Buffers aren't deleted while it is locked
+		Vector<ThreadBuffer*> mThreads;      // Threads buffers. Buffer is removed when thread finishes
+
+		UInt64           mFrameBegins[framesCapacity]; // Ring of last frames beginnings
+		std::atomic<int> mFramesCount;                 // Count of frames from profiler start
+
+		UInt64 mStartTicks; // Profiler start time, trace time is counted from it
+
+	protected:
+		// Returns current thread's buffer, registers it on first call
+		ThreadBuffer* GetThreadBuffer();
+
+		// Removes and deletes finished thread's buffer
+		void UnregisterThreadBuffer(ThreadBuffer* buffer);
+
+		// Writes event into current thread's ring buffer
+		static void WriteEvent(ThreadBuffer* buffer, const Event& event);
+
+		friend struct CurrentThreadBuffer;
+	};
+
+	// -------------------------------------------------------------
+	// Profiler zone. Measures time from construction to destruction
+	// -------------------------------------------------------------
+	class ProfileScope
+	{
+	public:
+		// Constructor, begins zone
+		ProfileScope(const char* name): mName(name), mBegin(Profiler::BeginZone()) {}
+
+		// Destructor, ends zone
+		~ProfileScope() { if (mBegin) Profiler::EndZone(mName, mBegin); }
+
+	protected:
+		const char* mName;  // Zone name
+		UInt64      mBegin; // Zone beginning time, 0 when profiler was disabled
+	};
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <new>
 #include <vector>
 #include "o2/Utils/Memory/MemoryManager.h"
 
@@ -23,6 +25,9 @@ namespace o2
 		// Returns cloned copy of this
 		virtual IFunction* Clone() const = 0;
 
+		// Returns copy of this, constructed in buffer when it fits, otherwise in heap
+		virtual IFunction* CloneTo(void* buffer, int bufferSize) const { return Clone(); }
+
 		// Invokes function with arguments
 		virtual _res_type Invoke(_args ... args) const = 0;
 
@@ -36,6 +41,16 @@ namespace o2
 		}
 	};
 
+	// Constructs copy of functor in buffer when it fits, otherwise in heap
+	template<typename _functor_type, typename _base_type>
+	_base_type* CloneFunctorTo(const _functor_type& functor, void* buffer, int bufferSize)
+	{
+		if (sizeof(_functor_type) <= (size_t)bufferSize && alignof(_functor_type) <= alignof(void*))
+			return new (buffer) _functor_type(functor);
+
+		return mnew _functor_type(functor);
+	}
+
 	template <typename UnusedType>
 	class FunctionPtr;
 
@@ -83,6 +98,12 @@ namespace o2
 			return mnew FunctionPtr(*this);
 		}
 
+		// Returns copy of this, constructed in buffer when it fits
+		IFunction<_res_type(_args ...)>* CloneTo(void* buffer, int bufferSize) const
+		{
+			return CloneFunctorTo<FunctionPtr, IFunction<_res_type(_args ...)>>(*this, buffer, bufferSize);
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -146,6 +167,12 @@ namespace o2
 			return mnew ObjFunctionPtr(*this);
 		}
 
+		// Returns copy of this, constructed in buffer when it fits
+		IFunction<_res_type(_args ...)>* CloneTo(void* buffer, int bufferSize) const
+		{
+			return CloneFunctorTo<ObjFunctionPtr, IFunction<_res_type(_args ...)>>(*this, buffer, bufferSize);
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -209,6 +236,12 @@ namespace o2
 			return mnew ObjConstFunctionPtr(*this);
 		}
 
+		// Returns copy of this, constructed in buffer when it fits
+		IFunction<_res_type(_args ...)>* CloneTo(void* buffer, int bufferSize) const
+		{
+			return CloneFunctorTo<ObjConstFunctionPtr, IFunction<_res_type(_args ...)>>(*this, buffer, bufferSize);
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -337,6 +370,12 @@ namespace o2
 			return mnew SharedLambda(*this);
 		}
 
+		// Returns copy of this, constructed in buffer when it fits
+		IFunction<_res_type(_args ...)>* CloneTo(void* buffer, int bufferSize) const
+		{
+			return CloneFunctorTo<SharedLambda, IFunction<_res_type(_args ...)>>(*this, buffer, bufferSize);
+		}
+
 		// Invokes function with arguments as functor
 		_res_type Invoke(_args ... args) const
 		{
@@ -366,18 +405,206 @@ namespace o2
 		}
 	};
 
+	// Returns unique lambda delegate identifier
+	inline unsigned int GenerateLambdaFunctionId()
+	{
+		static std::atomic<unsigned int> lastId(0);
+		return ++lastId;
+	}
+
+	// ----------------------------------------------------------------------------------
+	// Lambda delegate. Keeps lambda by value, copies of delegate are equal by identifier
+	// ----------------------------------------------------------------------------------
+	template<typename _lambda_type, typename _res_type, typename ... _args>
+	class LambdaFunction : public IFunction<_res_type(_args ...)>
+	{
+		_lambda_type mLambda; // Lambda object (anonymous functor)
+		unsigned int mId;     // Identifier, shared between copies
+
+	public:
+		// Constructor
+		LambdaFunction(const _lambda_type& lambda) :
+			mLambda(lambda), mId(GenerateLambdaFunctionId())
+		{}
+
+		// Copy-constructor
+		LambdaFunction(const LambdaFunction& other) :
+			mLambda(other.mLambda), mId(other.mId)
+		{}
+
+		// Equal operator
+		bool operator==(const LambdaFunction& other) const
+		{
+			return mId == other.mId;
+		}
+
+		// Not equal operator
+		bool operator!=(const LambdaFunction& other) const
+		{
+			return mId != other.mId;
+		}
+
+		// Returns cloned copy of this
+		IFunction<_res_type(_args ...)>* Clone() const
+		{
+			return mnew LambdaFunction(*this);
+		}
+
+		// Returns copy of this, constructed in buffer when it fits
+		IFunction<_res_type(_args ...)>* CloneTo(void* buffer, int bufferSize) const
+		{
+			return CloneFunctorTo<LambdaFunction, IFunction<_res_type(_args ...)>>(*this, buffer, bufferSize);
+		}
+
+		// Invokes function with arguments as functor
+		_res_type Invoke(_args ... args) const
+		{
+			return mLambda(args ...);
+		}
+
+		// Returns true if functions is equals
+		bool Equals(const IFunction<_res_type(_args ...)>* other) const
+		{
+			const LambdaFunction* otherFuncPtr = dynamic_cast<const LambdaFunction*>(other);
+			if (otherFuncPtr)
+				return *otherFuncPtr == *this;
+
+			return false;
+		}
+	};
+
+	// ---------------------------------------------------------------------------------------------
+	// Handle of functors added to combined delegate. Used for fast removing. Covers several functors
+	// when other combined delegate was added
+	// ---------------------------------------------------------------------------------------------
+	struct FunctionHandle
+	{
+		int          index = -1; // First functor index in delegate at adding moment
+		unsigned int id = 0;     // First functor unique identifier in delegate
+		unsigned int count = 1;  // Count of added functors. Their identifiers are consecutive
+	};
+
 	template <typename UnusedType>
 	class Function;
 
-	// --------------------------------------------------
-	// Combined delegate. Can contain many other functors
-	// --------------------------------------------------
+	// ----------------------------------------------------------------------------------------
+	// Combined delegate. Can contain many other functors. First functor and small functors are
+	// kept inside without heap allocations
+	// ----------------------------------------------------------------------------------------
 	template<typename _res_type, typename ... _args>
 	class Function <_res_type(_args ...)> : public IFunction<_res_type(_args ...)>
 	{
-		typedef std::vector<IFunction<_res_type(_args ...)>*> FunctionsVec;
+		typedef IFunction<_res_type(_args ...)> IFunctionType;
+
+		static const int functorBufferSize = sizeof(void*)*4; // Size of inline functor buffer. Enough for object
+		                                                      // function pointer with multiple inheritance and
+		                                                      // lambda with couple of captures
+
+		// ---------------------------------------------------------------------
+		// Functor slot. Keeps functor in inline buffer when it fits, or in heap
+		// ---------------------------------------------------------------------
+		struct Slot
+		{
+			alignas(void*) char buffer[functorBufferSize]; // Inline functor buffer
+			IFunctionType*      functor = nullptr;          // Functor, placed in buffer or in heap
+			unsigned int        id = 0;                     // Unique in list identifier
+			bool                removed = false;            // Is slot removed. Functor of removed slot is destroyed
+			                                                // after invocation, because it may be invoking now
+
+			// Default constructor
+			Slot() {}
+
+			// Constructor from functor
+			Slot(const IFunctionType& func, unsigned int id) :
+				functor(func.CloneTo(buffer, functorBufferSize)), id(id)
+			{}
+
+			// Copy-constructor
+			Slot(const Slot& other) :
+				functor(other.functor ? other.functor->CloneTo(buffer, functorBufferSize) : nullptr), id(other.id),
+				removed(other.removed)
+			{}
+
+			// Destructor
+			~Slot()
+			{
+				Reset();
+			}
+
+			// Copy-operator
+			Slot& operator=(const Slot& other)
+			{
+				if (this == &other)
+					return *this;
+
+				Reset();
+				functor = other.functor ? other.functor->CloneTo(buffer, functorBufferSize) : nullptr;
+				id = other.id;
+				removed = other.removed;
 
-		FunctionsVec mFunctions; // Vector of functors
+				return *this;
+			}
+
+			// Returns functor, or null when slot is removed
+			IFunctionType* GetFunctor() const
+			{
+				return removed ? nullptr : functor;
+			}
+
+			// Destroys functor
+			void Reset()
+			{
+				if (!functor)
+					return;
+
+				if ((void*)functor == (void*)buffer)
+					functor->~IFunctionType();
+				else
+					delete functor;
+
+				functor = nullptr;
+			}
+		};
+
+		// ------------------------------------------------------------------------------------------------------
+		// Invocation scope. Slots aren't moved and functors aren't destroyed while invoking, because one of them
+		// is executing now. Removed slots and added while invoking slots are applied when outer invocation ends.
+		// Function can be destroyed by invoking functor, then it resets function in all its scopes
+		// ------------------------------------------------------------------------------------------------------
+		struct InvocationScope
+		{
+			const Function*  function;   // Invoking function. Null when function was destroyed while invoking
+			InvocationScope* outerScope; // Outer invocation scope of the same function
+
+			// Constructor, makes scope innermost for function
+			InvocationScope(const Function& function) :
+				function(&function), outerScope(function.mInvocationScope)
+			{
+				function.mInvocationScope = this;
+			}
+
+			// Destructor, restores outer scope and applies changes made while invoking, when function is alive.
+			// Function can be changed only through non-const reference, so const cast is safe here
+			~InvocationScope()
+			{
+				if (!function)
+					return;
+
+				function->mInvocationScope = outerScope;
+				if (!outerScope)
+					const_cast<Function*>(function)->CompactSlots();
+			}
+		};
+
+		Slot              mFirstSlot;             // First functor slot, used when there is only one functor
+		bool              mFirstSlotUsed = false; // Is first slot used
+		std::vector<Slot> mSlots;                 // Other functors slots
+		std::vector<Slot> mAddedSlots;            // Slots, added while invoking. They are moved to mSlots after invocation
+		int               mRemovedCount = 0;      // Count of removed and not compacted slots
+		unsigned int      mLastSlotId = 0;        // Last given slot identifier
+
+		mutable InvocationScope* mInvocationScope = nullptr; // Innermost invocation scope. Slots can't be moved or
+		                                                     // destroyed while invoking
 
 	public:
 		static const Function<_res_type(_args ...)> empty;
@@ -390,59 +617,67 @@ namespace o2
 		// Copy-constructor
 		Function(const Function& other)
 		{
-			for (auto func : other.mFunctions)
-				mFunctions.push_back(func->Clone());
+			Add(other);
 		}
 
 		// Constructor from IFunction
-		Function(const IFunction<_res_type(_args ...)>& func)
+		Function(const IFunctionType& func)
 		{
-			mFunctions.push_back(func.Clone());
+			Add(func);
 		}
 
 		// Constructor from static function pointer
 		template<typename _func_type>
 		Function(const _func_type* func)
 		{
-			mFunctions.push_back(new Function<_res_type(_args ...)>(*func));
+			Add(Function<_res_type(_args ...)>(*func));
 		}
 
-		// Constructor from lambda
+		// Constructor from lambda. Small copyable lambdas are stored inside, others are shared
 		template<typename _lambda_type, typename x = std::enable_if<std::is_invocable_r<_res_type, _lambda_type, _args ...>::value>::type>
 		Function(const _lambda_type& lambda)
 		{
-			mFunctions.push_back(new SharedLambda<_res_type(_args ...)>(lambda));
+			typedef LambdaFunction<_lambda_type, _res_type, _args ...> LambdaFunctionType;
+
+			if constexpr (sizeof(LambdaFunctionType) <= functorBufferSize && alignof(LambdaFunctionType) <= alignof(void*))
+				Add(LambdaFunctionType(lambda));
+			else
+				Add(SharedLambda<_res_type(_args ...)>(lambda));
 		}
 
 		// Constructor from object and his function
 		template<typename _class_type>
 		Function(_class_type* object, _res_type(_class_type::*functionPtr)(_args ... args))
 		{
-			mFunctions.push_back(new ObjFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
+			Add(ObjFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
 		}
 
 		// Constructor from object and his function
 		template<typename _class_type>
 		Function(const ObjFunctionPtr<_class_type, _res_type, _args ...>& func)
 		{
-			mFunctions.push_back(new ObjFunctionPtr<_class_type, _res_type, _args ...>(func));
+			Add(func);
 		}
 
 		// Constructor from object and his function
 		template<typename _class_type>
 		Function(_class_type* object, _res_type(_class_type::*functionPtr)(_args ... args) const)
 		{
-			mFunctions.push_back(new ObjConstFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
+			Add(ObjConstFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
 		}
 
-		// Destructor
+		// Destructor. Functor, destroying this function, is invoking now, so invocation stops after it
 		~Function()
 		{
+			for (auto scope = mInvocationScope; scope; scope = scope->outerScope)
+				scope->function = nullptr;
+
+			mInvocationScope = nullptr;
 			Clear();
 		}
 
 		// Returns cloned copy of this
-		IFunction<_res_type(_args ...)>* Clone() const
+		IFunctionType* Clone() const
 		{
 			return mnew Function(*this);
 		}
@@ -450,54 +685,124 @@ namespace o2
 		// Removing all inside functions
 		void Clear()
 		{
-			for (auto func : mFunctions)
-				delete func;
+			if (mInvocationScope)
+			{
+				int count = GetSlotsCount();
+				for (int i = 0; i < count; i++)
+					RemoveSlot(i);
 
-			mFunctions.clear();
+				return;
+			}
+
+			mFirstSlot.Reset();
+			mFirstSlotUsed = false;
+			mSlots.clear();
+			mAddedSlots.clear();
+			mRemovedCount = 0;
 		}
 
 		// Returns true when function is empty
 		bool IsEmpty() const
 		{
-			return mFunctions.size() == 0;
+			return GetSlotsCount() == mRemovedCount;
 		}
 
-		// Add delegate to inside list
+		// Add delegate to inside list. Returns handle for fast removing
 		template<typename _class_type>
-		void Add(_class_type* object, _res_type(_class_type::*functionPtr)(_args ... args))
+		FunctionHandle Add(_class_type* object, _res_type(_class_type::*functionPtr)(_args ... args))
 		{
-			mFunctions.push_back(new ObjFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
+			return Add(ObjFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
 		}
 
-		// Add delegate to inside list
+		// Add delegate to inside list. Returns handle for fast removing
 		template<typename _class_type>
-		void Add(_class_type* object, _res_type(_class_type::*functionPtr)(_args ... args) const)
+		FunctionHandle Add(_class_type* object, _res_type(_class_type::*functionPtr)(_args ... args) const)
 		{
-			mFunctions.push_back(new ObjConstFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
+			return Add(ObjConstFunctionPtr<_class_type, _res_type, _args ...>(object, functionPtr));
 		}
 
-		// Add delegate to inside list
-		void Add(const IFunction<_res_type(_args ...)>& func)
+		// Add delegate to inside list. Returns handle for fast removing
+		FunctionHandle Add(const IFunctionType& func)
 		{
-			mFunctions.push_back(func.Clone());
+			CompactSlots();
+
+			FunctionHandle handle;
+			handle.index = GetSlotsCount();
+			handle.id = ++mLastSlotId;
+
+			if (mInvocationScope)
+				mAddedSlots.emplace_back(func, handle.id);
+			else if (!mFirstSlotUsed && mSlots.empty())
+			{
+				mFirstSlot.functor = func.CloneTo(mFirstSlot.buffer, functorBufferSize);
+				mFirstSlot.id = handle.id;
+				mFirstSlot.removed = false;
+				mFirstSlotUsed = true;
+			}
+			else
+				mSlots.emplace_back(func, handle.id);
+
+			return handle;
 		}
 
-		// Add delegate to inside list
-		void Add(const Function& funcs)
+		// Add delegates from other combined delegate to inside list. Returns handle of all added delegates
+		FunctionHandle Add(const Function& funcs)
+		{
+			CompactSlots();
+
+			FunctionHandle handle;
+			handle.index = GetSlotsCount();
+			handle.id = mLastSlotId + 1;
+			handle.count = 0;
+
+			int count = funcs.GetSlotsCount();
+			for (int i = 0; i < count; i++)
+			{
+				if (auto functor = funcs.GetSlot(i).GetFunctor())
+				{
+					Add(*functor);
+					handle.count++;
+				}
+			}
+
+			return handle;
+		}
+
+		// Removes delegates by handle, returned on adding
+		void Remove(const FunctionHandle& handle)
 		{
-			for (auto func : funcs.mFunctions)
-				mFunctions.push_back(func->Clone());
+			if (handle.count == 0)
+				return;
+
+			// Slots keep adding order, so handle's slots are consecutive. They can be moved to lower indices by
+			// compaction after adding
+			int first = 0;
+			if (handle.index >= 0 && handle.index < GetSlotsCount() && GetSlot(handle.index).id == handle.id)
+				first = handle.index;
+
+			for (int i = first; i < GetSlotsCount(); i++)
+			{
+				unsigned int id = GetSlot(i).id;
+				if (id < handle.id)
+					continue;
+
+				if (id >= handle.id + handle.count)
+					break;
+
+				RemoveSlot(i);
+			}
 		}
 
 		// Add delegate to inside list
-		void Remove(const IFunction<_res_type(_args ...)>& func)
+		void Remove(const IFunctionType& func)
 		{
-			for (auto funcIt = mFunctions.begin(); funcIt != mFunctions.end(); ++funcIt)
+			int count = GetSlotsCount();
+			for (int i = 0; i < count; i++)
 			{
-				if ((*funcIt)->Equals(&func))
+				auto functor = GetSlot(i).GetFunctor();
+				if (functor && functor->Equals(&func))
 				{
-					delete *funcIt;
-					mFunctions.erase(funcIt);
+					RemoveSlot(i);
 					break;
 				}
 			}
@@ -506,24 +811,22 @@ namespace o2
 		// Remove delegate from list
 		void Remove(const Function& func)
 		{
-			for (auto funcIt = mFunctions.begin(); funcIt != mFunctions.end(); )
+			int otherCount = func.GetSlotsCount();
+			for (int i = 0; i < GetSlotsCount(); i++)
 			{
-				bool found = false;
-				for (auto funcIt2 = func.mFunctions.begin(); funcIt2 != func.mFunctions.end(); ++funcIt2)
+				auto functor = GetSlot(i).GetFunctor();
+				if (!functor)
+					continue;
+
+				for (int j = 0; j < otherCount; j++)
 				{
-					if ((*funcIt)->Equals(*funcIt2))
+					auto otherFunctor = func.GetSlot(j).GetFunctor();
+					if (otherFunctor && functor->Equals(otherFunctor))
 					{
-						found = true;
+						RemoveSlot(i);
 						break;
 					}
 				}
-
-				if (found)
-				{
-					delete *funcIt;
-					funcIt = mFunctions.erase(funcIt);
-				}
-				else ++funcIt;
 			}
 		}
 
@@ -542,11 +845,13 @@ namespace o2
 		}
 
 		// Returns true, if this contains the delegate
-		bool Contains(const IFunction<_res_type(_args ...)>& func) const
+		bool Contains(const IFunctionType& func) const
 		{
-			for (auto funcIt = mFunctions.begin(); funcIt != mFunctions.end(); ++funcIt)
+			int count = GetSlotsCount();
+			for (int i = 0; i < count; i++)
 			{
-				if ((*funcIt)->Equals(&func))
+				auto functor = GetSlot(i).GetFunctor();
+				if (functor && functor->Equals(&func))
 					return true;
 			}
 
@@ -559,21 +864,39 @@ namespace o2
 			return Invoke(args ...);
 		}
 
-		// Invokes function with arguments
+		// Invokes function with arguments. Functors added while invoking are not invoked, removed are skipped. When
+		// functor destroys this function, next functors are not invoked
 		_res_type Invoke(_args ... args) const
 		{
-			if (mFunctions.size() == 0)
+			int last = GetInvokableSlotsCount() - 1;
+			while (last >= 0 && !GetSlot(last).GetFunctor())
+				last--;
+
+			if (last < 0)
 				return _res_type();
 
-			auto it = mFunctions.cbegin();
-			for (; it != mFunctions.cend() - 1; ++it)
-				(*it)->Invoke(args ...);
+			InvocationScope scope(*this);
+
+			for (int i = 0; i < last; i++)
+			{
+				if (auto functor = GetSlot(i).GetFunctor())
+				{
+					functor->Invoke(args ...);
+
+					// Functor destroyed this function, slots don't exist anymore
+					if (!scope.function)
+						return _res_type();
+				}
+			}
+
+			if (auto functor = GetSlot(last).GetFunctor())
+				return functor->Invoke(args ...);
 
-			return (*it)->Invoke(args ...);
+			return _res_type();
 		}
 
 		// Copy operator
-		Function<_res_type(_args ...)>& operator=(const IFunction<_res_type(_args ...)>& func)
+		Function<_res_type(_args ...)>& operator=(const IFunctionType& func)
 		{
 			Clear();
 			Add(func);
@@ -583,6 +906,9 @@ namespace o2
 		// Copy operator
 		Function<_res_type(_args ...)>& operator=(const Function& other)
 		{
+			if (this == &other)
+				return *this;
+
 			Clear();
 			Add(other);
 			return *this;
@@ -591,12 +917,19 @@ namespace o2
 		// Equal operator
 		bool operator==(const Function& other) const
 		{
-			for (auto func : mFunctions)
+			int count = GetSlotsCount();
+			int otherCount = other.GetSlotsCount();
+			for (int i = 0; i < count; i++)
 			{
+				auto functor = GetSlot(i).GetFunctor();
+				if (!functor)
+					continue;
+
 				bool found = false;
-				for (auto otherFunc : other.mFunctions)
+				for (int j = 0; j < otherCount; j++)
 				{
-					if (func->Equals(otherFunc))
+					auto otherFunctor = other.GetSlot(j).GetFunctor();
+					if (otherFunctor && functor->Equals(otherFunctor))
 					{
 						found = true;
 						break;
@@ -617,16 +950,23 @@ namespace o2
 		}
 
 		// Equal operator
-		bool operator==(const IFunction<_res_type(_args ...)>& func) const
+		bool operator==(const IFunctionType& func) const
 		{
-			if (mFunctions.size() != 1)
+			if (GetSlotsCount() - mRemovedCount != 1)
 				return false;
 
-			return mFunctions[0]->Equals(&func);
+			int count = GetSlotsCount();
+			for (int i = 0; i < count; i++)
+			{
+				if (auto functor = GetSlot(i).GetFunctor())
+					return functor->Equals(&func);
+			}
+
+			return false;
 		}
 
 		// Not equal operator
-		bool operator!=(const IFunction<_res_type(_args ...)>& func) const
+		bool operator!=(const IFunctionType& func) const
 		{
 			return !(*this == func);
 		}
@@ -634,11 +974,11 @@ namespace o2
 		// Returns true, when delegates list isn't empty
 		operator bool() const
 		{
-			return mFunctions.size() > 0;
+			return !IsEmpty();
 		}
 
 		// Returns true when functions is equal
-		bool Equals(const IFunction<_res_type(_args ...)>* other) const
+		bool Equals(const IFunctionType* other) const
 		{
 			const Function* otherFuncPtr = dynamic_cast<const Function*>(other);
 			if (otherFuncPtr)
@@ -648,7 +988,7 @@ namespace o2
 		}
 
 		// Add delegate to inside list
-		Function<_res_type(_args ...)> operator+(const IFunction<_res_type(_args ...)>& func) const
+		Function<_res_type(_args ...)> operator+(const IFunctionType& func) const
 		{
 			Function<_res_type(_args ...)> res(*this);
 			res.Add(func);
@@ -656,7 +996,7 @@ namespace o2
 		}
 
 		// Add delegate to inside list
-		Function<_res_type(_args ...)>& operator+=(const IFunction<_res_type(_args ...)>& func)
+		Function<_res_type(_args ...)>& operator+=(const IFunctionType& func)
 		{
 			Add(func);
 			return *this;
@@ -678,7 +1018,7 @@ namespace o2
 		}
 
 		// Removes delegate from list
-		Function<_res_type(_args ...)> operator-(const IFunction<_res_type(_args ...)>& func) const
+		Function<_res_type(_args ...)> operator-(const IFunctionType& func) const
 		{
 			Function<_res_type(_args ...)> res(*this);
 			res.Remove(func);
@@ -686,7 +1026,7 @@ namespace o2
 		}
 
 		// Removes delegate from list
-		Function<_res_type(_args ...)>& operator-=(const IFunction<_res_type(_args ...)>& func)
+		Function<_res_type(_args ...)>& operator-=(const IFunctionType& func)
 		{
 			Remove(func);
 			return *this;
@@ -706,6 +1046,101 @@ namespace o2
 			Remove(other);
 			return *this;
 		}
+
+	protected:
+		// Returns count of slots, including removed and added while invoking
+		int GetSlotsCount() const
+		{
+			return GetInvokableSlotsCount() + (int)mAddedSlots.size();
+		}
+
+		// Returns count of slots, which can be invoked now: without added while invoking
+		int GetInvokableSlotsCount() const
+		{
+			return (mFirstSlotUsed ? 1 : 0) + (int)mSlots.size();
+		}
+
+		// Returns slot by index
+		const Slot& GetSlot(int idx) const
+		{
+			return const_cast<Function*>(this)->GetSlot(idx);
+		}
+
+		// Returns slot by index
+		Slot& GetSlot(int idx)
+		{
+			if (mFirstSlotUsed)
+			{
+				if (idx == 0)
+					return mFirstSlot;
+
+				idx--;
+			}
+
+			if (idx < (int)mSlots.size())
+				return mSlots[idx];
+
+			return mAddedSlots[idx - mSlots.size()];
+		}
+
+		// Marks slot as removed. Functor is destroyed immediately, or after invocation when it is invoking now.
+		// Slot is compacted later
+		void RemoveSlot(int idx)
+		{
+			Slot& slot = GetSlot(idx);
+			if (slot.removed)
+				return;
+
+			slot.removed = true;
+			mRemovedCount++;
+
+			if (!mInvocationScope)
+				slot.Reset();
+
+			if (mRemovedCount == GetSlotsCount())
+				CompactSlots();
+		}
+
+		// Removes removed slots and moves slots added while invoking to the list, when there is no invocation now
+		void CompactSlots()
+		{
+			if (mInvocationScope || (mRemovedCount == 0 && mAddedSlots.empty()))
+				return;
+
+			auto isRemoved = [](const Slot& slot) { return slot.removed; };
+
+			if (mRemovedCount > 0)
+			{
+				if (mFirstSlotUsed && mFirstSlot.removed)
+				{
+					mFirstSlot.Reset();
+					mFirstSlotUsed = false;
+				}
+
+				for (auto& slot : mSlots)
+				{
+					if (slot.removed)
+						slot.Reset();
+				}
+
+				mSlots.erase(std::remove_if(mSlots.begin(), mSlots.end(), isRemoved), mSlots.end());
+				mAddedSlots.erase(std::remove_if(mAddedSlots.begin(), mAddedSlots.end(), isRemoved), mAddedSlots.end());
+				mRemovedCount = 0;
+			}
+
+			for (auto& slot : mAddedSlots)
+			{
+				if (!mFirstSlotUsed && mSlots.empty())
+				{
+					mFirstSlot = slot;
+					mFirstSlotUsed = true;
+				}
+				else
+					mSlots.push_back(slot);
+			}
+
+			mAddedSlots.clear();
+		}
 	};
 
 	template<typename _res_type, typename ... _args>
@@ -4,6 +4,11 @@
 #include "o2/Utils/Math/Interpolation.h"
 #include "o2/Utils/Tools/KeySearch.h"
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define CURVE_SSE
+#include <emmintrin.h>
+#endif
+
 namespace o2
 {
 	Curve::Curve()
@@ -22,7 +27,8 @@ namespace o2
 	}
 
 	Curve::Curve(const Curve& other) :
-		mKeys(other.mKeys), keys(this), length(this)
+		mKeys(other.mKeys), mBakedSamplesCount(other.mBakedSamplesCount), mBakedBegin(other.mBakedBegin),
+		mBakedInvStep(other.mBakedInvStep), mBakedValues(other.mBakedValues), keys(this), length(this)
 	{ }
 
 	bool Curve::operator!=(const Curve& other) const
@@ -47,6 +53,7 @@ namespace o2
 	Curve& Curve::operator=(const Curve& other)
 	{
 		mKeys = other.mKeys;
+		mBakedSamplesCount = other.mBakedSamplesCount;
 
 		UpdateApproximation();
 
@@ -76,6 +83,9 @@ namespace o2
 		else if (count == 0)
 			return 0.0f;
 
+		if (mBakedSamplesCount > 0)
+			return EvaluateBaked(position);
+
 		int prevCacheKey = cacheKey;
 		int keyLeftIdx = -1, keyRightIdx = -1;
 		SearchKey(mKeys, count, position, keyLeftIdx, keyRightIdx, direction, cacheKey);
@@ -103,6 +113,77 @@ namespace o2
 		return Math::Lerp(segLeft.value, segRight.value, coef);
 	}
 
+	void Curve::Evaluate(const float* positions, float* results, int count) const
+	{
+		int keysCount = mKeys.Count();
+		if (keysCount < 2 || mBakedSamplesCount == 0)
+		{
+			int cacheKey = 0, cacheKeyApprox = 0;
+			float prevPosition = count > 0 ? positions[0] : 0.0f;
+			for (int i = 0; i < count; i++)
+			{
+				results[i] = Evaluate(positions[i], positions[i] >= prevPosition, cacheKey, cacheKeyApprox);
+				prevPosition = positions[i];
+			}
+
+			return;
+		}
+
+		int i = 0;
+
+#ifdef CURVE_SSE
+		const float* values = mBakedValues.Data();
+
+		__m128 begin4 = _mm_set1_ps(mBakedBegin);
+		__m128 invStep4 = _mm_set1_ps(mBakedInvStep);
+		__m128 max4 = _mm_set1_ps((float)mBakedSamplesCount);
+		__m128 zero4 = _mm_setzero_ps();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 samplePos4 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(positions + i), begin4), invStep4);
+			samplePos4 = _mm_min_ps(_mm_max_ps(samplePos4, zero4), max4);
+
+			__m128i idx4 = _mm_cvttps_epi32(samplePos4);
+			__m128 coef4 = _mm_sub_ps(samplePos4, _mm_cvtepi32_ps(idx4));
+
+			alignas(16) int idx[4];
+			_mm_store_si128((__m128i*)idx, idx4);
+
+			__m128 left4 = _mm_set_ps(values[idx[3]], values[idx[2]], values[idx[1]], values[idx[0]]);
+			__m128 right4 = _mm_set_ps(values[idx[3] + 1], values[idx[2] + 1], values[idx[1] + 1], values[idx[0] + 1]);
+
+			_mm_storeu_ps(results + i, _mm_add_ps(left4, _mm_mul_ps(_mm_sub_ps(right4, left4), coef4)));
+		}
+#endif
+
+		for (; i < count; i++)
+			results[i] = EvaluateBaked(positions[i]);
+	}
+
+	void Curve::Evaluate(const Curve* const* curves, int curvesCount, float position, float* results)
+	{
+		for (int i = 0; i < curvesCount; i++)
+			results[i] = curves[i]->Evaluate(position);
+	}
+
+	void Curve::Bake(int samplesCount /*= 256*/)
+	{
+		mBakedSamplesCount = Math::Max(samplesCount, 1);
+		UpdateBake();
+	}
+
+	void Curve::ResetBake()
+	{
+		mBakedSamplesCount = 0;
+		mBakedValues.Clear();
+	}
+
+	bool Curve::IsBaked() const
+	{
+		return mBakedSamplesCount > 0;
+	}
+
 	void Curve::BeginKeysBatchChange()
 	{
 		mBatchChange = true;
@@ -697,28 +778,10 @@ namespace o2
 	{
 		for (int i = 1; i < mKeys.Count(); i++)
 		{
-			Key& beginKey = mKeys[i - 1];
 			Key& endKey = mKeys[i];
 
-			Vec2F rightSupport(beginKey.rightSupportPosition, beginKey.rightSupportValue);
-			Vec2F leftSupport(endKey.leftSupportPosition, endKey.leftSupportValue);
-
-			if (rightSupport.x < 0.0f)
-				rightSupport.x = 0;
-
-			if (rightSupport.x > endKey.position - beginKey.position && rightSupport.x != 0.0f)
-				rightSupport *= (endKey.position - beginKey.position) / rightSupport.x;
-
-			if (leftSupport.x > 0.0f)
-				leftSupport.x = 0;
-
-			if (leftSupport.x < beginKey.position - endKey.position && leftSupport.x != 0.0f)
-				leftSupport *= (beginKey.position - endKey.position) / leftSupport.x;
-
-			Vec2F a(beginKey.position, beginKey.value);
-			Vec2F d(endKey.position, endKey.value);
-			Vec2F b = a + rightSupport;
-			Vec2F c = d + leftSupport;
+			Vec2F a, b, c, d;
+			GetSegmentBezier(i, a, b, c, d);
 
 			endKey.mApproxValuesBounds.Set(a, a);
 			for (int j = 0; j < Key::mApproxValuesCount; j++)
@@ -733,9 +796,94 @@ namespace o2
 			}
 		}
 
+		if (mBakedSamplesCount > 0)
+			UpdateBake();
+
 		onKeysChanged();
 	}
 
+	void Curve::GetSegmentBezier(int idx, Vec2F& a, Vec2F& b, Vec2F& c, Vec2F& d) const
+	{
+		const Key& beginKey = mKeys[idx - 1];
+		const Key& endKey = mKeys[idx];
+
+		Vec2F rightSupport(beginKey.rightSupportPosition, beginKey.rightSupportValue);
+		Vec2F leftSupport(endKey.leftSupportPosition, endKey.leftSupportValue);
+
+		if (rightSupport.x < 0.0f)
+			rightSupport.x = 0;
+
+		if (rightSupport.x > endKey.position - beginKey.position && rightSupport.x != 0.0f)
+			rightSupport *= (endKey.position - beginKey.position) / rightSupport.x;
+
+		if (leftSupport.x > 0.0f)
+			leftSupport.x = 0;
+
+		if (leftSupport.x < beginKey.position - endKey.position && leftSupport.x != 0.0f)
+			leftSupport *= (beginKey.position - endKey.position) / leftSupport.x;
+
+		a.Set(beginKey.position, beginKey.value);
+		d.Set(endKey.position, endKey.value);
+		b = a + rightSupport;
+		c = d + leftSupport;
+	}
+
+	void Curve::UpdateBake()
+	{
+		mBakedValues.Resize(mBakedSamplesCount + 2);
+
+		int count = mKeys.Count();
+		if (count < 2)
+		{
+			float value = count == 1 ? mKeys[0].value : 0.0f;
+			for (auto& bakedValue : mBakedValues)
+				bakedValue = value;
+
+			mBakedBegin = 0.0f;
+			mBakedInvStep = 0.0f;
+			return;
+		}
+
+		mBakedBegin = mKeys[0].position;
+		float length = mKeys.Last().position - mBakedBegin;
+		float step = length/(float)mBakedSamplesCount;
+		mBakedInvStep = length > FLT_EPSILON ? 1.0f/step : 0.0f;
+
+		// Samples are calculated by exact bezier segments instead of approximation values
+		int segment = 1;
+		Vec2F a, b, c, d;
+		GetSegmentBezier(segment, a, b, c, d);
+
+		for (int i = 0; i <= mBakedSamplesCount; i++)
+		{
+			float position = i == mBakedSamplesCount ? mKeys.Last().position : mBakedBegin + step*(float)i;
+
+			if (position > d.x && segment < count - 1)
+			{
+				while (segment < count - 1 && mKeys[segment].position < position)
+					segment++;
+
+				GetSegmentBezier(segment, a, b, c, d);
+			}
+
+			if (d.x - a.x < FLT_EPSILON)
+				mBakedValues[i] = d.y;
+			else
+				mBakedValues[i] = Bezier(a.y, b.y, c.y, d.y, SolveMonotonicBezier(a.x, b.x, c.x, d.x, position));
+		}
+
+		mBakedValues[mBakedSamplesCount + 1] = mBakedValues[mBakedSamplesCount];
+	}
+
+	float Curve::EvaluateBaked(float position) const
+	{
+		float samplePos = Math::Clamp((position - mBakedBegin)*mBakedInvStep, 0.0f, (float)mBakedSamplesCount);
+		int idx = (int)samplePos;
+		float coef = samplePos - (float)idx;
+
+		return mBakedValues[idx] + (mBakedValues[idx + 1] - mBakedValues[idx])*coef;
+	}
+
 	Vector<Curve::Key> Curve::GetKeysNonContant()
 	{
 		return mKeys;
@@ -56,6 +56,22 @@ namespace o2
 		// Returns value by position
 		float Evaluate(float position, bool direction, int& cacheKey, int& cacheKeyApprox) const;
 
+		// Evaluates values by positions array into results. Uses SIMD when curve is baked
+		void Evaluate(const float* positions, float* results, int count) const;
+
+		// Evaluates many curves at same position into results
+		static void Evaluate(const Curve* const* curves, int curvesCount, float position, float* results);
+
+		// Bakes curve into uniformly sampled values table with samplesCount segments. Evaluation uses baked table
+		// until ResetBake() is called, it is rebaked when keys are changing. Baked curve is clamped by keys range
+		void Bake(int samplesCount = 256);
+
+		// Removes baked table, evaluation uses keys approximation
+		void ResetBake();
+
+		// Returns true when curve is baked
+		bool IsBaked() const;
+
 		// It is called when beginning keys batch change. After this call all keys modifications will not be update approximation
 		// Used for optimizing many keys change
 		void BeginKeysBatchChange();
@@ -267,6 +283,11 @@ namespace o2
 
 		Vector<Key> mKeys; // Curve keys @SERIALIZABLE
 
+		int           mBakedSamplesCount = 0; // Count of baked table segments, 0 when curve isn't baked
+		float         mBakedBegin = 0.0f;     // Baked table begin position
+		float         mBakedInvStep = 0.0f;   // Inverted baked table segment length
+		Vector<float> mBakedValues;           // Baked values table. Last value is duplicated for sampling without range check
+
 	protected:
 		// Checks all smooth keys and updates supports points
 		void CheckSmoothKeys();
@@ -274,6 +295,15 @@ namespace o2
 	    // Updates approximation
 		void UpdateApproximation();
 
+		// Returns bezier points of segment between keys idx - 1 and idx
+		void GetSegmentBezier(int idx, Vec2F& a, Vec2F& b, Vec2F& c, Vec2F& d) const;
+
+		// Updates baked values table
+		void UpdateBake();
+
+		// Returns value from baked table by position
+		float EvaluateBaked(float position) const;
+
 		// Returns keys (for property)
 		Vector<Key> GetKeysNonContant();
 
@@ -303,6 +333,10 @@ CLASS_FIELDS_META(o2::Curve)
 	PROTECTED_FIELD(mBatchChange).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mChangedKeys).DEFAULT_VALUE(false);
 	PROTECTED_FIELD(mKeys).SERIALIZABLE_ATTRIBUTE();
+	PROTECTED_FIELD(mBakedSamplesCount).DEFAULT_VALUE(0);
+	PROTECTED_FIELD(mBakedBegin).DEFAULT_VALUE(0.0f);
+	PROTECTED_FIELD(mBakedInvStep).DEFAULT_VALUE(0.0f);
+	PROTECTED_FIELD(mBakedValues);
 }
 END_META;
 CLASS_METHODS_META(o2::Curve)
@@ -310,6 +344,11 @@ CLASS_METHODS_META(o2::Curve)
 
 	PUBLIC_FUNCTION(float, Evaluate, float);
 	PUBLIC_FUNCTION(float, Evaluate, float, bool, int&, int&);
+	PUBLIC_FUNCTION(void, Evaluate, const float*, float*, int);
+	PUBLIC_STATIC_FUNCTION(void, Evaluate, const Curve* const*, int, float, float*);
+	PUBLIC_FUNCTION(void, Bake, int);
+	PUBLIC_FUNCTION(void, ResetBake);
+	PUBLIC_FUNCTION(bool, IsBaked);
 	PUBLIC_FUNCTION(void, BeginKeysBatchChange);
 	PUBLIC_FUNCTION(void, CompleteKeysBatchingChange);
 	PUBLIC_FUNCTION(void, MoveKeys, float);
@@ -355,6 +394,9 @@ CLASS_METHODS_META(o2::Curve)
 	PUBLIC_STATIC_FUNCTION(Curve, Linear);
 	PROTECTED_FUNCTION(void, CheckSmoothKeys);
 	PROTECTED_FUNCTION(void, UpdateApproximation);
+	PROTECTED_FUNCTION(void, GetSegmentBezier, int, Vec2F&, Vec2F&, Vec2F&, Vec2F&);
+	PROTECTED_FUNCTION(void, UpdateBake);
+	PROTECTED_FUNCTION(float, EvaluateBaked, float);
 	PROTECTED_FUNCTION(Vector<Key>, GetKeysNonContant);
 	PROTECTED_FUNCTION(void, OnDeserialized, const DataValue&);
 	PROTECTED_FUNCTION(void, InternalSmoothKeyAt, int, float);
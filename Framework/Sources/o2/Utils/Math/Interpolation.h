@@ -86,4 +86,21 @@ namespace o2
 	{
 		return Bezier(a, b, c, d, SolveBezier(a.x, b.x, c.x, d.x, x)).y;
 	}
+
+	// Returns bezier parameter for x by bisection. Slower than SolveBezier, but stable for degenerate curves.
+	// Bezier must be increasing by x, like curves segments
+	inline float SolveMonotonicBezier(float p0, float p1, float p2, float p3, float x, int iterations = 24)
+	{
+		float begin = 0.0f, end = 1.0f;
+		for (int i = 0; i < iterations; i++)
+		{
+			float middle = (begin + end)*0.5f;
+			if (Bezier(p0, p1, p2, p3, middle) < x)
+				begin = middle;
+			else
+				end = middle;
+		}
+
+		return (begin + end)*0.5f;
+	}
 }
@@ -134,6 +134,45 @@ namespace o2
 			return distribution(generator);
 		}
 
+		// -------------------------------------------------------------------------------------------
+		// Fast xorshift pseudo random generator with own state. Different generators can be used from
+		// different threads, and sequence is the same for the same seed
+		// -------------------------------------------------------------------------------------------
+		class XorShiftRandom
+		{
+		public:
+			// Constructor with seed
+			explicit XorShiftRandom(UInt seed = 0x9E3779B9):
+				mState(seed != 0 ? seed : 0x9E3779B9)
+			{}
+
+			// Resets sequence by seed. Zero seed is replaced by default, because zero state isn't changing
+			void SetSeed(UInt seed)
+			{
+				mState = seed != 0 ? seed : 0x9E3779B9;
+			}
+
+			// Returns next random number in full 32 bit range
+			UInt Next()
+			{
+				mState ^= mState << 13;
+				mState ^= mState >> 17;
+				mState ^= mState << 5;
+				return mState;
+			}
+
+			// Returns next random value in range from minValue to maxValue
+			template<typename T>
+			T Random(const T& minValue = 0, const T& maxValue = 1)
+			{
+				float coef = (float)(Next() >> 8)*(1.0f/16777215.0f);
+				return (T)(coef*(float)(maxValue - minValue) + (float)minValue);
+			}
+
+		private:
+			UInt mState; // Generator state, never zero
+		};
+
 		template<typename T>
 		inline T Lerp(const T& a, const T& b, float coef)
 		{
@@ -202,6 +241,16 @@ namespace o2
 			return value*(180.0f / PI());
 		}
 
+		// Returns is angles in radians equal with tolerance. Angles are compared modulo 2PI
+		inline bool AnglesEquals(float a, float b, float range = 0.0001f)
+		{
+			float delta = fmodf(a - b, PI()*2.0f);
+			if (delta < 0.0f)
+				delta += PI()*2.0f;
+
+			return delta < range || PI()*2.0f - delta < range;
+		}
+
 		inline float Sin(float rad)
 		{
 			return sinf(rad);
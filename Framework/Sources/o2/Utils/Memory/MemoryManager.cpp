@@ -2,11 +2,30 @@
 #include "MemoryManager.h"
 
 #include <algorithm>
+#include <malloc.h>
 
 #include "o2/Utils/Debug/Assert.h"
 #include "o2/Utils/Debug/Log/ConsoleLogStream.h"
 #include "o2/Utils/Debug/Log/FileLogStream.h"
 
+void* operator new(size_t size)
+{
+	void* memory = malloc(size > 0 ? size : 1);
+	if (!memory)
+		throw std::bad_alloc();
+
+#if ENABLE_ALLOCATIONS_STATISTICS == true
+	o2::MemoryManager::OnHeapAllocate(memory);
+#endif
+
+	return memory;
+}
+
+void* operator new[](size_t size)
+{
+	return ::operator new(size);
+}
+
 void* operator new(size_t size, const char* location, int line)
 {
 	void* memory = ::operator new(size);
@@ -35,6 +54,10 @@ void operator delete(void* allocMemory) noexcept
 	o2::MemoryManager::Instance().OnMemoryRelease(allocMemory);
 #endif
 
+#if ENABLE_ALLOCATIONS_STATISTICS == true
+	o2::MemoryManager::OnHeapRelease(allocMemory);
+#endif
+
 	free(allocMemory);
 }
 
@@ -66,15 +89,26 @@ void* _mmalloc(size_t size, const char* location, int line)
 
 void _mfree(void* allocMemory)
 {
-#if ENALBE_MEMORY_MANAGE == true
-	o2::MemoryManager::Instance().OnMemoryRelease(allocMemory);
-#endif
-
-	free(allocMemory);
+	::operator delete(allocMemory);
 }
 
 namespace o2
 {
+	// Heap allocations statistics. Atomic, because allocations are performed from all threads
+	static std::atomic<UInt64> heapAllocationsCount(0);
+	static std::atomic<UInt64> heapAllocatedBytes(0);
+	static std::atomic<UInt64> heapPeakAllocatedBytes(0);
+
+	// Returns real size of allocated heap block
+	static size_t GetHeapBlockSize(void* memory)
+	{
+#if defined PLATFORM_WINDOWS
+		return _msize(memory);
+#else
+		return malloc_usable_size(memory);
+#endif
+	}
+
 	MemoryManager::MemoryManager():
 		mTotalBytes(0)
 	{}
@@ -99,6 +133,8 @@ namespace o2
 
 	void MemoryManager::OnMemoryAllocate(void* memory, size_t size, const char* source, int line)
 	{
+		std::lock_guard<std::recursive_mutex> lock(mAllocsMutex);
+
 		AllocInfo info;
 		info.memory = memory;
 		info.size = size;
@@ -110,6 +146,8 @@ namespace o2
 
 	void MemoryManager::OnMemoryRelease(void* memory)
 	{
+		std::lock_guard<std::recursive_mutex> lock(mAllocsMutex);
+
 		std::map<void*, AllocInfo>::iterator fnd = mAllocs.find(memory);
 		if (fnd != mAllocs.end())
 		{
@@ -118,6 +156,43 @@ namespace o2
 		}
 	}
 
+	UInt64 MemoryManager::GetAllocationsCount()
+	{
+		return heapAllocationsCount.load(std::memory_order_relaxed);
+	}
+
+	UInt64 MemoryManager::GetAllocatedBytes()
+	{
+		return heapAllocatedBytes.load(std::memory_order_relaxed);
+	}
+
+	UInt64 MemoryManager::GetPeakAllocatedBytes()
+	{
+		return heapPeakAllocatedBytes.load(std::memory_order_relaxed);
+	}
+
+	void MemoryManager::ResetPeakAllocatedBytes()
+	{
+		heapPeakAllocatedBytes.store(heapAllocatedBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	void MemoryManager::OnHeapAllocate(void* memory)
+	{
+		UInt64 size = GetHeapBlockSize(memory);
+
+		heapAllocationsCount.fetch_add(1, std::memory_order_relaxed);
+		UInt64 allocated = heapAllocatedBytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+		UInt64 peak = heapPeakAllocatedBytes.load(std::memory_order_relaxed);
+		while (allocated > peak && !heapPeakAllocatedBytes.compare_exchange_weak(peak, allocated, std::memory_order_relaxed));
+	}
+
+	void MemoryManager::OnHeapRelease(void* memory)
+	{
+		if (memory)
+			heapAllocatedBytes.fetch_sub(GetHeapBlockSize(memory), std::memory_order_relaxed);
+	}
+
 	void MemoryManager::DumpInfo()
 	{
 		printf("========MemoryManager::DumpInfo==========\n");
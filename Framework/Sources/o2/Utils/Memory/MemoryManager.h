@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <map>
+#include <mutex>
 
 #include "o2/EngineSettings.h"
 #include "o2/Utils/Types/CommonTypes.h"
@@ -24,6 +26,12 @@ void* operator new(size_t size, const char* location, int line);
 // Overloaded managed new[] operator with source and line arguments
 void* operator new[](size_t size, const char* location, int line);
 
+// Overloaded new operator, counts allocations
+void* operator new(size_t size);
+
+// Overloaded new[] operator, counts allocations
+void* operator new[](size_t size);
+
 // Delete operator with source and line arguments
 void  operator delete(void* allocMemory, const char* location, int line);
 
@@ -67,6 +75,18 @@ namespace o2
 		// Collects information about allocated memory and prints into console
 		void DumpInfo();
 
+		// Returns count of heap allocations from application start. Always 0 when allocations statistics disabled
+		static UInt64 GetAllocationsCount();
+
+		// Returns count of currently allocated heap bytes
+		static UInt64 GetAllocatedBytes();
+
+		// Returns peak of allocated heap bytes from application start or last reset
+		static UInt64 GetPeakAllocatedBytes();
+
+		// Resets peak of allocated heap bytes to currently allocated bytes
+		static void ResetPeakAllocatedBytes();
+
 	protected:
 		// ----------------------
 		// Allocation information
@@ -84,6 +104,8 @@ namespace o2
 		std::map<void*, AllocInfo> mAllocs;     // Allocations info
 		size_t                     mTotalBytes; // Total managed allocated bytes
 
+		std::recursive_mutex mAllocsMutex; // Allocations info access mutex. Recursive because map nodes are released through overloaded delete
+
 	protected:
 		// It is called when memory was allocated and registers allocation
 		void OnMemoryAllocate(void* memory, size_t size, const char* source, int line);
@@ -91,6 +113,13 @@ namespace o2
 		// It is called when memory releasing, unregisters allocation
 		void OnMemoryRelease(void* memory);
 
+		// It is called when heap memory was allocated, updates allocations statistics
+		static void OnHeapAllocate(void* memory);
+
+		// It is called when heap memory releasing, updates allocations statistics
+		static void OnHeapRelease(void* memory);
+
+		friend void* ::operator new(size_t size);
 		friend void* ::operator new(size_t size, const char* location, int line);
 		friend void* ::operator new[](size_t size, const char* location, int line);
 		friend void  ::operator delete(void* allocMemory) noexcept;
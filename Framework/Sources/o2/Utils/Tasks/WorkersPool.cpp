@@ -0,0 +1,141 @@
+#include "o2/stdafx.h"
+#include "WorkersPool.h"
+
+#include "o2/Utils/Debug/Profiler.h"
+
+namespace o2
+{
+	WorkersPool& WorkersPool::Instance()
+	{
+		static WorkersPool instance;
+		return instance;
+	}
+
+	WorkersPool::WorkersPool():
+		mRunning(false), mNextJob(0)
+	{
+		int hardwareThreads = (int)std::thread::hardware_concurrency();
+		mWorkersCount = Math::Clamp(hardwareThreads - 1, 0, 7);
+	}
+
+	WorkersPool::~WorkersPool()
+	{
+		StopWorkers();
+	}
+
+	void WorkersPool::SetWorkersCount(int count)
+	{
+		if (mWorkersCount == count)
+			return;
+
+		StopWorkers();
+		mWorkersCount = Math::Max(count, 0);
+	}
+
+	int WorkersPool::GetWorkersCount() const
+	{
+		return mWorkersCount;
+	}
+
+	void WorkersPool::Run(Job job, void* context, int count, int workersLimit /*= allWorkers*/)
+	{
+		int workers = workersLimit == allWorkers ? mWorkersCount : Math::Min(workersLimit, mWorkersCount);
+
+		bool expectedRunning = false;
+		if (workers <= 0 || count < 2 || !mRunning.compare_exchange_strong(expectedRunning, true))
+		{
+			for (int i = 0; i < count; i++)
+				job(context, i, 0);
+
+			return;
+		}
+
+		if (mWorkers.empty())
+			StartWorkers();
+
+		mJob = job;
+		mJobContext = context;
+		mJobsCount = count;
+		mNextJob = 0;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mActiveWorkers = workers;
+			mBusyWorkers = workers;
+			mJobsGeneration++;
+		}
+
+		mJobsCondition.notify_all();
+
+		ProcessJobs(0);
+
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mDoneCondition.wait(lock, [&]() { return mBusyWorkers == 0; });
+		}
+
+		mJob = nullptr;
+		mJobContext = nullptr;
+		mRunning = false;
+	}
+
+	void WorkersPool::StartWorkers()
+	{
+		mStopWorkers = false;
+
+		for (int i = 0; i < mWorkersCount; i++)
+			mWorkers.emplace_back(&WorkersPool::ProcessWorker, this, i + 1, mJobsGeneration);
+	}
+
+	void WorkersPool::StopWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStopWorkers = true;
+		}
+
+		mJobsCondition.notify_all();
+
+		for (auto& worker : mWorkers)
+			worker.join();
+
+		mWorkers.clear();
+	}
+
+	void WorkersPool::ProcessWorker(int threadIndex, int processedGeneration)
+	{
+		PROFILE_THREAD("Worker");
+
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mJobsCondition.wait(lock, [&]() { return mStopWorkers || mJobsGeneration != processedGeneration; });
+
+				if (mStopWorkers)
+					return;
+
+				processedGeneration = mJobsGeneration;
+
+				// Batch is limited by less workers, this one isn't counted as busy
+				if (threadIndex > mActiveWorkers)
+					continue;
+			}
+
+			ProcessJobs(threadIndex);
+
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mBusyWorkers--;
+			}
+
+			mDoneCondition.notify_one();
+		}
+	}
+
+	void WorkersPool::ProcessJobs(int threadIndex)
+	{
+		for (int i = mNextJob++; i < mJobsCount; i = mNextJob++)
+			mJob(mJobContext, i, threadIndex);
+	}
+}
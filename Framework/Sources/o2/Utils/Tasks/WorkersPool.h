@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Shared workers pool access macros
+#define o2Workers o2::WorkersPool::Instance()
+
+namespace o2
+{
+	// ----------------------------------------------------------------------------------------------------
+	// Pool of worker threads, shared by engine systems: particles, physics, bitmaps processing. Runs batch
+	// of independent jobs on workers and calling thread and returns when all of them are finished. Only one
+	// batch runs at a time: when pool is busy by another thread or job calls Run, batch runs on calling thread
+	// ----------------------------------------------------------------------------------------------------
+	class WorkersPool
+	{
+	public:
+		// Job function. Index is job index in range [0, count), threadIndex is index of thread executing job:
+		// 0 for calling thread and 1...workers count for workers
+		typedef void(*Job)(void* context, int index, int threadIndex);
+
+		static const int allWorkers = -1; // Workers limit, using all pool workers
+
+	public:
+		// Returns shared pool. It is created on first use, so it is available without application
+		static WorkersPool& Instance();
+
+		// Sets count of worker threads. With zero workers jobs are run only on calling thread. Must not be
+		// called while jobs are running
+		void SetWorkersCount(int count);
+
+		// Returns count of worker threads
+		int GetWorkersCount() const;
+
+		// Calls job for each index in range [0, count) on calling thread and not more than workersLimit
+		// workers. Returns when all jobs are finished
+		void Run(Job job, void* context, int count, int workersLimit = allWorkers);
+
+		// Calls func(index, threadIndex) for each index in range [0, count). Returns when all jobs are finished
+		template<typename _func>
+		void Run(int count, const _func& func, int workersLimit = allWorkers);
+
+	protected:
+		int                      mWorkersCount = 0;     // Count of worker threads
+		std::vector<std::thread> mWorkers;              // Worker threads, started on first parallel running
+		std::atomic<bool>        mRunning;              // Is batch running now. Nested and concurrent batches run on calling thread
+		std::mutex               mMutex;                // Workers state mutex
+		std::condition_variable  mJobsCondition;        // Signals workers about new batch
+		std::condition_variable  mDoneCondition;        // Signals calling thread about finished workers
+		Job                      mJob = nullptr;        // Current batch job function
+		void*                    mJobContext = nullptr; // Current batch job context
+		std::atomic<int>         mNextJob;              // Index of next not started job
+		int                      mJobsCount = 0;        // Count of jobs in current batch
+		int                      mActiveWorkers = 0;    // Count of workers processing current batch, others are skipping it. Guarded by mMutex
+		int                      mJobsGeneration = 0;   // Index of batch, increases on each parallel running. Guarded by mMutex
+		int                      mBusyWorkers = 0;      // Count of workers processing current batch and not finished. Guarded by mMutex
+		bool                     mStopWorkers = false;  // Workers stopping flag. Guarded by mMutex
+
+	protected:
+		// Default constructor. Workers count is hardware threads count without calling thread
+		WorkersPool();
+
+		// Destructor. Stops workers
+		~WorkersPool();
+
+		// Starts worker threads
+		void StartWorkers();
+
+		// Stops and joins worker threads
+		void StopWorkers();
+
+		// Worker thread function. Waits batches newer than processedGeneration
+		void ProcessWorker(int threadIndex, int processedGeneration);
+
+		// Takes and processes jobs until all are taken
+		void ProcessJobs(int threadIndex);
+	};
+
+	template<typename _func>
+	void WorkersPool::Run(int count, const _func& func, int workersLimit /*= allWorkers*/)
+	{
+		auto job = [](void* context, int index, int threadIndex) { (*(const _func*)context)(index, threadIndex); };
+		Run(job, (void*)&func, count, workersLimit);
+	}
+}
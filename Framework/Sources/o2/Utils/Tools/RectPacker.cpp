@@ -3,6 +3,19 @@
 
 namespace o2
 {
+	// Returns is rectangles overlap. Touching rectangles don't overlap
+	static bool IsRectsOverlap(const RectF& a, const RectF& b)
+	{
+		return a.left < b.right && a.right > b.left && a.bottom < b.top && a.top > b.bottom;
+	}
+
+	// Returns is rectangle inner is inside rectangle outer
+	static bool IsRectInside(const RectF& inner, const RectF& outer)
+	{
+		return inner.left >= outer.left && inner.right <= outer.right &&
+			inner.bottom >= outer.bottom && inner.top <= outer.top;
+	}
+
 	RectsPacker::RectsPacker(const Vec2F& maxSize):
 		mMaxSize(maxSize), mRectsPool(25, 25)
 	{
@@ -16,14 +29,24 @@ namespace o2
 	RectsPacker::Rect* RectsPacker::AddRect(const Vec2F& size)
 	{
 		Rect* newRect = mRectsPool.Take();
-		newRect->size = size;
-		newRect->rect = RectF();
+		*newRect = Rect(size);
 		mRects.Add(newRect);
 		return newRect;
 	}
 
 	void RectsPacker::RemoveRect(Rect* remRect)
 	{
+		if (remRect->page >= 0 && !mNeedRepack)
+		{
+			Page& page = mPages[remRect->page];
+			page.usedArea -= remRect->size.x*remRect->size.y;
+			page.failedSize = Vec2F(FLT_MAX, FLT_MAX);
+
+			mSplitRects.Clear();
+			mSplitRects.Add(GetReservedArea(*remRect));
+			PruneFreeRects(page);
+		}
+
 		mRects.Remove(remRect);
 		mRectsPool.Free(remRect);
 	}
@@ -34,11 +57,14 @@ namespace o2
 			mRectsPool.Free(rt);
 
 		mRects.Clear();
+		mPages.Clear();
+		mNeedRepack = false;
 	}
 
 	void RectsPacker::SetMaxSize(const Vec2F& maxSize)
 	{
 		mMaxSize = maxSize;
+		mNeedRepack = true;
 	}
 
 	Vec2F RectsPacker::GetMaxSize() const
@@ -46,130 +72,262 @@ namespace o2
 		return mMaxSize;
 	}
 
+	void RectsPacker::SetPadding(float padding)
+	{
+		mPadding = padding;
+		mNeedRepack = true;
+	}
+
+	float RectsPacker::GetPadding() const
+	{
+		return mPadding;
+	}
+
+	void RectsPacker::SetExtrusion(float extrusion)
+	{
+		mExtrusion = extrusion;
+		mNeedRepack = true;
+	}
+
+	float RectsPacker::GetExtrusion() const
+	{
+		return mExtrusion;
+	}
+
+	void RectsPacker::SetRotationAllowed(bool allowed)
+	{
+		mRotationAllowed = allowed;
+		mNeedRepack = true;
+	}
+
+	bool RectsPacker::IsRotationAllowed() const
+	{
+		return mRotationAllowed;
+	}
+
 	int RectsPacker::GetPagesCount() const
 	{
-		if (mRects.IsEmpty())
-			return 0;
+		return mPages.Count();
+	}
 
-		return mRects.Max<int>([&](Rect* rt) { return rt->page; })->page + 1;
+	float RectsPacker::GetPageFillRatio(int page) const
+	{
+		return mPages[page].usedArea/(mMaxSize.x*mMaxSize.y);
 	}
 
 	bool RectsPacker::Pack()
 	{
-		for (auto node : mQuadNodes)
-			delete node;
+		if (mNeedRepack)
+			return Repack();
 
-		mQuadNodes.Clear();
+		auto newRects = mRects.FindAll([](Rect* rt) { return rt->page < 0; });
+		newRects.Sort([](Rect* a, Rect* b) {
+			float aMax = Math::Max(a->size.x, a->size.y), bMax = Math::Max(b->size.x, b->size.y);
+			if (aMax != bMax)
+				return aMax > bMax;
 
-		mRects.ForEach([](Rect* rt) { rt->page = -1; rt->rect = RectI(); });
-		mRects.Sort([](auto a, auto b) { return a->size.y > b->size.y; });
+			return Math::Min(a->size.x, a->size.y) > Math::Min(b->size.x, b->size.y);
+		});
 
-		for (auto rt : mRects)
+		bool packed = true;
+		for (auto rt : newRects)
 		{
 			if (!InsertRect(*rt))
-				return false;
+				packed = false;
 		}
 
-		return true;
+		return packed;
 	}
 
+	bool RectsPacker::Repack()
+	{
+		mPages.Clear();
+		mNeedRepack = false;
+
+		mRects.ForEach([](Rect* rt) { rt->page = -1; rt->rect = RectF(); rt->rotated = false; });
+
+		return Pack();
+	}
 
 	void RectsPacker::CreateNewPage()
 	{
-		int maxPage = -1;
-		for (auto rt : mRects)
-			maxPage = Math::Max(maxPage, rt->page);
-
-		mQuadNodes.Add(mnew QuadNode(maxPage + 1, RectF(Vec2F(), mMaxSize)));
+		mPages.Add(Page(mMaxSize + Vec2F(mPadding, mPadding)));
 	}
 
 	bool RectsPacker::InsertRect(Rect& rt)
 	{
-		for (auto node : mQuadNodes)
-		{
-			if (TryInsertRect(rt, node))
-				return true;
-		}
+		Vec2F size = rt.size + Vec2F(mExtrusion*2.0f + mPadding, mExtrusion*2.0f + mPadding);
+		Vec2F pageSize = mMaxSize + Vec2F(mPadding, mPadding);
+		float area = rt.size.x*rt.size.y;
+		float pageArea = mMaxSize.x*mMaxSize.y;
+
+		bool fitsPage = size.x <= pageSize.x && size.y <= pageSize.y;
+		bool fitsPageRotated = mRotationAllowed && size.y <= pageSize.x && size.x <= pageSize.y;
+		if (!fitsPage && !fitsPageRotated)
+			return false;
 
-		for (auto node : mQuadNodes)
+		Vec2F position;
+		bool rotated;
+
+		for (int i = 0; i < mPages.Count(); i++)
 		{
-			if (TryInsertRectInChilds(rt, node))
+			Page& page = mPages[i];
+			if (page.usedArea + area > pageArea)
+				continue;
+
+			if (size.x >= page.failedSize.x && size.y >= page.failedSize.y)
+				continue;
+
+			if (FindPlace(page, size, position, rotated))
+			{
+				PlaceRect(i, rt, position, rotated);
 				return true;
+			}
+
+			page.failedSize = size;
 		}
 
 		CreateNewPage();
+		FindPlace(mPages.Last(), size, position, rotated);
+		PlaceRect(mPages.Count() - 1, rt, position, rotated);
 
-		for (auto node : mQuadNodes)
-		{
-			if (TryInsertRect(rt, node))
-				return true;
-		}
+		return true;
+	}
 
-		for (auto node : mQuadNodes)
+	bool RectsPacker::FindPlace(const Page& page, const Vec2F& size, Vec2F& position, bool& rotated) const
+	{
+		float bestShortSide = FLT_MAX, bestLongSide = FLT_MAX;
+		bool found = false;
+
+		for (auto& freeRect : page.freeRects)
 		{
-			if (TryInsertRectInChilds(rt, node))
-				return true;
+			float width = freeRect.Width(), height = freeRect.Height();
+
+			if (size.x <= width && size.y <= height)
+			{
+				float shortSide = Math::Min(width - size.x, height - size.y);
+				float longSide = Math::Max(width - size.x, height - size.y);
+
+				if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+				{
+					bestShortSide = shortSide;
+					bestLongSide = longSide;
+					position = freeRect.LeftBottom();
+					rotated = false;
+					found = true;
+				}
+			}
+
+			if (mRotationAllowed && size.y <= width && size.x <= height)
+			{
+				float shortSide = Math::Min(width - size.y, height - size.x);
+				float longSide = Math::Max(width - size.y, height - size.x);
+
+				if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+				{
+					bestShortSide = shortSide;
+					bestLongSide = longSide;
+					position = freeRect.LeftBottom();
+					rotated = true;
+					found = true;
+				}
+			}
 		}
 
-		return false;
+		return found;
 	}
 
-	bool RectsPacker::TryInsertRect(Rect& rt, QuadNode* node)
+	void RectsPacker::PlaceRect(int pageIdx, Rect& rt, const Vec2F& position, bool rotated)
 	{
-		if (node->free && node->rect.Width() >= rt.size.x &&
-			node->rect.Height() >= rt.size.y)
+		Page& page = mPages[pageIdx];
+
+		Vec2F size = rotated ? Vec2F(rt.size.y, rt.size.x) : rt.size;
+		Vec2F leftBottom = position + Vec2F(mExtrusion, mExtrusion);
+
+		rt.page = pageIdx;
+		rt.rotated = rotated;
+		rt.rect = RectF(leftBottom, leftBottom + size);
+
+		page.usedArea += rt.size.x*rt.size.y;
+
+		// Split free rectangles, overlapped by placed area, into maximal rectangles around it
+		RectF area = GetReservedArea(rt);
+		mSplitRects.Clear();
+
+		int freeCount = 0;
+		for (int i = 0; i < page.freeRects.Count(); i++)
 		{
-			Vec2F leftDown = node->rect.LeftBottom();
-			Vec2F center = leftDown + rt.size;
-			Vec2F rightTop = node->rect.RightTop();
+			RectF freeRect = page.freeRects[i];
+			if (!IsRectsOverlap(freeRect, area))
+			{
+				page.freeRects[freeCount++] = freeRect;
+				continue;
+			}
+
+			if (area.left > freeRect.left)
+				mSplitRects.Add(RectF(freeRect.left, freeRect.top, area.left, freeRect.bottom));
 
-			node->free = false;
-			node->AddChild(mnew QuadNode(node->page, RectF(leftDown.x, rightTop.y, rightTop.x, center.y)));
-			node->AddChild(mnew QuadNode(node->page, RectF(center.x, center.y, rightTop.x, leftDown.y)));
+			if (area.right < freeRect.right)
+				mSplitRects.Add(RectF(area.right, freeRect.top, freeRect.right, freeRect.bottom));
 
-			rt.page = node->page;
-			rt.rect = RectF(leftDown, center);
+			if (area.bottom > freeRect.bottom)
+				mSplitRects.Add(RectF(freeRect.left, area.bottom, freeRect.right, freeRect.bottom));
 
-			return true;
+			if (area.top < freeRect.top)
+				mSplitRects.Add(RectF(freeRect.left, freeRect.top, freeRect.right, area.top));
 		}
 
-		return false;
+		page.freeRects.Resize(freeCount);
+		PruneFreeRects(page);
 	}
 
+	RectF RectsPacker::GetReservedArea(const Rect& rt) const
+	{
+		return RectF(rt.rect.LeftBottom() - Vec2F(mExtrusion, mExtrusion),
+					 rt.rect.RightTop() + Vec2F(mExtrusion + mPadding, mExtrusion + mPadding));
+	}
 
-	bool RectsPacker::TryInsertRectInChilds(Rect& rt, QuadNode* node)
+	void RectsPacker::PruneFreeRects(Page& page)
 	{
-		for (auto childNode : node->GetChilds())
+		for (int i = 0; i < mSplitRects.Count();)
 		{
-			if (TryInsertRect(rt, childNode))
-				return true;
-		}
+			bool isInside = false;
 
-		for (auto childNode : node->GetChilds())
-		{
-			if (TryInsertRectInChilds(rt, childNode))
-				return true;
+			for (int j = 0; j < mSplitRects.Count() && !isInside; j++)
+				isInside = i != j && IsRectInside(mSplitRects[i], mSplitRects[j]);
+
+			for (int j = 0; j < page.freeRects.Count() && !isInside; j++)
+				isInside = IsRectInside(mSplitRects[i], page.freeRects[j]);
+
+			if (isInside)
+				mSplitRects.RemoveAt(i);
+			else
+				i++;
 		}
 
-		return false;
-	}
+		int freeCount = 0;
+		for (int i = 0; i < page.freeRects.Count(); i++)
+		{
+			bool isInside = false;
+			for (int j = 0; j < mSplitRects.Count() && !isInside; j++)
+				isInside = IsRectInside(page.freeRects[i], mSplitRects[j]);
 
-	RectsPacker::QuadNode::QuadNode(int page /*= 0*/, const RectF& rect /*= RectF()*/):
-		page(page), rect(rect), free(true)
-	{}
+			if (!isInside)
+				page.freeRects[freeCount++] = page.freeRects[i];
+		}
 
-	void RectsPacker::QuadNode::OnChildAdded(QuadNode* child)
-	{
-		child->page = page;
+		page.freeRects.Resize(freeCount);
+		page.freeRects.Add(mSplitRects);
 	}
 
-	bool RectsPacker::QuadNode::operator==(const QuadNode& other)
+	RectsPacker::Page::Page(const Vec2F& size /*= Vec2F()*/):
+		failedSize(FLT_MAX, FLT_MAX)
 	{
-		return rect == other.rect && page == other.page && free == other.free;
+		freeRects.Add(RectF(Vec2F(), size));
 	}
 
 	RectsPacker::Rect::Rect(const Vec2F& size /*= Vec2F()*/):
-		size(size), page(-1)
+		size(size), page(-1), rotated(false)
 	{}
 
 }
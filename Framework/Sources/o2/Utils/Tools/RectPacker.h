@@ -1,6 +1,5 @@
 #pragma once
 
-#include "o2/Utils/Basic/ITree.h"
 #include "o2/Utils/Math/Rect.h"
 #include "o2/Utils/Math/Vector2.h"
 #include "o2/Utils/Types/Containers/Pool.h"
@@ -8,9 +7,11 @@
 
 namespace o2
 {
-	// -----------------
-	// Rectangles packer
-	// -----------------
+	// ----------------------------------------------------------------------------------------------------
+	// Rectangles packer. Uses MaxRects algorithm: each page keeps list of maximal free rectangles, and new
+	// rectangle is placed into free rectangle with best short side fit. Rectangles can be added and
+	// removed between packings, already packed rectangles keep their places
+	// ----------------------------------------------------------------------------------------------------
 	class RectsPacker
 	{
 	public:
@@ -19,9 +20,10 @@ namespace o2
 		// -----------------
 		struct Rect
 		{
-			int   page; // Page index
-			RectF rect; // Rectangle on page
-			Vec2F size; // Size of rectangle
+			int   page;    // Page index, -1 when rectangle isn't packed
+			RectF rect;    // Rectangle on page
+			Vec2F size;    // Size of rectangle
+			bool  rotated; // Is rectangle rotated by 90 degrees on page. Width of rect is size.y then
 
 		public:
 			// Constructor
@@ -35,62 +37,93 @@ namespace o2
 		// Destructor
 		~RectsPacker();
 
-		// Adds rectangle with size
+		// Adds rectangle with size. It will be placed by next Pack()
 		Rect* AddRect(const Vec2F&  size);
 
-		// Removes rectangle
+		// Removes rectangle, its space on page becomes free
 		void RemoveRect(Rect* remRect);
 
-		// Removes all rectangles and quads
+		// Removes all rectangles and pages
 		void Clear();
 
-		// Sets page maximum size
+		// Sets page maximum size. Rectangles will be repacked
 		void SetMaxSize(const Vec2F&  maxSize);
 
 		// Returns page maximum size
 		Vec2F GetMaxSize() const;
 
+		// Sets space between rectangles. Rectangles will be repacked
+		void SetPadding(float padding);
+
+		// Returns space between rectangles
+		float GetPadding() const;
+
+		// Sets space around each rectangle, which is reserved for extruded rectangle edges. Rectangles will be repacked
+		void SetExtrusion(float extrusion);
+
+		// Returns space around each rectangle, reserved for extrusion
+		float GetExtrusion() const;
+
+		// Sets rectangles can be rotated by 90 degrees for better packing. Rectangles will be repacked
+		void SetRotationAllowed(bool allowed);
+
+		// Returns is rectangles can be rotated
+		bool IsRotationAllowed() const;
+
 		// Returns pages count
 		int GetPagesCount() const;
 
-		// Tries to pack, returns true if packed successfully
+		// Returns ratio of packed rectangles area to page area
+		float GetPageFillRatio(int page) const;
+
+		// Places rectangles, which aren't packed yet, into free space of pages. Returns true if packed successfully
 		bool Pack();
 
+		// Packs all rectangles from scratch, sorted by size. It is slower than Pack(), but fills pages better
+		// after many removals. Returns true if packed successfully
+		bool Repack();
+
 	protected:
-		// ---------
-		// Quad node
-		// ---------
-		struct QuadNode: public ITreeNode<QuadNode>
+		// ------------
+		// Packing page
+		// ------------
+		struct Page
 		{
-			RectF rect; // Quad rectangle on page
-			int   page; // Page index
-			bool  free; // Is quad free
+			Vector<RectF> freeRects;    // Maximal free rectangles, they can overlap each other
+			Vec2F         failedSize;   // Size of last area, which wasn't placed. Not smaller areas are skipped fast
+			float         usedArea = 0; // Area of packed rectangles
 
 		public:
 			// Constructor
-			QuadNode(int page = 0, const RectF& rect = RectF());
-
-			//Calls when child quad was added
-			void OnChildAdded(QuadNode* child);
-
-			// Check equals operator
-			bool operator==(const QuadNode& other);
+			Page(const Vec2F& size = Vec2F());
 		};
 
-		Pool<Rect>        mRectsPool; // Rectangles pool
-		Vector<Rect*>     mRects;     // Rectangles
-		Vector<QuadNode*> mQuadNodes; // Quad nodes 
-		Vec2F             mMaxSize;   // Max page size
+		Pool<Rect>    mRectsPool;               // Rectangles pool
+		Vector<Rect*> mRects;                   // Rectangles
+		Vector<Page>  mPages;                   // Pages
+		Vector<RectF> mSplitRects;              // Free rectangles, created by last placing. Cached to avoid allocations
+		Vec2F         mMaxSize;                 // Max page size
+		float         mPadding = 0.0f;          // Space between rectangles
+		float         mExtrusion = 0.0f;        // Space around each rectangle, reserved for extrusion
+		bool          mRotationAllowed = false; // Is rectangles can be rotated
+		bool          mNeedRepack = false;      // Is packing settings changed and all rectangles must be repacked
 
 	protected:
-		// Tries to insert rectangle
+		// Tries to insert rectangle into existing pages or into new page
 		bool InsertRect(Rect& rt);
 
-		// Tries to insert rectangle in specified node
-		bool TryInsertRect(Rect& rt, QuadNode* node);
+		// Searches position for area with size on page by best short side fit. Returns false if there is no place
+		bool FindPlace(const Page& page, const Vec2F& size, Vec2F& position, bool& rotated) const;
+
+		// Places rectangle with its reserved area at position on page and splits overlapped free rectangles
+		void PlaceRect(int pageIdx, Rect& rt, const Vec2F& position, bool rotated);
+
+		// Returns rectangle area on page with padding and extrusion
+		RectF GetReservedArea(const Rect& rt) const;
 
-		// Tries to insert rectangle in specified node
-		bool TryInsertRectInChilds(Rect& rt, QuadNode* node);
+		// Removes free rectangles, which are inside other free rectangles. Only new split rectangles are checked with
+		// all free rectangles
+		void PruneFreeRects(Page& page);
 
 		// Creates new page
 		void CreateNewPage();
@@ -130,6 +130,7 @@ END_ENUM_META;
 
 ENUM_META(o2::PixelFormat)
 {
+	ENUM_ENTRY(R8);
 	ENUM_ENTRY(R8G8B8);
 	ENUM_ENTRY(R8G8B8A8);
 }
@@ -45,7 +45,7 @@ namespace o2
 
 	enum class PrimitiveType { Polygon, PolygonWire, Line };
 
-	enum class PixelFormat { R8G8B8A8, R8G8B8 };
+	enum class PixelFormat { R8G8B8A8, R8G8B8, R8 };
 
 	enum class Loop { None, Repeat, PingPong };
 